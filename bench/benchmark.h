@@ -0,0 +1,192 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_BENCH_BENCHMARK_H_
+#define SPTK_BENCH_BENCHMARK_H_
+
+#include <chrono>   // std::chrono
+#include <cstddef>  // std::size_t
+#include <cstdint>  // int64_t
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+namespace sptk {
+namespace bench {
+
+/**
+ * Number of calls of the global operator new so far. It is incremented by the
+ * replaced operator new defined in the benchmark driver.
+ */
+extern int64_t num_allocation;
+
+/**
+ * Micro-benchmark case.
+ *
+ * A derived class prepares inputs in its constructor and processes them once
+ * in Run(). Run() is called repeatedly until the minimum measurement time is
+ * reached.
+ */
+class BenchmarkCase {
+ public:
+  /**
+   * @param[in] name Name of case, e.g., fft/1024.
+   * @param[in] num_item Number of items processed in one call of Run().
+   * @param[in] item_name Unit of item, e.g., samples.
+   */
+  BenchmarkCase(const std::string& name, int64_t num_item,
+                const std::string& item_name)
+      : name_(name), num_item_(num_item), item_name_(item_name) {
+  }
+
+  virtual ~BenchmarkCase() {
+  }
+
+  const std::string& GetName() const {
+    return name_;
+  }
+
+  int64_t GetNumItem() const {
+    return num_item_;
+  }
+
+  const std::string& GetItemName() const {
+    return item_name_;
+  }
+
+  /**
+   * @return True on success, false on failure.
+   */
+  virtual bool Run() = 0;
+
+ private:
+  const std::string name_;
+  const int64_t num_item_;
+  const std::string item_name_;
+};
+
+/**
+ * Result of one benchmark case.
+ */
+struct BenchmarkResult {
+  std::string name;
+  std::string item_name;
+  int64_t num_iteration;
+  double nanoseconds_per_operation;
+  double items_per_second;
+  double allocations_per_operation;
+};
+
+/**
+ * Measure the given case.
+ *
+ * @param[in] min_time Minimum measurement time in seconds.
+ * @param[in,out] benchmark_case Case to be measured.
+ * @param[out] result Result.
+ * @return True on success, false on failure.
+ */
+inline bool Measure(double min_time, BenchmarkCase* benchmark_case,
+                    BenchmarkResult* result) {
+  typedef std::chrono::steady_clock Clock;
+
+  // Warm up caches and lazily allocated buffers.
+  if (!benchmark_case->Run()) return false;
+
+  // Grow the number of iterations until the elapsed time is long enough.
+  int64_t num_iteration(1);
+  for (;;) {
+    const int64_t num_allocation_before(num_allocation);
+    const Clock::time_point start(Clock::now());
+    for (int64_t i(0); i < num_iteration; ++i) {
+      if (!benchmark_case->Run()) return false;
+    }
+    const double elapsed_time(
+        std::chrono::duration<double>(Clock::now() - start).count());
+
+    if (min_time <= elapsed_time || (int64_t(1) << 40) <= num_iteration) {
+      result->name = benchmark_case->GetName();
+      result->item_name = benchmark_case->GetItemName();
+      result->num_iteration = num_iteration;
+      result->nanoseconds_per_operation = 1e9 * elapsed_time / num_iteration;
+      result->items_per_second =
+          benchmark_case->GetNumItem() * num_iteration / elapsed_time;
+      result->allocations_per_operation =
+          static_cast<double>(num_allocation - num_allocation_before) /
+          num_iteration;
+      return true;
+    }
+
+    const double scale(0.0 < elapsed_time ? 1.4 * min_time / elapsed_time
+                                          : 100.0);
+    num_iteration = static_cast<int64_t>(
+        num_iteration * (scale < 100.0 ? (scale < 2.0 ? 2.0 : scale) : 100.0));
+  }
+}
+
+/**
+ * Write results as JSON.
+ *
+ * @param[in] results Results.
+ * @param[out] stream Output stream.
+ */
+inline void WriteJson(const std::vector<BenchmarkResult>& results,
+                      std::ostream* stream) {
+  *stream << "{\n  \"benchmarks\": [\n";
+  for (std::size_t i(0); i < results.size(); ++i) {
+    const BenchmarkResult& r(results[i]);
+    *stream << "    {\"name\": \"" << r.name << "\", "
+            << "\"iterations\": " << r.num_iteration << ", "
+            << "\"ns_per_op\": " << r.nanoseconds_per_operation << ", "
+            << "\"items_per_second\": " << r.items_per_second << ", "
+            << "\"item\": \"" << r.item_name << "\", "
+            << "\"allocs_per_op\": " << r.allocations_per_operation << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  *stream << "  ]\n}\n";
+}
+
+}  // namespace bench
+}  // namespace sptk
+
+#endif  // SPTK_BENCH_BENCHMARK_H_
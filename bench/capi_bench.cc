@@ -0,0 +1,347 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+// Latency of one request processed in process through the C interface of
+// libsptk.so and by invoking the mgcep command. A request is mel-cepstral
+// analysis of one utterance given as windowed frames. Only the C interface is
+// used so that this program also serves as an example of embedding SPTK.
+
+#include <fcntl.h>     // open
+#include <spawn.h>     // posix_spawn
+#include <sys/wait.h>  // waitpid
+#include <unistd.h>    // close, getopt, pipe, read, unlink, write
+
+#include <algorithm>  // std::sort
+#include <cerrno>     // errno
+#include <cfloat>     // DBL_MAX
+#include <chrono>     // std::chrono
+#include <cstdlib>    // mkstemp, std::strtol
+#include <cstring>    // std::memcmp, std::memcpy
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cout, std::endl
+#include <random>     // std::mt19937, std::normal_distribution
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include "SPTK/capi/sptk_capi.h"
+
+extern char** environ;
+
+namespace {
+
+const int kDefaultNumRequest(50);
+const int kDefaultNumFrame(100);
+const int kFftLength(512);
+const int kNumOrder(24);
+const double kAlpha(0.42);
+
+struct Analyzer {
+  Analyzer()
+      : spectrum(NULL),
+        spectrum_buffer(NULL),
+        mgcep(NULL),
+        mgcep_buffer(NULL) {
+  }
+  sptk_spectrum* spectrum;
+  sptk_spectrum_buffer* spectrum_buffer;
+  sptk_mgcep* mgcep;
+  sptk_mgcep_buffer* mgcep_buffer;
+  std::vector<double> periodogram;
+};
+
+bool CreateAnalyzer(Analyzer* analyzer) {
+  return SPTK_SUCCESS == sptk_spectrum_create(kFftLength, kFftLength,
+                                              SPTK_SPECTRUM_POWER, 0.0,
+                                              -DBL_MAX, &analyzer->spectrum) &&
+         SPTK_SUCCESS ==
+             sptk_spectrum_buffer_create(&analyzer->spectrum_buffer) &&
+         SPTK_SUCCESS == sptk_mgcep_create(kFftLength, kNumOrder, kAlpha, 0.0,
+                                           30, 1e-3, &analyzer->mgcep) &&
+         SPTK_SUCCESS == sptk_mgcep_buffer_create(&analyzer->mgcep_buffer);
+}
+
+void DestroyAnalyzer(Analyzer* analyzer) {
+  sptk_mgcep_buffer_destroy(analyzer->mgcep_buffer);
+  sptk_mgcep_destroy(analyzer->mgcep);
+  sptk_spectrum_buffer_destroy(analyzer->spectrum_buffer);
+  sptk_spectrum_destroy(analyzer->spectrum);
+}
+
+bool Analyze(const std::vector<double>& frames, int num_frame,
+             Analyzer* analyzer, std::vector<double>* cepstra) {
+  analyzer->periodogram.resize(num_frame * (kFftLength / 2 + 1));
+  cepstra->resize(num_frame * (kNumOrder + 1));
+  return SPTK_SUCCESS == sptk_spectrum_run(analyzer->spectrum,
+                                           analyzer->spectrum_buffer,
+                                           frames.data(), num_frame,
+                                           analyzer->periodogram.data()) &&
+         SPTK_SUCCESS == sptk_mgcep_run(analyzer->mgcep,
+                                        analyzer->mgcep_buffer,
+                                        analyzer->periodogram.data(),
+                                        num_frame, cepstra->data());
+}
+
+// Run mgcep reading the given file and collect its output.
+bool InvokeCommand(const std::string& command_path,
+                   const std::string& input_file,
+                   std::vector<double>* cepstra) {
+  int pipe_fd[2];
+  if (pipe(pipe_fd) < 0) return false;
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, 0, input_file.c_str(), O_RDONLY,
+                                   0);
+  posix_spawn_file_actions_adddup2(&actions, pipe_fd[1], 1);
+  posix_spawn_file_actions_addclose(&actions, pipe_fd[0]);
+  posix_spawn_file_actions_addclose(&actions, pipe_fd[1]);
+
+  const std::string fft_length(std::to_string(kFftLength));
+  const std::string num_order(std::to_string(kNumOrder));
+  const std::string alpha(std::to_string(kAlpha));
+  const char* const argv[] = {command_path.c_str(), "-l", fft_length.c_str(),
+                              "-m", num_order.c_str(), "-a", alpha.c_str(),
+                              "-q", "4", NULL};
+  pid_t pid;
+  const int result(posix_spawn(&pid, command_path.c_str(), &actions, NULL,
+                               const_cast<char* const*>(argv), environ));
+  posix_spawn_file_actions_destroy(&actions);
+  close(pipe_fd[1]);
+  if (0 != result) {
+    close(pipe_fd[0]);
+    return false;
+  }
+
+  std::string output;
+  char buffer[65536];
+  for (;;) {
+    const ssize_t size(read(pipe_fd[0], buffer, sizeof(buffer)));
+    if (size < 0 && EINTR == errno) continue;
+    if (size <= 0) break;
+    output.append(buffer, size);
+  }
+  close(pipe_fd[0]);
+
+  int status(0);
+  while (waitpid(pid, &status, 0) < 0) {
+    if (EINTR != errno) return false;
+  }
+  if (!WIFEXITED(status) || 0 != WEXITSTATUS(status)) return false;
+
+  cepstra->resize(output.size() / sizeof(double));
+  std::memcpy(cepstra->data(), output.data(),
+              cepstra->size() * sizeof(double));
+  return true;
+}
+
+void PrintResult(const std::string& name, std::vector<double>* latencies) {
+  std::sort(latencies->begin(), latencies->end());
+  double sum(0.0);
+  for (double latency : *latencies) sum += latency;
+  const int size(static_cast<int>(latencies->size()));
+  std::cout << std::left << std::setw(20) << name << std::right << std::fixed
+            << std::setprecision(3) << std::setw(12) << sum / size
+            << std::setw(12) << (*latencies)[size / 2] << std::setw(12)
+            << (*latencies)[std::min(size - 1, size * 99 / 100)] << std::endl;
+}
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " capi_bench - latency of C interface and command invocation" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       capi_bench [ options ]" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -n n  : number of requests             (   int)[" << std::setw(5) << std::right << kDefaultNumRequest << "]" << std::endl;  // NOLINT
+  *stream << "       -f f  : number of frames per request   (   int)[" << std::setw(5) << std::right << kDefaultNumFrame << "]" << std::endl;  // NOLINT
+  *stream << "       -b b  : directory of SPTK commands     (string)[  bin]" << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk_get_version() << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int num_request(kDefaultNumRequest);
+  int num_frame(kDefaultNumFrame);
+  std::string bin_directory("bin");
+
+  for (;;) {
+    const int option_char(getopt(argc, argv, "n:f:b:h"));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'n': {
+        num_request = static_cast<int>(std::strtol(optarg, NULL, 10));
+        break;
+      }
+      case 'f': {
+        num_frame = static_cast<int>(std::strtol(optarg, NULL, 10));
+        break;
+      }
+      case 'b': {
+        bin_directory = optarg;
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+  if (num_request <= 0 || num_frame <= 0) {
+    PrintUsage(&std::cerr);
+    return 1;
+  }
+  if (SPTK_CAPI_VERSION != sptk_get_capi_version()) {
+    std::cerr << "capi_bench: Mismatched version of libsptk.so" << std::endl;
+    return 1;
+  }
+
+  // Hanning-windowed noise stands in for an utterance.
+  std::vector<double> frames(num_frame * kFftLength);
+  {
+    std::mt19937 generator(1);
+    std::normal_distribution<double> distribution;
+    for (double& x : frames) x = distribution(generator);
+    sptk_window* window;
+    sptk_window_buffer* window_buffer;
+    if (SPTK_SUCCESS != sptk_window_create(kFftLength, kFftLength,
+                                           SPTK_WINDOW_HANNING,
+                                           SPTK_NORMALIZATION_POWER, 0,
+                                           &window) ||
+        SPTK_SUCCESS != sptk_window_buffer_create(&window_buffer) ||
+        SPTK_SUCCESS != sptk_window_run(window, window_buffer, frames.data(),
+                                        num_frame, frames.data())) {
+      std::cerr << "capi_bench: Failed to window frames" << std::endl;
+      return 1;
+    }
+    sptk_window_buffer_destroy(window_buffer);
+    sptk_window_destroy(window);
+  }
+
+  char input_file[] = "/tmp/capi_bench.XXXXXX";
+  const int input_fd(mkstemp(input_file));
+  if (input_fd < 0) return 1;
+  const ssize_t input_size(frames.size() * sizeof(double));
+  const bool is_written(input_size == write(input_fd, frames.data(),
+                                            input_size));
+  close(input_fd);
+  if (!is_written) {
+    unlink(input_file);
+    return 1;
+  }
+
+  typedef std::chrono::steady_clock Clock;
+  std::vector<double> warm_latencies, cold_latencies, command_latencies;
+  std::vector<double> expected_cepstra, cepstra;
+  bool is_successful(true);
+
+  Analyzer warm_analyzer;
+  if (!CreateAnalyzer(&warm_analyzer) ||
+      !Analyze(frames, num_frame, &warm_analyzer, &expected_cepstra)) {
+    is_successful = false;
+  }
+
+  for (int i(0); i < num_request && is_successful; ++i) {
+    // Objects kept across requests.
+    Clock::time_point start(Clock::now());
+    is_successful = Analyze(frames, num_frame, &warm_analyzer, &cepstra);
+    warm_latencies.push_back(
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count());
+
+    // Objects created for each request.
+    start = Clock::now();
+    Analyzer cold_analyzer;
+    is_successful = is_successful && CreateAnalyzer(&cold_analyzer) &&
+                    Analyze(frames, num_frame, &cold_analyzer, &cepstra);
+    DestroyAnalyzer(&cold_analyzer);
+    cold_latencies.push_back(
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count());
+
+    // A process for each request.
+    start = Clock::now();
+    is_successful = is_successful &&
+                    InvokeCommand(bin_directory + "/mgcep", input_file,
+                                  &cepstra);
+    command_latencies.push_back(
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count());
+    if (is_successful &&
+        (cepstra.size() != expected_cepstra.size() ||
+         0 != std::memcmp(cepstra.data(), expected_cepstra.data(),
+                          cepstra.size() * sizeof(double)))) {
+      std::cerr << "capi_bench: Outputs of mgcep and libsptk.so differ"
+                << std::endl;
+      is_successful = false;
+    }
+  }
+  DestroyAnalyzer(&warm_analyzer);
+  unlink(input_file);
+
+  if (!is_successful) {
+    std::cerr << "capi_bench: Failed to process requests" << std::endl;
+    return 1;
+  }
+
+  std::cout << std::left << std::setw(20) << "latency [ms]" << std::right
+            << std::setw(12) << "mean" << std::setw(12) << "p50"
+            << std::setw(12) << "p99" << std::endl;
+  PrintResult("capi (warm)", &warm_latencies);
+  PrintResult("capi (cold)", &cold_latencies);
+  PrintResult("command", &command_latencies);
+
+  return 0;
+}
@@ -0,0 +1,221 @@
+#!/bin/bash
+# ----------------------------------------------------------------- #
+#             The Speech Signal Processing Toolkit (SPTK)           #
+#             developed by SPTK Working Group                       #
+#             http://sp-tk.sourceforge.net/                         #
+# ----------------------------------------------------------------- #
+#                                                                   #
+#  Copyright (c) 1984-2007  Tokyo Institute of Technology           #
+#                           Interdisciplinary Graduate School of    #
+#                           Science and Engineering                 #
+#                                                                   #
+#                1996-2021  Nagoya Institute of Technology          #
+#                           Department of Computer Science          #
+#                                                                   #
+# All rights reserved.                                              #
+#                                                                   #
+# Redistribution and use in source and binary forms, with or        #
+# without modification, are permitted provided that the following   #
+# conditions are met:                                               #
+#                                                                   #
+# - Redistributions of source code must retain the above copyright  #
+#   notice, this list of conditions and the following disclaimer.   #
+# - Redistributions in binary form must reproduce the above         #
+#   copyright notice, this list of conditions and the following     #
+#   disclaimer in the documentation and/or other materials provided #
+#   with the distribution.                                          #
+# - Neither the name of the SPTK working group nor the names of its #
+#   contributors may be used to endorse or promote products derived #
+#   from this software without specific prior written permission.   #
+#                                                                   #
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            #
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       #
+# INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          #
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          #
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS #
+# BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          #
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   #
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     #
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON #
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   #
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    #
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           #
+# POSSIBILITY OF SUCH DAMAGE.                                       #
+# ----------------------------------------------------------------- #
+
+# Measure throughput of the recipes in egs/ on scaled-up input.
+#
+# Each recipe is run in a temporary directory with its SPTK commands replaced
+# by links to stage_probe, which records CPU time, peak RSS and output bytes of
+# every stage. The results are summarized per recipe and per command, and can
+# be saved as a baseline or compared with a stored baseline.
+
+set -euo pipefail
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+
+scale=10          # Number of copies of the original data
+filter=""         # Run recipes whose name contains this string
+baseline=""       # Baseline to be compared
+output=""         # File to save the current results
+time_threshold=20 # Allowed increase of time [%]
+rss_threshold=20  # Allowed increase of peak RSS [%]
+min_time=0.1      # Time under which no comparison is made [sec]
+probe=$root/build/bench/stage_probe
+
+usage() {
+   cat <<USAGE
+
+ egs_bench.sh - throughput benchmark of egs recipes
+
+  usage:
+       egs_bench.sh [ options ]
+  options:
+       -s s  : scale of input data             (   int)[$(printf %5s $scale)]
+       -f f  : run recipes whose name contains f (string)[  N/A]
+       -b b  : baseline file to be compared    (string)[  N/A]
+       -o o  : file to save results            (string)[  N/A]
+       -t t  : threshold of time increase [%]  (double)[$(printf %5s $time_threshold)]
+       -r r  : threshold of RSS increase [%]   (double)[$(printf %5s $rss_threshold)]
+       -n n  : minimum time to be compared     (double)[$(printf %5s $min_time)]
+       -p p  : path to stage_probe             (string)[  N/A]
+       -h    : print this message
+
+USAGE
+}
+
+while getopts "s:f:b:o:t:r:n:p:h" opt; do
+   case $opt in
+      s) scale=$OPTARG ;;
+      f) filter=$OPTARG ;;
+      b) baseline=$OPTARG ;;
+      o) output=$OPTARG ;;
+      t) time_threshold=$OPTARG ;;
+      r) rss_threshold=$OPTARG ;;
+      n) min_time=$OPTARG ;;
+      p) probe=$OPTARG ;;
+      h) usage; exit 0 ;;
+      *) usage >&2; exit 1 ;;
+   esac
+done
+
+if [ ! -x "$probe" ]; then
+   echo "egs_bench.sh: cannot find $probe" >&2
+   exit 1
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# Replace every command by the probe.
+mkdir -p "$work/bin"
+for cmd in "$root"/bin/*; do
+   ln -s "$probe" "$work/bin/$(basename "$cmd")"
+done
+export SPTK_BENCH_BINDIR=$root/bin
+
+# Make input by concatenating the original data with varying gains so that
+# copies are not identical.
+gains=(1.0 0.7 1.3 0.9 1.1)
+for i in $(seq 0 $(($scale - 1))); do
+   "$root"/bin/x2x +sd "$root"/asset/data.short | \
+      "$root"/bin/sopr -m ${gains[$(($i % ${#gains[@]}))]} | \
+      "$root"/bin/x2x +ds -r
+done > "$work/data.short"
+
+results=$work/results.tsv
+printf "#scale\t%d\n" $scale > "$results"
+for recipe in "$root"/egs/*/*/run.sh; do
+   name=$(dirname "${recipe#$root/egs/}")
+   if [ -n "$filter" ] && [[ $name != *$filter* ]]; then
+      continue
+   fi
+
+   dir=$work/egs/$name
+   mkdir -p "$dir"
+   sed -e "s|^sptk4=.*|sptk4=$work/bin|" \
+       -e "s|^data=.*|data=$work/data.short|" "$recipe" > "$dir/run.sh"
+
+   export SPTK_BENCH_LOG=$dir/stage.log
+   : > "$SPTK_BENCH_LOG"
+   start=$(date +%s.%N)
+   if ! (cd "$dir" && bash run.sh > /dev/null); then
+      echo "egs_bench.sh: $name failed" >&2
+      exit 1
+   fi
+   end=$(date +%s.%N)
+
+   # Columns: recipe, stage, calls, wall time, CPU time, peak RSS, bytes.
+   awk -F '\t' -v recipe="$name" -v start="$start" -v end="$end" '
+      {
+         calls[$1]++
+         cpu[$1] += $2 + $3
+         if (rss[$1] < $4) rss[$1] = $4
+         bytes[$1] += $5
+         time[$1] += $6
+         total_cpu += $2 + $3
+         if (total_rss < $4) total_rss = $4
+         total_bytes += $5
+      }
+      END {
+         for (s in calls) {
+            printf "%s\t%s\t%d\t%.3f\t%.3f\t%d\t%d\n", \
+               recipe, s, calls[s], time[s], cpu[s], rss[s], bytes[s]
+         }
+         printf "%s\t%s\t%d\t%.3f\t%.3f\t%d\t%d\n", \
+            recipe, "total", NR, end - start, total_cpu, total_rss, total_bytes
+      }' "$SPTK_BENCH_LOG" | sort -t "$(printf '\t')" -k1,1 -k5,5gr >> "$results"
+done
+
+awk -F '\t' '
+   BEGIN {
+      printf "%-32s %-16s %6s %9s %9s %9s %12s %6s\n", \
+         "recipe", "stage", "calls", "wall[s]", "cpu[s]", "rss[KB]", \
+         "bytes", "cpu[%]"
+   }
+   /^#/ { next }
+   $2 == "total" { total[$1] = $5 }
+   { row[++n] = $0 }
+   END {
+      for (i = 1; i <= n; i++) {
+         split(row[i], f, "\t")
+         share = (0 < total[f[1]]) ? 100 * f[5] / total[f[1]] : 0
+         printf "%-32s %-16s %6d %9.3f %9.3f %9d %12d %6.1f\n", \
+            f[1], f[2], f[3], f[4], f[5], f[6], f[7], share
+      }
+   }' "$results"
+
+if [ -n "$output" ]; then
+   cp "$results" "$output"
+fi
+
+if [ -n "$baseline" ]; then
+   if [ "$(head -n 1 "$baseline")" != "$(head -n 1 "$results")" ]; then
+      echo "egs_bench.sh: scale of $baseline differs" >&2
+      exit 1
+   fi
+
+   # Stages are compared by CPU time, and recipes by wall time as well.
+   awk -F '\t' -v tt="$time_threshold" -v rt="$rss_threshold" \
+       -v min_time="$min_time" '
+      /^#/ { next }
+      FNR == NR { key = $1 "\t" $2; wall[key] = $4; cpu[key] = $5; rss[key] = $6; next }
+      {
+         key = $1 "\t" $2
+         if (!(key in cpu)) next
+         if ($2 == "total" && min_time <= wall[key] && \
+             wall[key] * (1 + tt / 100) < $4) {
+            printf "REGRESSION %s %s: wall %.3f -> %.3f\n", $1, $2, wall[key], $4
+            failed = 1
+         }
+         if (min_time <= cpu[key] && cpu[key] * (1 + tt / 100) < $5) {
+            printf "REGRESSION %s %s: cpu %.3f -> %.3f\n", $1, $2, cpu[key], $5
+            failed = 1
+         }
+         if (0 < rss[key] && rss[key] * (1 + rt / 100) < $6) {
+            printf "REGRESSION %s %s: rss %d -> %d\n", $1, $2, rss[key], $6
+            failed = 1
+         }
+      }
+      END { exit failed }' "$baseline" "$results"
+fi
@@ -0,0 +1,550 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include <getopt.h>  // getopt_long
+
+#include <cmath>     // std::cos, std::exp
+#include <cstdint>   // int64_t
+#include <cstdlib>   // std::malloc, std::free
+#include <fstream>   // std::ofstream
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cout, std::endl
+#include <new>       // std::bad_alloc
+#include <random>    // std::mt19937, std::normal_distribution
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+#include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
+#include "SPTK/compression/vector_quantization.h"
+#include "SPTK/filter/mglsa_digital_filter.h"
+#include "SPTK/filter/mlsa_digital_filter.h"
+#include "SPTK/generation/nonrecursive_maximum_likelihood_parameter_generation.h"
+#include "SPTK/math/dynamic_time_warping.h"
+#include "SPTK/math/fast_fourier_transform.h"
+#include "SPTK/math/frequency_transform.h"
+#include "SPTK/math/gaussian_mixture_modeling.h"
+#include "SPTK/math/real_valued_fast_fourier_transform.h"
+#include "SPTK/math/symmetric_matrix.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "bench/benchmark.h"
+
+// Count allocations made by the kernels.
+int64_t sptk::bench::num_allocation(0);
+
+void* operator new(std::size_t size) {
+  ++sptk::bench::num_allocation;
+  void* p(std::malloc(0 == size ? 1 : size));
+  if (NULL == p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+const double kDefaultMinTime(0.5);
+
+// Sink to keep the compiler from removing the computation.
+volatile double sink(0.0);
+
+std::vector<double> MakeRandomVector(int length, std::mt19937* engine) {
+  std::normal_distribution<double> distribution;
+  std::vector<double> vector(length);
+  for (int i(0); i < length; ++i) vector[i] = distribution(*engine);
+  return vector;
+}
+
+// Smooth spectrum-like cepstrum which decays with the order.
+std::vector<double> MakeCepstrum(int num_order, std::mt19937* engine) {
+  std::vector<double> cepstrum(MakeRandomVector(num_order + 1, engine));
+  for (int m(0); m <= num_order; ++m) cepstrum[m] *= 0.5 / (1.0 + m);
+  return cepstrum;
+}
+
+class FftCase : public sptk::bench::BenchmarkCase {
+ public:
+  explicit FftCase(int fft_length)
+      : BenchmarkCase("fft/" + std::to_string(fft_length), fft_length,
+                      "samples"),
+        fft_(fft_length) {
+    std::mt19937 engine(1);
+    real_ = MakeRandomVector(fft_length, &engine);
+    imag_ = MakeRandomVector(fft_length, &engine);
+  }
+
+  virtual bool Run() {
+    if (!fft_.Run(&real_, &imag_)) return false;
+    // Keep the magnitude bounded over iterations.
+    const double scale(1.0 / std::sqrt(real_.size()));
+    for (std::size_t i(0); i < real_.size(); ++i) {
+      real_[i] *= scale;
+      imag_[i] *= scale;
+    }
+    sink = real_[1];
+    return true;
+  }
+
+ private:
+  const sptk::FastFourierTransform fft_;
+  std::vector<double> real_;
+  std::vector<double> imag_;
+};
+
+class FftrCase : public sptk::bench::BenchmarkCase {
+ public:
+  explicit FftrCase(int fft_length)
+      : BenchmarkCase("fftr/" + std::to_string(fft_length), fft_length,
+                      "samples"),
+        fftr_(fft_length) {
+    std::mt19937 engine(1);
+    input_ = MakeRandomVector(fft_length, &engine);
+  }
+
+  virtual bool Run() {
+    if (!fftr_.Run(input_, &real_, &imag_, &buffer_)) return false;
+    sink = real_[1];
+    return true;
+  }
+
+ private:
+  const sptk::RealValuedFastFourierTransform fftr_;
+  sptk::RealValuedFastFourierTransform::Buffer buffer_;
+  std::vector<double> input_;
+  std::vector<double> real_;
+  std::vector<double> imag_;
+};
+
+class MgcepCase : public sptk::bench::BenchmarkCase {
+ public:
+  MgcepCase(int num_order, int fft_length, double gamma)
+      : BenchmarkCase("mgcep/M" + std::to_string(num_order) + "_L" +
+                          std::to_string(fft_length) + "_g" +
+                          std::to_string(gamma).substr(0, 5),
+                      1, "frames"),
+        analysis_(fft_length, num_order, 0.42, gamma, 30, 1e-3) {
+    // Periodogram of a windowed random signal.
+    std::mt19937 engine(1);
+    const sptk::RealValuedFastFourierTransform fftr(fft_length);
+    sptk::RealValuedFastFourierTransform::Buffer buffer;
+    std::vector<double> signal(MakeRandomVector(fft_length, &engine));
+    for (int i(0); i < fft_length; ++i) {
+      signal[i] *= 0.5 - 0.5 * std::cos(sptk::kTwoPi * i / fft_length);
+    }
+    std::vector<double> real, imag;
+    fftr.Run(signal, &real, &imag, &buffer);
+    periodogram_.resize(fft_length / 2 + 1);
+    for (int i(0); i <= fft_length / 2; ++i) {
+      periodogram_[i] = real[i] * real[i] + imag[i] * imag[i] + 1e-8;
+    }
+  }
+
+  virtual bool Run() {
+    if (!analysis_.Run(periodogram_, &cepstrum_, &buffer_)) return false;
+    sink = cepstrum_[0];
+    return true;
+  }
+
+ private:
+  const sptk::MelGeneralizedCepstralAnalysis analysis_;
+  sptk::MelGeneralizedCepstralAnalysis::Buffer buffer_;
+  std::vector<double> periodogram_;
+  std::vector<double> cepstrum_;
+};
+
+class MlsadfCase : public sptk::bench::BenchmarkCase {
+ public:
+  MlsadfCase(int num_order, int num_sample)
+      : BenchmarkCase("mlsadf/M" + std::to_string(num_order), num_sample,
+                      "samples"),
+        filter_(num_order, 5, 0.42, false) {
+    std::mt19937 engine(1);
+    coefficients_ = MakeCepstrum(num_order, &engine);
+    input_ = MakeRandomVector(num_sample, &engine);
+  }
+
+  virtual bool Run() {
+    double output(0.0);
+    for (std::size_t i(0); i < input_.size(); ++i) {
+      if (!filter_.Run(coefficients_, input_[i], &output, &buffer_)) {
+        return false;
+      }
+    }
+    sink = output;
+    return true;
+  }
+
+ private:
+  const sptk::MlsaDigitalFilter filter_;
+  sptk::MlsaDigitalFilter::Buffer buffer_;
+  std::vector<double> coefficients_;
+  std::vector<double> input_;
+};
+
+class MglsadfCase : public sptk::bench::BenchmarkCase {
+ public:
+  MglsadfCase(int num_order, int num_stage, int num_sample)
+      : BenchmarkCase("mglsadf/M" + std::to_string(num_order) + "_c" +
+                          std::to_string(num_stage),
+                      num_sample, "samples"),
+        filter_(num_order, 5, num_stage, 0.42, false) {
+    std::mt19937 engine(1);
+    coefficients_ = MakeCepstrum(num_order, &engine);
+    input_ = MakeRandomVector(num_sample, &engine);
+  }
+
+  virtual bool Run() {
+    double output(0.0);
+    for (std::size_t i(0); i < input_.size(); ++i) {
+      if (!filter_.Run(coefficients_, input_[i], &output, &buffer_)) {
+        return false;
+      }
+    }
+    sink = output;
+    return true;
+  }
+
+ private:
+  const sptk::MglsaDigitalFilter filter_;
+  sptk::MglsaDigitalFilter::Buffer buffer_;
+  std::vector<double> coefficients_;
+  std::vector<double> input_;
+};
+
+class GmmCase : public sptk::bench::BenchmarkCase {
+ public:
+  GmmCase(int num_order, int num_mixture, bool is_diagonal)
+      : BenchmarkCase("gmm_logprob/M" + std::to_string(num_order) + "_K" +
+                          std::to_string(num_mixture) +
+                          (is_diagonal ? "_diag" : "_full"),
+                      1, "vectors"),
+        num_order_(num_order),
+        num_mixture_(num_mixture),
+        is_diagonal_(is_diagonal),
+        weights_(num_mixture, 1.0 / num_mixture),
+        covariance_matrices_(num_mixture,
+                             sptk::SymmetricMatrix(num_order + 1)) {
+    std::mt19937 engine(1);
+    input_ = MakeRandomVector(num_order + 1, &engine);
+    for (int k(0); k < num_mixture; ++k) {
+      mean_vectors_.push_back(MakeRandomVector(num_order + 1, &engine));
+      for (int i(0); i <= num_order; ++i) {
+        covariance_matrices_[k][i][i] = 1.0 + 0.1 * k;
+        if (!is_diagonal) {
+          for (int j(0); j < i; ++j) {
+            covariance_matrices_[k][i][j] = 0.1 / (1.0 + i - j);
+          }
+        }
+      }
+    }
+  }
+
+  virtual bool Run() {
+    double log_probability;
+    if (!sptk::GaussianMixtureModeling::CalculateLogProbability(
+            num_order_, num_mixture_, is_diagonal_, false, input_, weights_,
+            mean_vectors_, covariance_matrices_, &components_,
+            &log_probability, &buffer_)) {
+      return false;
+    }
+    sink = log_probability;
+    return true;
+  }
+
+ private:
+  const int num_order_;
+  const int num_mixture_;
+  const bool is_diagonal_;
+  std::vector<double> input_;
+  std::vector<double> weights_;
+  std::vector<std::vector<double> > mean_vectors_;
+  std::vector<sptk::SymmetricMatrix> covariance_matrices_;
+  std::vector<double> components_;
+  sptk::GaussianMixtureModeling::Buffer buffer_;
+};
+
+class DtwCase : public sptk::bench::BenchmarkCase {
+ public:
+  DtwCase(int num_order, int num_frame)
+      : BenchmarkCase("dtw/M" + std::to_string(num_order) + "_T" +
+                          std::to_string(num_frame),
+                      static_cast<int64_t>(num_frame) * num_frame, "cells"),
+        dtw_(num_order, sptk::DynamicTimeWarping::kType5,
+             sptk::DistanceCalculation::kEuclidean) {
+    std::mt19937 engine(1);
+    for (int t(0); t < num_frame; ++t) {
+      query_.push_back(MakeRandomVector(num_order + 1, &engine));
+      reference_.push_back(MakeRandomVector(num_order + 1, &engine));
+    }
+  }
+
+  virtual bool Run() {
+    double total_score;
+    if (!dtw_.Run(query_, reference_, &path_, &total_score)) return false;
+    sink = total_score;
+    return true;
+  }
+
+ private:
+  const sptk::DynamicTimeWarping dtw_;
+  std::vector<std::vector<double> > query_;
+  std::vector<std::vector<double> > reference_;
+  std::vector<std::pair<int, int> > path_;
+};
+
+class VqCase : public sptk::bench::BenchmarkCase {
+ public:
+  VqCase(int num_order, int codebook_size)
+      : BenchmarkCase("vq/M" + std::to_string(num_order) + "_I" +
+                          std::to_string(codebook_size),
+                      1, "vectors"),
+        vq_(num_order) {
+    std::mt19937 engine(1);
+    input_ = MakeRandomVector(num_order + 1, &engine);
+    for (int i(0); i < codebook_size; ++i) {
+      codebook_.push_back(MakeRandomVector(num_order + 1, &engine));
+    }
+  }
+
+  virtual bool Run() {
+    int index;
+    if (!vq_.Run(input_, codebook_, &index)) return false;
+    sink = index;
+    return true;
+  }
+
+ private:
+  const sptk::VectorQuantization vq_;
+  std::vector<double> input_;
+  std::vector<std::vector<double> > codebook_;
+};
+
+class FreqtCase : public sptk::bench::BenchmarkCase {
+ public:
+  FreqtCase(int num_input_order, int num_output_order)
+      : BenchmarkCase("freqt/M" + std::to_string(num_input_order) + "_to_M" +
+                          std::to_string(num_output_order),
+                      1, "frames"),
+        freqt_(num_input_order, num_output_order, 0.42) {
+    std::mt19937 engine(1);
+    input_ = MakeCepstrum(num_input_order, &engine);
+  }
+
+  virtual bool Run() {
+    if (!freqt_.Run(input_, &output_, &buffer_)) return false;
+    sink = output_[0];
+    return true;
+  }
+
+ private:
+  const sptk::FrequencyTransform freqt_;
+  sptk::FrequencyTransform::Buffer buffer_;
+  std::vector<double> input_;
+  std::vector<double> output_;
+};
+
+class MlpgCase : public sptk::bench::BenchmarkCase {
+ public:
+  MlpgCase(int num_order, int num_frame)
+      : BenchmarkCase("mlpg/M" + std::to_string(num_order) + "_T" +
+                          std::to_string(num_frame),
+                      num_frame, "frames"),
+        generation_(num_order, MakeWindows(), false) {
+    std::mt19937 engine(1);
+    const int length(3 * (num_order + 1));
+    for (int t(0); t < num_frame; ++t) {
+      mean_vectors_.push_back(MakeRandomVector(length, &engine));
+      variance_vectors_.push_back(std::vector<double>(length, 1.0));
+    }
+  }
+
+  virtual bool Run() {
+    if (!generation_.Run(mean_vectors_, variance_vectors_, &output_)) {
+      return false;
+    }
+    sink = output_[0][0];
+    return true;
+  }
+
+ private:
+  static std::vector<std::vector<double> > MakeWindows() {
+    std::vector<std::vector<double> > windows;
+    windows.push_back({-0.5, 0.0, 0.5});
+    windows.push_back({1.0, -2.0, 1.0});
+    return windows;
+  }
+
+  const sptk::NonrecursiveMaximumLikelihoodParameterGeneration generation_;
+  std::vector<std::vector<double> > mean_vectors_;
+  std::vector<std::vector<double> > variance_vectors_;
+  std::vector<std::vector<double> > output_;
+};
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " sptk_bench - micro-benchmark of core kernels" << std::endl;
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       sptk_bench [ options ]" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -f f  : run cases whose name contains f (string)[  N/A]" << std::endl;  // NOLINT
+  *stream << "       -t t  : minimum time per case [sec]    (double)[" << std::setw(5) << std::right << kDefaultMinTime << "]" << std::endl;  // NOLINT
+  *stream << "       -j j  : output JSON file               (string)[  N/A]" << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string filter;
+  double min_time(kDefaultMinTime);
+  const char* json_file(NULL);
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "f:t:j:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'f': {
+        filter = optarg;
+        break;
+      }
+      case 't': {
+        if (!sptk::ConvertStringToDouble(optarg, &min_time) ||
+            min_time <= 0.0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -t option must be a positive number";
+          sptk::PrintErrorMessage("sptk_bench", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'j': {
+        json_file = optarg;
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  // Sizes follow typical settings of SPTK: 16 kHz speech, 25 ms frames, 5 ms
+  // shift, and 24-th order cepstrum.
+  FftCase fft256(256), fft512(512), fft1024(1024);
+  FftrCase fftr512(512), fftr1024(1024);
+  MgcepCase mcep(24, 512, 0.0), mgcep(24, 512, -1.0 / 3.0);
+  MlsadfCase mlsadf(24, 4096);
+  MglsadfCase mglsadf(24, 3, 4096);
+  GmmCase gmm_diagonal(24, 32, true), gmm_full(24, 32, false);
+  DtwCase dtw(24, 200);
+  VqCase vq(24, 256);
+  FreqtCase freqt(24, 24), freqt_to_spectrum(24, 511);
+  MlpgCase mlpg(24, 500);
+  sptk::bench::BenchmarkCase* const cases[] = {
+      &fft256, &fft512,       &fft1024,  &fftr512,      &fftr1024,
+      &mcep,   &mgcep,        &mlsadf,   &mglsadf,      &gmm_diagonal,
+      &gmm_full, &dtw,        &vq,       &freqt,        &freqt_to_spectrum,
+      &mlpg,
+  };
+  const int num_case(sizeof(cases) / sizeof(cases[0]));
+
+  std::vector<sptk::bench::BenchmarkResult> results;
+  bool is_successful(true);
+  std::cout << std::left << std::setw(28) << "name" << std::right
+            << std::setw(14) << "ns/op" << std::setw(16) << "items/s"
+            << std::setw(12) << "allocs/op" << std::endl;
+  for (int i(0); i < num_case; ++i) {
+    if (std::string::npos == cases[i]->GetName().find(filter)) continue;
+
+    sptk::bench::BenchmarkResult result;
+    if (!sptk::bench::Measure(min_time, cases[i], &result)) {
+      std::ostringstream error_message;
+      error_message << "Failed to run " << cases[i]->GetName();
+      sptk::PrintErrorMessage("sptk_bench", error_message);
+      is_successful = false;
+      continue;
+    }
+    results.push_back(result);
+
+    std::cout << std::left << std::setw(28) << result.name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(14)
+              << result.nanoseconds_per_operation << std::scientific
+              << std::setprecision(3) << std::setw(16)
+              << result.items_per_second << std::fixed << std::setprecision(1)
+              << std::setw(12) << result.allocations_per_operation << " "
+              << result.item_name << std::endl;
+  }
+
+  if (NULL != json_file) {
+    std::ofstream ofs(json_file);
+    if (ofs.fail()) {
+      std::ostringstream error_message;
+      error_message << "Cannot open file " << json_file;
+      sptk::PrintErrorMessage("sptk_bench", error_message);
+      return 1;
+    }
+    sptk::bench::WriteJson(results, &ofs);
+  }
+
+  return is_successful ? 0 : 1;
+}
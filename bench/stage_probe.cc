@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+// This program is not invoked directly. The benchmark driver links it under
+// the name of each SPTK command so that every stage of a recipe is run
+// through it. The probe executes the real command, relays its standard output
+// to count piped bytes, and appends resource usage of the stage to a log.
+
+#include <fcntl.h>         // open
+#include <signal.h>        // raise, signal
+#include <sys/resource.h>  // rusage
+#include <sys/time.h>      // gettimeofday
+#include <sys/wait.h>      // wait4
+#include <unistd.h>        // close, dup2, execv, fork, pipe, read, write
+
+#include <cerrno>   // errno
+#include <cstdio>   // std::snprintf
+#include <cstdlib>  // std::getenv
+#include <cstring>  // std::strrchr
+#include <string>   // std::string
+
+namespace {
+
+const int kBufferSize(65536);
+
+double GetTime() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+double ToSecond(const struct timeval& tv) {
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+bool WriteAll(int fd, const char* buffer, ssize_t size) {
+  while (0 < size) {
+    const ssize_t written(write(fd, buffer, size));
+    if (written < 0) {
+      if (EINTR == errno) continue;
+      return false;
+    }
+    buffer += written;
+    size -= written;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const char* slash(std::strrchr(argv[0], '/'));
+  const char* command_name(NULL == slash ? argv[0] : slash + 1);
+  const char* bin_directory(std::getenv("SPTK_BENCH_BINDIR"));
+  const char* log_file(std::getenv("SPTK_BENCH_LOG"));
+  if (NULL == bin_directory || NULL == log_file) {
+    const char message[] =
+        "stage_probe: SPTK_BENCH_BINDIR and SPTK_BENCH_LOG must be set\n";
+    WriteAll(2, message, sizeof(message) - 1);
+    return 1;
+  }
+  const std::string command_path(std::string(bin_directory) + "/" +
+                                 command_name);
+
+  int pipe_fd[2];
+  if (pipe(pipe_fd) < 0) return 1;
+
+  const double start_time(GetTime());
+  const pid_t pid(fork());
+  if (pid < 0) return 1;
+  if (0 == pid) {
+    close(pipe_fd[0]);
+    dup2(pipe_fd[1], 1);
+    close(pipe_fd[1]);
+    argv[0] = const_cast<char*>(command_path.c_str());
+    execv(argv[0], argv);
+    _exit(127);
+  }
+  close(pipe_fd[1]);
+  signal(SIGPIPE, SIG_IGN);
+
+  // Relay the output of the command to the next stage.
+  long long num_byte(0);  // NOLINT
+  char buffer[kBufferSize];
+  for (;;) {
+    const ssize_t size(read(pipe_fd[0], buffer, kBufferSize));
+    if (size < 0 && EINTR == errno) continue;
+    if (size <= 0) break;
+    num_byte += size;
+    // If the next stage has gone, closing the pipe lets the command receive
+    // SIGPIPE as it would without the probe.
+    if (!WriteAll(1, buffer, size)) break;
+  }
+  close(pipe_fd[0]);
+
+  int status(0);
+  struct rusage usage;
+  while (wait4(pid, &status, 0, &usage) < 0) {
+    if (EINTR != errno) return 1;
+  }
+  const double wall_time(GetTime() - start_time);
+
+  char line[512];
+  const int length(std::snprintf(
+      line, sizeof(line), "%s\t%.6f\t%.6f\t%ld\t%lld\t%.6f\n", command_name,
+      ToSecond(usage.ru_utime), ToSecond(usage.ru_stime), usage.ru_maxrss,
+      num_byte, wall_time));
+  const int log_fd(open(log_file, O_WRONLY | O_APPEND | O_CREAT, 0644));
+  if (0 <= log_fd) {
+    // A single write in append mode keeps records from concurrent stages
+    // intact.
+    WriteAll(log_fd, line, length);
+    close(log_fd);
+  }
+
+  if (WIFSIGNALED(status)) {
+    signal(WTERMSIG(status), SIG_DFL);
+    raise(WTERMSIG(status));
+  }
+  return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
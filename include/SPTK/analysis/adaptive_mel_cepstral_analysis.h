@@ -88,6 +88,13 @@ namespace sptk {
  * The coefficients of the MLSA filter are converted to the mel-cepstral
  * coefficients by a linear transformation.
  *
+ * All states of the analysis, i.e., the filter coefficients, the gradient, and
+ * the delays of the inverse MLSA filter and @f$\Phi_m(z)@f$, are packed into
+ * one array. A block of samples can be processed by one call, in which the
+ * conversion to the mel-cepstrum is performed only once at the end of the
+ * block. Several independent signals can also be analyzed at once; the states
+ * of four channels are interleaved so that they are updated in SIMD lanes.
+ *
  * @sa sptk::MlsaDigitalFilterCoefficientsToMelCepstrum
  */
 class AdaptiveMelCepstralAnalysis {
@@ -97,21 +104,16 @@ class AdaptiveMelCepstralAnalysis {
    */
   class Buffer {
    public:
-    Buffer() : prev_prediction_error_(0.0), prev_epsilon_(1.0) {
+    Buffer() : num_channel_(0) {
     }
 
     virtual ~Buffer() {
     }
 
    private:
-    double prev_prediction_error_;
-    double prev_epsilon_;
-
+    int num_channel_;
+    std::vector<double> states_;
     std::vector<double> mlsa_digital_filter_coefficients_;
-    std::vector<double> inverse_mlsa_digital_filter_coefficients_;
-    std::vector<double> buffer_for_phi_digital_filter_;
-    std::vector<double> gradient_;
-    MlsaDigitalFilter::Buffer buffer_for_mlsa_digital_filter_;
 
     friend class AdaptiveMelCepstralAnalysis;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -201,7 +203,44 @@ class AdaptiveMelCepstralAnalysis {
            std::vector<double>* mel_cepstrum,
            AdaptiveMelCepstralAnalysis::Buffer* buffer) const;
 
+  /**
+   * @param[in] input_signals @f$N@f$ input signals.
+   * @param[in] length Number of input signals, @f$N@f$.
+   * @param[out] prediction_errors @f$N@f$ prediction errors.
+   * @param[out] mel_cepstrum @f$M@f$-th order mel-cepstral coefficients after
+   *             the last sample (optional).
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const double* input_signals, int length, double* prediction_errors,
+           std::vector<double>* mel_cepstrum,
+           AdaptiveMelCepstralAnalysis::Buffer* buffer) const;
+
+  /**
+   * @param[in] num_channel Number of channels, @f$C@f$.
+   * @param[in] input_signals @f$N \times C@f$ input signals in
+   *            channel-interleaved order.
+   * @param[in] length Number of input signals per channel, @f$N@f$.
+   * @param[out] prediction_errors @f$N \times C@f$ prediction errors in
+   *             channel-interleaved order.
+   * @param[out] mel_cepstra @f$C@f$ sets of @f$M@f$-th order mel-cepstral
+   *             coefficients after the last sample (optional).
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(int num_channel, const double* input_signals, int length,
+           double* prediction_errors,
+           std::vector<std::vector<double> >* mel_cepstra,
+           AdaptiveMelCepstralAnalysis::Buffer* buffer) const;
+
  private:
+  bool Analyze(int num_channel, const double* input_signals, int length,
+               double* prediction_errors,
+               AdaptiveMelCepstralAnalysis::Buffer* buffer) const;
+
+  bool Convert(int channel, std::vector<double>* mel_cepstrum,
+               AdaptiveMelCepstralAnalysis::Buffer* buffer) const;
+
   const double min_epsilon_;
   const double momentum_;
   const double forgetting_factor_;
@@ -74,6 +74,7 @@ class AdaptiveMelGeneralizedCepstralAnalysis {
     AdaptiveGeneralizedCepstralAnalysis::Buffer
         buffer_for_generalized_cepstral_analysis_;
     AdaptiveMelCepstralAnalysis::Buffer buffer_for_mel_cepstral_analysis_;
+    std::vector<double> generalized_cepstrum_;
 
     friend class AdaptiveMelGeneralizedCepstralAnalysis;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -173,6 +174,19 @@ class AdaptiveMelGeneralizedCepstralAnalysis {
            std::vector<double>* mel_generalized_cepstrum,
            AdaptiveMelGeneralizedCepstralAnalysis::Buffer* buffer) const;
 
+  /**
+   * @param[in] input_signals @f$N@f$ input signals.
+   * @param[in] length Number of input signals, @f$N@f$.
+   * @param[out] prediction_errors @f$N@f$ prediction errors.
+   * @param[out] mel_generalized_cepstrum @f$M@f$-th order mel-generalized
+   *             cepstral coefficients after the last sample (optional).
+   * @param[in,out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const double* input_signals, int length, double* prediction_errors,
+           std::vector<double>* mel_generalized_cepstrum,
+           AdaptiveMelGeneralizedCepstralAnalysis::Buffer* buffer) const;
+
  private:
   const AdaptiveGeneralizedCepstralAnalysis generalized_cepstral_analysis_;
   const AdaptiveMelCepstralAnalysis mel_cepstral_analysis_;
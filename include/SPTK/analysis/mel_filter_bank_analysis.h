@@ -45,6 +45,7 @@
 #ifndef SPTK_ANALYSIS_MEL_FILTER_BANK_ANALYSIS_H_
 #define SPTK_ANALYSIS_MEL_FILTER_BANK_ANALYSIS_H_
 
+#include <memory>  // std::shared_ptr
 #include <vector>  // std::vector
 
 #include "SPTK/utils/sptk_utils.h"
@@ -147,12 +148,21 @@ class MelFilterBankAnalysis {
   const double floor_;
   const bool use_power_;
 
+  struct FilterBank {
+    int lower_bin_index;
+    int upper_bin_index;
+    std::vector<int> channel_indices;
+    std::vector<double> channel_weights;
+  };
+
+  static void MakeFilterBank(int fft_length, int num_channel,
+                             double sampling_rate, double lowest_frequency,
+                             double highest_frequency,
+                             FilterBank* filter_bank);
+
   bool is_valid_;
 
-  int lower_bin_index_;
-  int upper_bin_index_;
-  std::vector<int> channel_indices_;
-  std::vector<double> channel_weights_;
+  std::shared_ptr<const FilterBank> filter_bank_;
 
   DISALLOW_COPY_AND_ASSIGN(MelFilterBankAnalysis);
 };
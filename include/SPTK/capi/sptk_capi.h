@@ -0,0 +1,323 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_CAPI_SPTK_CAPI_H_
+#define SPTK_CAPI_SPTK_CAPI_H_
+
+#include <stddef.h> /* size_t */
+
+/**
+ * @file
+ * C interface of SPTK for in-process use from other languages.
+ *
+ * Each algorithm is an opaque handle created with its parameters and a
+ * separate buffer handle holding the working memory and the state of one
+ * stream. A handle is immutable after creation and can be shared among
+ * threads as long as each thread uses its own buffer.
+ *
+ * Run functions process a block of frames at once. Input and output arrays are
+ * owned by the caller and hold frames one after another, i.e., frame @f$t@f$
+ * of an @f$L@f$-length input starts at element @f$tL@f$. The lengths are
+ * given by the get_input_length and get_output_length functions.
+ *
+ * Only the functions and types declared in this file form the stable binary
+ * interface of libsptk.so. Existing declarations keep their meaning as long as
+ * SPTK_CAPI_VERSION is unchanged; new functions increase
+ * SPTK_CAPI_VERSION_MINOR.
+ */
+
+#define SPTK_CAPI_VERSION 1
+#define SPTK_CAPI_VERSION_MINOR 0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Status returned by functions.
+ */
+typedef enum {
+  SPTK_SUCCESS = 0,
+  SPTK_ERROR_INVALID_ARGUMENT = 1,
+  SPTK_ERROR_OUT_OF_MEMORY = 2,
+  SPTK_ERROR_FAILURE = 3
+} sptk_status;
+
+/**
+ * Window types. See sptk::StandardWindow.
+ */
+typedef enum {
+  SPTK_WINDOW_BARTLETT = 0,
+  SPTK_WINDOW_BLACKMAN = 1,
+  SPTK_WINDOW_BLACKMAN_HARRIS = 2,
+  SPTK_WINDOW_BLACKMAN_NUTTALL = 3,
+  SPTK_WINDOW_FLAT_TOP = 4,
+  SPTK_WINDOW_HAMMING = 5,
+  SPTK_WINDOW_HANNING = 6,
+  SPTK_WINDOW_NUTTALL = 7,
+  SPTK_WINDOW_RECTANGULAR = 8,
+  SPTK_WINDOW_TRAPEZOIDAL = 9
+} sptk_window_type;
+
+/**
+ * Window normalization types. See sptk::DataWindowing.
+ */
+typedef enum {
+  SPTK_NORMALIZATION_NONE = 0,
+  SPTK_NORMALIZATION_POWER = 1,
+  SPTK_NORMALIZATION_MAGNITUDE = 2
+} sptk_normalization_type;
+
+/**
+ * Spectrum formats. See sptk::SpectrumToSpectrum.
+ */
+typedef enum {
+  SPTK_SPECTRUM_LOG_AMPLITUDE_IN_DECIBELS = 0,
+  SPTK_SPECTRUM_LOG_AMPLITUDE = 1,
+  SPTK_SPECTRUM_AMPLITUDE = 2,
+  SPTK_SPECTRUM_POWER = 3
+} sptk_spectrum_format;
+
+/**
+ * @return Version of SPTK, e.g., "4.0".
+ */
+const char* sptk_get_version(void);
+
+/**
+ * @return SPTK_CAPI_VERSION of the library.
+ */
+int sptk_get_capi_version(void);
+
+/**
+ * @return Message describing the status.
+ */
+const char* sptk_get_status_string(sptk_status status);
+
+/*
+ * Window: sptk::DataWindowing with sptk::StandardWindow.
+ * Input is @f$L_1@f$-length data and output is @f$L_2@f$-length windowed
+ * data padded with zeros.
+ */
+typedef struct sptk_window sptk_window;
+typedef struct sptk_window_buffer sptk_window_buffer;
+
+/**
+ * @param[in] input_length Input length, @f$L_1@f$.
+ * @param[in] output_length Output length, @f$L_2@f$.
+ * @param[in] window_type Window type.
+ * @param[in] normalization_type Normalization type.
+ * @param[in] periodic If nonzero, use periodic window.
+ * @param[out] window Created handle.
+ * @return Status.
+ */
+sptk_status sptk_window_create(int input_length, int output_length,
+                               sptk_window_type window_type,
+                               sptk_normalization_type normalization_type,
+                               int periodic, sptk_window** window);
+void sptk_window_destroy(sptk_window* window);
+int sptk_window_get_input_length(const sptk_window* window);
+int sptk_window_get_output_length(const sptk_window* window);
+sptk_status sptk_window_buffer_create(sptk_window_buffer** buffer);
+void sptk_window_buffer_destroy(sptk_window_buffer* buffer);
+sptk_status sptk_window_run(const sptk_window* window,
+                            sptk_window_buffer* buffer, const double* input,
+                            size_t num_frame, double* output);
+
+/*
+ * Spectrum: sptk::WaveformToSpectrum.
+ * Input is @f$L@f$-length waveform and output is @f$(N/2+1)@f$-length
+ * spectrum.
+ */
+typedef struct sptk_spectrum sptk_spectrum;
+typedef struct sptk_spectrum_buffer sptk_spectrum_buffer;
+
+/**
+ * @param[in] frame_length Frame length, @f$L@f$.
+ * @param[in] fft_length FFT length, @f$N@f$.
+ * @param[in] output_format Output format.
+ * @param[in] epsilon Small value added to power spectrum.
+ * @param[in] relative_floor_in_decibels Relative floor in decibels.
+ * @param[out] spectrum Created handle.
+ * @return Status.
+ */
+sptk_status sptk_spectrum_create(int frame_length, int fft_length,
+                                 sptk_spectrum_format output_format,
+                                 double epsilon,
+                                 double relative_floor_in_decibels,
+                                 sptk_spectrum** spectrum);
+void sptk_spectrum_destroy(sptk_spectrum* spectrum);
+int sptk_spectrum_get_input_length(const sptk_spectrum* spectrum);
+int sptk_spectrum_get_output_length(const sptk_spectrum* spectrum);
+sptk_status sptk_spectrum_buffer_create(sptk_spectrum_buffer** buffer);
+void sptk_spectrum_buffer_destroy(sptk_spectrum_buffer* buffer);
+sptk_status sptk_spectrum_run(const sptk_spectrum* spectrum,
+                              sptk_spectrum_buffer* buffer,
+                              const double* input, size_t num_frame,
+                              double* output);
+
+/*
+ * Real-valued FFT: sptk::RealValuedFastFourierTransform.
+ * Input is @f$M@f$-th order data and outputs are @f$N@f$-length real and
+ * imaginary parts.
+ */
+typedef struct sptk_fftr sptk_fftr;
+typedef struct sptk_fftr_buffer sptk_fftr_buffer;
+
+/**
+ * @param[in] num_order Order of input, @f$M@f$.
+ * @param[in] fft_length FFT length, @f$N@f$.
+ * @param[out] fftr Created handle.
+ * @return Status.
+ */
+sptk_status sptk_fftr_create(int num_order, int fft_length, sptk_fftr** fftr);
+void sptk_fftr_destroy(sptk_fftr* fftr);
+int sptk_fftr_get_input_length(const sptk_fftr* fftr);
+int sptk_fftr_get_output_length(const sptk_fftr* fftr);
+sptk_status sptk_fftr_buffer_create(sptk_fftr_buffer** buffer);
+void sptk_fftr_buffer_destroy(sptk_fftr_buffer* buffer);
+sptk_status sptk_fftr_run(const sptk_fftr* fftr, sptk_fftr_buffer* buffer,
+                          const double* input, size_t num_frame,
+                          double* real_part_output, double* imag_part_output);
+
+/*
+ * Mel-generalized cepstral analysis: sptk::MelGeneralizedCepstralAnalysis.
+ * Input is @f$(N/2+1)@f$-length power spectrum and output is @f$M@f$-th
+ * order mel-generalized cepstrum.
+ */
+typedef struct sptk_mgcep sptk_mgcep;
+typedef struct sptk_mgcep_buffer sptk_mgcep_buffer;
+
+/**
+ * @param[in] fft_length FFT length, @f$N@f$.
+ * @param[in] num_order Order of cepstrum, @f$M@f$.
+ * @param[in] alpha All-pass constant.
+ * @param[in] gamma Exponent parameter.
+ * @param[in] num_iteration Number of iterations.
+ * @param[in] convergence_threshold Convergence threshold.
+ * @param[out] mgcep Created handle.
+ * @return Status.
+ */
+sptk_status sptk_mgcep_create(int fft_length, int num_order, double alpha,
+                              double gamma, int num_iteration,
+                              double convergence_threshold,
+                              sptk_mgcep** mgcep);
+void sptk_mgcep_destroy(sptk_mgcep* mgcep);
+int sptk_mgcep_get_input_length(const sptk_mgcep* mgcep);
+int sptk_mgcep_get_output_length(const sptk_mgcep* mgcep);
+sptk_status sptk_mgcep_buffer_create(sptk_mgcep_buffer** buffer);
+void sptk_mgcep_buffer_destroy(sptk_mgcep_buffer* buffer);
+sptk_status sptk_mgcep_run(const sptk_mgcep* mgcep, sptk_mgcep_buffer* buffer,
+                           const double* input, size_t num_frame,
+                           double* output);
+
+/*
+ * Frequency transform: sptk::FrequencyTransform.
+ * Input is @f$M_1@f$-th order cepstrum and output is @f$M_2@f$-th order
+ * warped cepstrum.
+ */
+typedef struct sptk_freqt sptk_freqt;
+typedef struct sptk_freqt_buffer sptk_freqt_buffer;
+
+/**
+ * @param[in] num_input_order Order of input, @f$M_1@f$.
+ * @param[in] num_output_order Order of output, @f$M_2@f$.
+ * @param[in] alpha All-pass constant.
+ * @param[out] freqt Created handle.
+ * @return Status.
+ */
+sptk_status sptk_freqt_create(int num_input_order, int num_output_order,
+                              double alpha, sptk_freqt** freqt);
+void sptk_freqt_destroy(sptk_freqt* freqt);
+int sptk_freqt_get_input_length(const sptk_freqt* freqt);
+int sptk_freqt_get_output_length(const sptk_freqt* freqt);
+sptk_status sptk_freqt_buffer_create(sptk_freqt_buffer** buffer);
+void sptk_freqt_buffer_destroy(sptk_freqt_buffer* buffer);
+sptk_status sptk_freqt_run(const sptk_freqt* freqt, sptk_freqt_buffer* buffer,
+                           const double* input, size_t num_frame,
+                           double* output);
+
+/*
+ * MLSA filter: sptk::MlsaDigitalFilter.
+ * A block of samples is filtered with one set of @f$M@f$-th order filter
+ * coefficients. The buffer keeps the filter state between calls.
+ */
+typedef struct sptk_mlsa sptk_mlsa;
+typedef struct sptk_mlsa_buffer sptk_mlsa_buffer;
+
+/**
+ * @param[in] num_filter_order Order of coefficients, @f$M@f$.
+ * @param[in] num_pade_order Order of Pade approximation.
+ * @param[in] alpha All-pass constant.
+ * @param[in] transposition If nonzero, use transposed form filter.
+ * @param[out] mlsa Created handle.
+ * @return Status.
+ */
+sptk_status sptk_mlsa_create(int num_filter_order, int num_pade_order,
+                             double alpha, int transposition,
+                             sptk_mlsa** mlsa);
+void sptk_mlsa_destroy(sptk_mlsa* mlsa);
+int sptk_mlsa_get_num_filter_order(const sptk_mlsa* mlsa);
+sptk_status sptk_mlsa_buffer_create(sptk_mlsa_buffer** buffer);
+void sptk_mlsa_buffer_destroy(sptk_mlsa_buffer* buffer);
+
+/**
+ * @param[in] mlsa Handle.
+ * @param[in,out] buffer Buffer.
+ * @param[in] filter_coefficients @f$M@f$-th order MLSA filter coefficients.
+ * @param[in] input Input samples.
+ * @param[in] num_sample Number of samples.
+ * @param[out] output Output samples. It may be the same as @p input.
+ * @return Status.
+ */
+sptk_status sptk_mlsa_run(const sptk_mlsa* mlsa, sptk_mlsa_buffer* buffer,
+                          const double* filter_coefficients,
+                          const double* input, size_t num_sample,
+                          double* output);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // SPTK_CAPI_SPTK_CAPI_H_
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_COMMAND_COMMAND_INTERFACE_H_
+#define SPTK_COMMAND_COMMAND_INTERFACE_H_
+
+#include <istream>  // std::istream
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+
+namespace sptk {
+
+/**
+ * An interface of command.
+ *
+ * A command holds the options of an SPTK command and processes a stream in
+ * the same way as the command. The main function of the command and
+ * sptk::Pipeline share the implementation through this interface.
+ *
+ * The options are given by SetOption() and SetOperand() in the order written
+ * on the command line, and Prepare() is called after all of them. Run() can
+ * be called from several threads at the same time after that.
+ */
+class CommandInterface {
+ public:
+  virtual ~CommandInterface() {
+  }
+
+  /**
+   * @return Options in the format of getopt, e.g., "l:p:z".
+   */
+  virtual const char* GetOptionString() const = 0;
+
+  /**
+   * @param[in] option Option character.
+   * @param[in] argument Argument of the option. Empty if it takes no argument.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool SetOption(char option, const std::string& argument,
+                         std::string* error_message) = 0;
+
+  /**
+   * @param[in] operand Operand other than options.
+   * @param[out] is_consumed False if the operand is an input file.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool SetOperand(const std::string& operand, bool* is_consumed,
+                          std::string* error_message) {
+    *is_consumed = false;
+    return true;
+  }
+
+  /**
+   * Check the given options and initialize the command.
+   *
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool Prepare(std::string* error_message) = 0;
+
+  /**
+   * @param[in] input_stream Input stream.
+   * @param[out] output_stream Output stream.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool Run(std::istream* input_stream, std::ostream* output_stream,
+                   std::string* error_message) const = 0;
+};
+
+/**
+ * Run a command as the main function of an SPTK command does.
+ *
+ * Options are parsed in the same way as getopt, @c -h prints the usage, and
+ * the input is read from a file given as an operand or from the standard
+ * input.
+ *
+ * @param[in] command_name Name of command.
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @param[in] print_usage Function to print the usage of the command.
+ * @param[in,out] command Command.
+ * @return Exit status of the command.
+ */
+int RunCommand(const std::string& command_name, int argc, char* argv[],
+               void (*print_usage)(std::ostream*), CommandInterface* command);
+
+}  // namespace sptk
+
+#endif  // SPTK_COMMAND_COMMAND_INTERFACE_H_
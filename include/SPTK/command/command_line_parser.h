@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_COMMAND_COMMAND_LINE_PARSER_H_
+#define SPTK_COMMAND_COMMAND_LINE_PARSER_H_
+
+#include <string>   // std::string
+#include <utility>  // std::pair
+#include <vector>   // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Parse command-line arguments in the same way as GNU getopt.
+ *
+ * Unlike getopt, the parser has no global state and can be used from several
+ * threads at the same time. Options and operands may be interleaved, options
+ * without an argument may be grouped as in @c -rz, an argument may be attached
+ * to its option as in @c -l400, and @c -- ends the options.
+ */
+class CommandLineParser {
+ public:
+  /**
+   * Options in the given order, e.g., {{'l', "400"}, {'z', ""}}.
+   */
+  typedef std::vector<std::pair<char, std::string> > Options;
+
+  /**
+   * @param[in] option_string Options in the format of getopt, e.g., "l:p:z".
+   */
+  explicit CommandLineParser(const std::string& option_string)
+      : option_string_(option_string) {
+  }
+
+  virtual ~CommandLineParser() {
+  }
+
+  /**
+   * @param[in] arguments Arguments excluding the command name.
+   * @param[out] options Options. On failure, the options before the invalid
+   *             one are stored.
+   * @param[out] operands Operands other than options.
+   * @param[out] error_message Error message in the same format as getopt,
+   *             e.g., "invalid option -- 'x'".
+   * @return True on success, false on failure.
+   */
+  bool Parse(const std::vector<std::string>& arguments, Options* options,
+             std::vector<std::string>* operands,
+             std::string* error_message) const;
+
+ private:
+  const std::string option_string_;
+
+  DISALLOW_COPY_AND_ASSIGN(CommandLineParser);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_COMMAND_COMMAND_LINE_PARSER_H_
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_COMMAND_FRAME_COMMAND_H_
+#define SPTK_COMMAND_FRAME_COMMAND_H_
+
+#include <istream>  // std::istream
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "SPTK/command/command_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Extract frames from data sequence as @a frame does.
+ */
+class FrameCommand : public CommandInterface {
+ public:
+  /**
+   * Position of the first frame.
+   */
+  enum FramingTypes {
+    kBegginingOfDataIsCenterOfFirstFrame = 0,
+    kBegginingOfDataIsStartOfFirstFrame,
+    kNumFramingTypes
+  };
+
+  /**
+   * Default frame length.
+   */
+  static const int kDefaultFrameLength;
+
+  /**
+   * Default frame period.
+   */
+  static const int kDefaultFramePeriod;
+
+  /**
+   * Default framing type.
+   */
+  static const FramingTypes kDefaultFramingType;
+
+  FrameCommand();
+
+  virtual ~FrameCommand() {
+  }
+
+  /**
+   * @return Options in the format of getopt.
+   */
+  virtual const char* GetOptionString() const {
+    return "l:p:n:z";
+  }
+
+  /**
+   * @param[in] option Option character.
+   * @param[in] argument Argument of the option.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool SetOption(char option, const std::string& argument,
+                         std::string* error_message);
+
+  /**
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool Prepare(std::string* error_message);
+
+  /**
+   * @param[in] input_stream Data sequence.
+   * @param[out] output_stream Framed data sequence.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool Run(std::istream* input_stream, std::ostream* output_stream,
+                   std::string* error_message) const;
+
+ private:
+  bool WriteData(const std::vector<double>& data, std::ostream* output_stream,
+                 std::string* error_message) const;
+
+  int frame_length_;
+  int frame_period_;
+  FramingTypes framing_type_;
+  bool zero_mean_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameCommand);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_COMMAND_FRAME_COMMAND_H_
@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_COMMAND_MEL_GENERALIZED_CEPSTRAL_ANALYSIS_COMMAND_H_
+#define SPTK_COMMAND_MEL_GENERALIZED_CEPSTRAL_ANALYSIS_COMMAND_H_
+
+#include <istream>  // std::istream
+#include <memory>   // std::unique_ptr
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+
+#include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
+#include "SPTK/command/command_interface.h"
+#include "SPTK/conversion/generalized_cepstrum_gain_normalization.h"
+#include "SPTK/conversion/mel_cepstrum_to_mlsa_digital_filter_coefficients.h"
+#include "SPTK/conversion/spectrum_to_spectrum.h"
+#include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Compute mel-generalized cepstrum as @a mgcep does.
+ */
+class MelGeneralizedCepstralAnalysisCommand : public CommandInterface {
+ public:
+  /**
+   * Input format.
+   */
+  enum InputFormats {
+    kLogAmplitudeSpectrumInDecibels = 0,
+    kLogAmplitudeSpectrum,
+    kAmplitudeSpectrum,
+    kPowerSpectrum,
+    kWaveform,
+    kNumInputFormats
+  };
+
+  /**
+   * Output format.
+   */
+  enum OutputFormats {
+    kCepstrum = 0,
+    kMlsaFilterCoefficients,
+    kGainNormalizedCepstrum,
+    kGainNormalizedMlsaFilterCoefficients,
+    kNumOutputFormats
+  };
+
+  /**
+   * Default order of mel-generalized cepstrum.
+   */
+  static const int kDefaultNumOrder;
+
+  /**
+   * Default all-pass constant.
+   */
+  static const double kDefaultAlpha;
+
+  /**
+   * Default gamma.
+   */
+  static const double kDefaultGamma;
+
+  /**
+   * Default FFT length.
+   */
+  static const int kDefaultFftLength;
+
+  /**
+   * Default input format.
+   */
+  static const InputFormats kDefaultInputFormat;
+
+  /**
+   * Default output format.
+   */
+  static const OutputFormats kDefaultOutputFormat;
+
+  /**
+   * Default maximum number of iterations.
+   */
+  static const int kDefaultNumIteration;
+
+  /**
+   * Default convergence threshold.
+   */
+  static const double kDefaultConvergenceThreshold;
+
+  MelGeneralizedCepstralAnalysisCommand();
+
+  virtual ~MelGeneralizedCepstralAnalysisCommand() {
+  }
+
+  /**
+   * @return Options in the format of getopt.
+   */
+  virtual const char* GetOptionString() const {
+    return "m:a:g:c:l:q:o:i:d:e:E:";
+  }
+
+  /**
+   * @param[in] option Option character.
+   * @param[in] argument Argument of the option.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool SetOption(char option, const std::string& argument,
+                         std::string* error_message);
+
+  /**
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool Prepare(std::string* error_message);
+
+  /**
+   * @param[in] input_stream Windowed data sequence or spectrum.
+   * @param[out] output_stream Mel-generalized cepstrum.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  virtual bool Run(std::istream* input_stream, std::ostream* output_stream,
+                   std::string* error_message) const;
+
+ private:
+  int num_order_;
+  double alpha_;
+  double gamma_;
+  int fft_length_;
+  InputFormats input_format_;
+  OutputFormats output_format_;
+  int num_iteration_;
+  double convergence_threshold_;
+  double epsilon_;
+  double relative_floor_in_decibels_;
+
+  std::unique_ptr<SpectrumToSpectrum> spectrum_to_spectrum_;
+  std::unique_ptr<WaveformToSpectrum> waveform_to_spectrum_;
+  std::unique_ptr<MelGeneralizedCepstralAnalysis> analysis_;
+  std::unique_ptr<MelCepstrumToMlsaDigitalFilterCoefficients>
+      mel_cepstrum_to_mlsa_digital_filter_coefficients_;
+  std::unique_ptr<GeneralizedCepstrumGainNormalization>
+      generalized_cepstrum_gain_normalization_;
+
+  DISALLOW_COPY_AND_ASSIGN(MelGeneralizedCepstralAnalysisCommand);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_COMMAND_MEL_GENERALIZED_CEPSTRAL_ANALYSIS_COMMAND_H_
@@ -51,6 +51,7 @@
 #include "SPTK/math/distance_calculation.h"
 #include "SPTK/math/statistics_accumulation.h"
 #include "SPTK/utils/sptk_utils.h"
+#include "SPTK/utils/thread_pool.h"
 
 namespace sptk {
 
@@ -198,11 +199,14 @@ class LindeBuzoGrayAlgorithm {
    * @param[in,out] codebook_vectors @f$M@f$-th order codebook vectors.
    *                The shape is @f$[I, M+1]@f$.
    * @param[out] codebook_indices @f$T@f$ codebook indices.
+   * @param[in,out] thread_pool Thread pool. If NULL, run on the caller thread.
+   *                The result does not depend on the number of threads.
    * @return True on success, false on failure.
    */
   bool Run(const std::vector<std::vector<double> >& input_vectors,
            std::vector<std::vector<double> >* codebook_vectors,
-           std::vector<int>* codebook_indices) const;
+           std::vector<int>* codebook_indices,
+           ThreadPool* thread_pool) const;
 
  private:
   const int num_order_;
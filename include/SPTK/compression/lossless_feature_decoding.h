@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_COMPRESSION_LOSSLESS_FEATURE_DECODING_H_
+#define SPTK_COMPRESSION_LOSSLESS_FEATURE_DECODING_H_
+
+#include <cstdint>  // uint32_t
+#include <istream>  // std::istream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Decode vector sequence encoded by LosslessFeatureEncoding.
+ *
+ * The header is read on construction, and then the chunks are decoded one by
+ * one. A chunk can also be skipped using only its size information.
+ */
+class LosslessFeatureDecoding {
+ public:
+  /**
+   * Buffer for LosslessFeatureDecoding class.
+   */
+  class Buffer {
+   public:
+    Buffer() {
+    }
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<char> chunk_;
+    std::vector<unsigned char> planes_;
+    std::vector<uint32_t> table_;
+
+    friend class LosslessFeatureDecoding;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  /**
+   * @param[in] input_stream Stream which starts with the header.
+   */
+  explicit LosslessFeatureDecoding(std::istream* input_stream);
+
+  virtual ~LosslessFeatureDecoding() {
+  }
+
+  /**
+   * @return Length of vector.
+   */
+  int GetVectorLength() const {
+    return vector_length_;
+  }
+
+  /**
+   * @return Data type, d (double) or f (float).
+   */
+  const std::string& GetDataType() const {
+    return data_type_;
+  }
+
+  /**
+   * @return Size of one frame in bytes.
+   */
+  int GetFrameSize() const {
+    return vector_length_ * word_size_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * Decode next chunk.
+   *
+   * @param[in] input_stream Input stream.
+   * @param[out] frames Decoded frames in the data type.
+   * @param[out] num_frame Number of decoded frames.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure or at the end of stream.
+   */
+  bool Run(std::istream* input_stream, std::vector<char>* frames,
+           int* num_frame, LosslessFeatureDecoding::Buffer* buffer) const;
+
+  /**
+   * Skip next chunk without decoding.
+   *
+   * @param[in] input_stream Input stream.
+   * @param[out] num_frame Number of skipped frames.
+   * @return True on success, false on failure or at the end of stream.
+   */
+  bool Skip(std::istream* input_stream, int* num_frame) const;
+
+ private:
+  int vector_length_;
+  std::string data_type_;
+  int word_size_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(LosslessFeatureDecoding);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_COMPRESSION_LOSSLESS_FEATURE_DECODING_H_
@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_COMPRESSION_LOSSLESS_FEATURE_ENCODING_H_
+#define SPTK_COMPRESSION_LOSSLESS_FEATURE_ENCODING_H_
+
+#include <cstdint>  // uint64_t
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Encode floating-point vector sequence without loss.
+ *
+ * Each element is predicted from the same dimension of the previous frame,
+ * and the residual is taken as XOR of the bit patterns. Since successive
+ * values share sign, exponent, and upper mantissa bits, the upper bytes of
+ * the residual are mostly zero. The residuals of a chunk are split into byte
+ * planes, i.e., the k-th byte of every element, and each plane is stored as
+ * raw bytes, a constant, or a canonical Huffman code whichever is the
+ * shortest.
+ *
+ * The encoded stream consists of a header followed by chunks:
+ * @code
+ *   "SPTKXORF", version, data type, vector length           20 bytes
+ *   number of frames, size of the rest of chunk              8 bytes  \
+ *   byte plane 0                                                      | chunk
+ *   ...                                                               |
+ *   byte plane 7 (3 for float)                                        /
+ *   ...
+ * @endcode
+ * where a byte plane is one of
+ * @code
+ *   0, bytes                                     raw
+ *   1, byte                                      constant
+ *   2, code lengths (128 bytes), size, bits      Huffman
+ * @endcode
+ * The prediction is reset at the beginning of each chunk, so any chunk can be
+ * decoded independently and skipped without decoding.
+ */
+class LosslessFeatureEncoding {
+ public:
+  /**
+   * Buffer for LosslessFeatureEncoding class.
+   */
+  class Buffer {
+   public:
+    Buffer() {
+    }
+    virtual ~Buffer() {
+    }
+
+   private:
+    std::vector<uint64_t> residuals_;
+    std::vector<unsigned char> plane_;
+    std::vector<char> payload_;
+
+    friend class LosslessFeatureEncoding;
+    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  /**
+   * @param[in] vector_length Length of vector.
+   * @param[in] data_type Data type, d (double) or f (float).
+   */
+  LosslessFeatureEncoding(int vector_length, const std::string& data_type);
+
+  virtual ~LosslessFeatureEncoding() {
+  }
+
+  /**
+   * @return Length of vector.
+   */
+  int GetVectorLength() const {
+    return vector_length_;
+  }
+
+  /**
+   * @return Size of one frame in bytes.
+   */
+  int GetFrameSize() const {
+    return vector_length_ * word_size_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] output_stream Output stream.
+   * @return True on success, false on failure.
+   */
+  bool WriteHeader(std::ostream* output_stream) const;
+
+  /**
+   * Encode one chunk.
+   *
+   * @param[in] frames Frames in the given data type.
+   * @param[in] num_frame Number of frames.
+   * @param[out] output_stream Output stream.
+   * @param[out] buffer Buffer.
+   * @return True on success, false on failure.
+   */
+  bool Run(const char* frames, int num_frame, std::ostream* output_stream,
+           LosslessFeatureEncoding::Buffer* buffer) const;
+
+ private:
+  const int vector_length_;
+  const std::string data_type_;
+  int word_size_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(LosslessFeatureEncoding);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_COMPRESSION_LOSSLESS_FEATURE_ENCODING_H_
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_COMPRESSION_LOSSLESS_FEATURE_FORMAT_H_
+#define SPTK_COMPRESSION_LOSSLESS_FEATURE_FORMAT_H_
+
+#include <cstdint>  // int32_t
+
+namespace sptk {
+
+/**
+ * Constants of the stream format shared by LosslessFeatureEncoding and
+ * LosslessFeatureDecoding. See LosslessFeatureEncoding for the layout.
+ */
+namespace lossless_feature_format {
+
+//! Magic number at the beginning of stream.
+const char* const kMagic("SPTKXORF");
+
+//! Size of magic number.
+const int kMagicSize(8);
+
+//! Version of format.
+const int32_t kFormatVersion(1);
+
+//! Size of stream header.
+const int kHeaderSize(20);
+
+//! Offset of version in stream header.
+const int kVersionOffset(8);
+
+//! Offset of data type in stream header.
+const int kDataTypeOffset(12);
+
+//! Offset of vector length in stream header.
+const int kVectorLengthOffset(16);
+
+//! Size of chunk header.
+const int kChunkHeaderSize(8);
+
+//! Number of symbols of Huffman code, i.e., byte values.
+const int kNumSymbol(256);
+
+//! Maximum length of Huffman code.
+const int kMaxCodeLength(12);
+
+/**
+ * Type of byte plane.
+ */
+enum PlaneType { kRaw = 0, kConstant, kHuffman };
+
+}  // namespace lossless_feature_format
+
+}  // namespace sptk
+
+#endif  // SPTK_COMPRESSION_LOSSLESS_FEATURE_FORMAT_H_
@@ -67,6 +67,12 @@ namespace sptk {
  *   \end{array}
  * @f]
  * The LSP coefficients are obtained by an iterative root finding algorithm.
+ * The Chebyshev polynomials are evaluated at several grid points at once to
+ * find sign changes, and each root is refined by bisection.
+ *
+ * If the previous frame is used, the grid search of each root starts just
+ * above the corresponding root of the previous frame. When not all roots are
+ * found in that way, the whole grid is searched instead.
  *
  * [1] P. Kabal and R. P. Ramachandran, &quot;The computation of line spectral
  *     frequencies using Chebyshev polynomials,&quot; IEEE Transactions on
@@ -80,7 +86,7 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
    */
   class Buffer {
    public:
-    Buffer() {
+    Buffer() : has_previous_roots_(false) {
     }
 
     virtual ~Buffer() {
@@ -89,6 +95,8 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
    private:
     std::vector<double> c1_;
     std::vector<double> c2_;
+    std::vector<double> roots_;
+    bool has_previous_roots_;
 
     friend class LinearPredictiveCoefficientsToLineSpectralPairs;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -99,10 +107,12 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
    * @param[in] num_split Number of splits of unit circle.
    * @param[in] num_iteration Number of iterations.
    * @param[in] convergence_threshold Convergence threshold.
+   * @param[in] use_previous_frame If true, roots are searched around those of
+   *            the previous frame first.
    */
-  LinearPredictiveCoefficientsToLineSpectralPairs(int num_order, int num_split,
-                                                  int num_iteration,
-                                                  double convergence_threshold);
+  LinearPredictiveCoefficientsToLineSpectralPairs(
+      int num_order, int num_split, int num_iteration,
+      double convergence_threshold, bool use_previous_frame = false);
 
   virtual ~LinearPredictiveCoefficientsToLineSpectralPairs() {
   }
@@ -135,6 +145,13 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
     return convergence_threshold_;
   }
 
+  /**
+   * @return True if the previous frame is used.
+   */
+  bool UsePreviousFrame() const {
+    return use_previous_frame_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -163,12 +180,19 @@ class LinearPredictiveCoefficientsToLineSpectralPairs {
       LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const;
 
  private:
+  bool SearchRootsOnGrid(
+      LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const;
+
+  bool SearchRootsAroundPreviousRoots(
+      LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const;
+
   const int num_order_;
   const int num_symmetric_polynomial_order_;
   const int num_asymmetric_polynomial_order_;
   const int num_split_;
   const int num_iteration_;
   const double convergence_threshold_;
+  const bool use_previous_frame_;
 
   bool is_valid_;
 
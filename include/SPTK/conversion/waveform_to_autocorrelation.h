@@ -112,6 +112,15 @@ class WaveformToAutocorrelation {
   bool Run(const std::vector<double>& waveform,
            std::vector<double>* autocorrelation) const;
 
+  /**
+   * @param[in] waveforms @f$L@f$-length framed waveforms.
+   * @param[out] autocorrelations @f$M@f$-th order autocorrelation
+   *             coefficients of each frame.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<std::vector<double> >& waveforms,
+           std::vector<std::vector<double> >* autocorrelations) const;
+
  private:
   const int frame_length_;
   const int num_order_;
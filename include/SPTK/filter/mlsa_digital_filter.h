@@ -47,6 +47,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/utils/simd_kernels.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -164,6 +165,13 @@ class MlsaDigitalFilter {
     return transposition_;
   }
 
+  /**
+   * @return Coefficients of Pade approximation.
+   */
+  const std::vector<double>& GetPadeCoefficients() const {
+    return pade_coefficients_;
+  }
+
   /**
    * @return True if this object is valid.
    */
@@ -195,6 +203,7 @@ class MlsaDigitalFilter {
   const int num_pade_order_;
   const double alpha_;
   const bool transposition_;
+  const SimdKernels& simd_kernels_;
 
   bool is_valid_;
 
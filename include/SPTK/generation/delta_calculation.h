@@ -76,6 +76,12 @@ namespace sptk {
  * @f]
  * where @f$w^{(d)}@f$ is the @f$d@f$-th window coefficients and @f$L^{(d)}@f$
  * is half the width of the window.
+ *
+ * The static components are stored in a ring buffer whose size is the width
+ * of the widest window, and all windows are applied in one pass over the
+ * buffer. Zero coefficients are skipped, and a pair of coefficients satisfying
+ * @f$w^{(d)}_{-\tau} = \pm w^{(d)}_{\tau}@f$ is folded into one
+ * multiplication, e.g., @f$w^{(d)}_{\tau} (x_{t+\tau}(m) - x_{t-\tau}(m))@f$.
  */
 class DeltaCalculation {
  public:
@@ -123,8 +129,18 @@ class DeltaCalculation {
   bool Get(std::vector<double>* delta);
 
  private:
+  enum TermType { kSingle = 0, kSymmetric, kAntisymmetric };
+
+  struct Term {
+    TermType type;
+    double coefficient;
+    int plus;
+    int minus;
+  };
+
   struct Buffer {
     std::vector<std::vector<double> > statics;
+    std::vector<const double*> frames;
     int pointer;
     int count_down;
     bool first;
@@ -146,6 +162,7 @@ class DeltaCalculation {
   int max_window_width_;
   std::vector<int> lefts_;
   std::vector<int> rights_;
+  std::vector<std::vector<Term> > terms_;
 
   Buffer buffer_;
 
@@ -45,6 +45,8 @@
 #ifndef SPTK_GENERATION_EXCITATION_GENERATION_H_
 #define SPTK_GENERATION_EXCITATION_GENERATION_H_
 
+#include <vector>  // std::vector
+
 #include "SPTK/generation/random_generation_interface.h"
 #include "SPTK/input/input_source_interpolation_with_magic_number.h"
 #include "SPTK/utils/sptk_utils.h"
@@ -57,6 +59,12 @@ namespace sptk {
  * The input is a sequence of pitch value which can be either a continuous value
  * of a magic number. The output is the excitation signal given the input
  * sequence.
+ *
+ * Noise is drawn from the random value generator block by block, so that the
+ * generator is called once per several hundred samples. The block version of
+ * Get() reads the interpolated pitch of the block first, fills the noise in
+ * bulk, and then places the pulses in a single pass over the block. It gives
+ * the same outputs as the sample-by-sample version.
  */
 class ExcitationGeneration {
  public:
@@ -88,15 +96,44 @@ class ExcitationGeneration {
    */
   bool Get(double* excitation, double* pulse, double* noise, double* pitch);
 
+  /**
+   * Get excitation signal at once.
+   *
+   * @param[in] length Maximum number of samples to be generated.
+   * @param[out] excitation @f$L@f$ samples of excitation (optional).
+   * @param[out] pulse @f$L@f$ samples of pulse (optional).
+   * @param[out] noise @f$L@f$ samples of noise (optional).
+   * @param[out] pitch @f$L@f$ samples of pitch (optional).
+   * @param[out] num_samples Number of generated samples, @f$L@f$. This is less
+   *             than @p length only if the input source is exhausted or a
+   *             negative pitch value is reached. No sample is generated after
+   *             that.
+   * @return True if at least one sample is generated, false otherwise.
+   */
+  bool Get(int length, double* excitation, double* pulse, double* noise,
+           double* pitch, int* num_samples);
+
  private:
   InputSourceInterpolationWithMagicNumber* input_source_;
   RandomGenerationInterface* random_generation_;
 
   bool is_valid_;
 
+  // True after the end of input or a negative pitch value is reached.
+  bool is_end_of_stream_;
+
   // Phase value ranging from 0.0 to 1.0.
   double phase_;
 
+  // Noise drawn in advance.
+  std::vector<double> noise_buffer_;
+  int noise_index_;
+
+  // Buffers used in block generation.
+  std::vector<double> input_buffer_;
+  std::vector<double> pitch_buffer_;
+  std::vector<double> noise_output_buffer_;
+
   DISALLOW_COPY_AND_ASSIGN(ExcitationGeneration);
 };
 
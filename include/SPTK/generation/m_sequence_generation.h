@@ -45,6 +45,9 @@
 #ifndef SPTK_GENERATION_M_SEQUENCE_GENERATION_H_
 #define SPTK_GENERATION_M_SEQUENCE_GENERATION_H_
 
+#include <cstdint>  // std::uint64_t
+#include <vector>   // std::vector
+
 #include "SPTK/generation/random_generation_interface.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -52,6 +55,11 @@ namespace sptk {
 
 /**
  * Generate random number based on m-sequence.
+ *
+ * The m-sequence is given by the recurrence @f$a_{n+31} = a_n \oplus
+ * a_{n+28}@f$ (@f$X^{31} + X^{28} + 1@f$). Since the next 64 chips are linear
+ * in the current 31 chips, they are computed at once by XORing four
+ * precomputed responses, each of which corresponds to 8 of the 31 chips.
  */
 class MSequenceGeneration : public RandomGenerationInterface {
  public:
@@ -76,8 +84,27 @@ class MSequenceGeneration : public RandomGenerationInterface {
    */
   virtual bool Get(double* output);
 
+  /**
+   * Get random numbers at once.
+   *
+   * @param[in] length Number of random numbers.
+   * @param[out] outputs Random numbers.
+   * @return True on success, false on failure.
+   */
+  virtual bool Generate(int length, double* outputs);
+
  private:
-  int x_;
+  std::uint64_t Proceed();
+
+  // Precomputed responses of next 64 chips.
+  std::vector<std::uint64_t> table_;
+
+  // Next 31 chips following the buffered chips.
+  std::uint64_t state_;
+
+  // Chips generated but not output yet.
+  std::uint64_t buffer_;
+  int num_buffered_chip_;
 
   DISALLOW_COPY_AND_ASSIGN(MSequenceGeneration);
 };
@@ -123,6 +123,9 @@ class NonrecursiveMaximumLikelihoodParameterGeneration {
   }
 
   /**
+   * Since the static dimensions are independent of each other, all of them are
+   * solved at once by sharing the band structure of the normal equation.
+   *
    * @param[in] mean_vectors Mean vector sequence. The shape is @f$[T, DM]$@f$.
    * @param[in] variance_vectors Variance vector sequence.
    *            The shape is @f$[T, DM]$@f$.
@@ -134,6 +137,9 @@ class NonrecursiveMaximumLikelihoodParameterGeneration {
            std::vector<std::vector<double> >* smoothed_static_parameters) const;
 
   /**
+   * If all covariance matrices are diagonal, the static dimensions are solved
+   * simultaneously as in the above function.
+   *
    * @param[in] mean_vectors Mean vector sequence. The shape is @f$[T, DM]$@f$.
    * @param[in] covariance_matrices Covariance matrix sequence.
    *            The shape is @f$[T, DM, DM]$@f$.
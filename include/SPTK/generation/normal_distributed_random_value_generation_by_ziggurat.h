@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_GENERATION_NORMAL_DISTRIBUTED_RANDOM_VALUE_GENERATION_BY_ZIGGURAT_H_
+#define SPTK_GENERATION_NORMAL_DISTRIBUTED_RANDOM_VALUE_GENERATION_BY_ZIGGURAT_H_
+
+#include <cstdint>  // std::uint64_t
+#include <vector>   // std::vector
+
+#include "SPTK/generation/random_generation_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Generate random number based on normal distribution using counter-based
+ * uniform random number generator and ziggurat method.
+ *
+ * The @f$n@f$-th output is computed from only the random seed and @f$n@f$.
+ * The uniform random number for the @f$n@f$-th output is the @f$n@f$-th value
+ * of SplitMix64 sequence, which can be computed directly from @f$n@f$, and it
+ * is transformed into a normal random number by the ziggurat method with 128
+ * layers. Therefore the output sequence does not depend on how the values are
+ * fetched, e.g., one by one, block by block, or by several threads that set
+ * their own positions.
+ *
+ * [1] G. L. Steele Jr., D. Lea, and C. H. Flood, &quot;Fast splittable
+ *     pseudorandom number generators,&quot; Proc. of OOPSLA, pp. 453-472,
+ *     2014.
+ *
+ * [2] J. A. Doornik, &quot;An improved ziggurat method to generate normal
+ *     random samples,&quot; University of Oxford, 2005.
+ */
+class NormalDistributedRandomValueGenerationByZiggurat
+    : public RandomGenerationInterface {
+ public:
+  /**
+   * @param[in] seed Random seed.
+   */
+  explicit NormalDistributedRandomValueGenerationByZiggurat(int seed);
+
+  virtual ~NormalDistributedRandomValueGenerationByZiggurat() {
+  }
+
+  /**
+   * Reset internal state.
+   */
+  virtual void Reset();
+
+  /**
+   * Get random number.
+   *
+   * @param[out] output Random number.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(double* output);
+
+  /**
+   * Get random numbers at once.
+   *
+   * @param[in] length Number of random numbers.
+   * @param[out] outputs Random numbers.
+   * @return True on success, false on failure.
+   */
+  virtual bool Generate(int length, double* outputs);
+
+  /**
+   * @return Random seed.
+   */
+  int GetSeed() const {
+    return seed_;
+  }
+
+  /**
+   * @return Index of next output.
+   */
+  std::uint64_t GetPosition() const {
+    return position_;
+  }
+
+  /**
+   * @param[in] position Index of next output.
+   */
+  void SetPosition(std::uint64_t position) {
+    position_ = position;
+  }
+
+ private:
+  double Calculate(std::uint64_t position) const;
+
+  const int seed_;
+  const std::uint64_t key_;
+
+  std::uint64_t position_;
+
+  std::vector<double> x_;
+  std::vector<double> f_;
+  std::vector<double> r_;
+
+  DISALLOW_COPY_AND_ASSIGN(NormalDistributedRandomValueGenerationByZiggurat);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_GENERATION_NORMAL_DISTRIBUTED_RANDOM_VALUE_GENERATION_BY_ZIGGURAT_H_
@@ -45,6 +45,8 @@
 #ifndef SPTK_GENERATION_RANDOM_GENERATION_INTERFACE_H_
 #define SPTK_GENERATION_RANDOM_GENERATION_INTERFACE_H_
 
+#include <cstddef>  // NULL
+
 namespace sptk {
 
 /**
@@ -67,6 +69,25 @@ class RandomGenerationInterface {
    * @return True on success, false on failure.
    */
   virtual bool Get(double* output) = 0;
+
+  /**
+   * Get random numbers at once.
+   *
+   * @param[in] length Number of random numbers.
+   * @param[out] outputs Random numbers.
+   * @return True on success, false on failure.
+   */
+  virtual bool Generate(int length, double* outputs) {
+    if (length < 0 || (0 < length && NULL == outputs)) {
+      return false;
+    }
+    for (int i(0); i < length; ++i) {
+      if (!Get(outputs + i)) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 }  // namespace sptk
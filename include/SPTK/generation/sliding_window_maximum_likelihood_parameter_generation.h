@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_GENERATION_SLIDING_WINDOW_MAXIMUM_LIKELIHOOD_PARAMETER_GENERATION_H_
+#define SPTK_GENERATION_SLIDING_WINDOW_MAXIMUM_LIKELIHOOD_PARAMETER_GENERATION_H_
+
+#include <vector>  // std::vector
+
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Estimate the maximum likelihood parameters from the means and the diagonal
+ * covariances of Gaussian distributions.
+ *
+ * The input is the sequence of the mean and the diagnoal covariance of
+ * @f$M@f$-th order static and @f$DM@f$-th order dynamic feature components:
+ * @f[
+ *   \begin{array}{ccccc}
+ *     \boldsymbol{\mu}_1, & \boldsymbol{\varSigma}_1, & \ldots, &
+ *     \boldsymbol{\mu}_T, & \boldsymbol{\varSigma}_T,
+ *   \end{array}
+ * @f]
+ * and the output is the sequence of the @f$M@f$-th order smoothed static
+ * feature components:
+ * @f[
+ *   \begin{array}{cccc}
+ *     \boldsymbol{c}_1, & \boldsymbol{c}_2, & \ldots, &
+ *     \boldsymbol{c}_T.
+ *   \end{array}
+ * @f]
+ *
+ * The @f$t@f$-th output is the @f$t@f$-th frame of the solution obtained from
+ * the truncated sequence
+ * @f$\boldsymbol{\mu}_1,\ldots,\boldsymbol{\mu}_{t+L}@f$, where @f$L@f$ is the
+ * number of future frames. Thus the output is delayed by only @f$L@f$ frames.
+ * The Cholesky factor of the banded normal equation is updated incrementally:
+ * the rows that are no longer affected by future inputs are factorized only
+ * once, and the last few rows and the backward substitution over @f$L@f$
+ * frames are recomputed per frame. The approximation error against the
+ * solution from the entire sequence decreases as @f$L@f$ increases, and the
+ * output is identical to that of
+ * NonrecursiveMaximumLikelihoodParameterGeneration if @f$T \le L + 1@f$.
+ */
+class SlidingWindowMaximumLikelihoodParameterGeneration {
+ public:
+  /**
+   * @param[in] num_order Order of coefficients, @f$M@f$.
+   * @param[in] num_future_frame Number of future frames, @f$L@f$.
+   * @param[in] window_coefficients Window coefficients.
+   *            e.g.) { {-0.5, 0.0, 0.5}, {1.0, -2.0, 1.0} }
+   * @param[in] input_source Static and dynamic components sequence.
+   */
+  SlidingWindowMaximumLikelihoodParameterGeneration(
+      int num_order, int num_future_frame,
+      const std::vector<std::vector<double> >& window_coefficients,
+      InputSourceInterface* input_source);
+
+  virtual ~SlidingWindowMaximumLikelihoodParameterGeneration() {
+  }
+
+  /**
+   * @return Order of coefficients.
+   */
+  int GetNumOrder() const {
+    return num_order_;
+  }
+
+  /**
+   * @return Number of future frames.
+   */
+  int GetNumFutureFrame() const {
+    return num_future_frame_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] smoothed_static_parameters Smoothed static parameters.
+   * @return True on success, false on failure.
+   */
+  bool Get(std::vector<double>* smoothed_static_parameters);
+
+ private:
+  struct Buffer {
+    std::vector<double> static_and_dynamic_parameters;
+    std::vector<double> precision;
+    std::vector<double> weighted_mean;
+    std::vector<double> wum;
+    std::vector<double> wuw;
+    std::vector<double> g;
+    std::vector<double> l;
+    std::vector<double> c;
+  };
+
+  bool Push();
+  void Factorize(int begin, int end);
+  void Solve(int begin, int end);
+
+  const int num_order_;
+  const int num_future_frame_;
+  std::vector<std::vector<double> > window_coefficients_;
+  InputSourceInterface* input_source_;
+
+  bool is_valid_;
+
+  int max_half_window_width_;
+  int band_width_;
+  int ring_size_;
+
+  int num_input_frame_;
+  int num_factorized_frame_;
+  int num_output_frame_;
+  bool is_end_of_input_;
+
+  Buffer buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(SlidingWindowMaximumLikelihoodParameterGeneration);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_GENERATION_SLIDING_WINDOW_MAXIMUM_LIKELIHOOD_PARAMETER_GENERATION_H_
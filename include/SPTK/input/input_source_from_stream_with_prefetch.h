@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_INPUT_INPUT_SOURCE_FROM_STREAM_WITH_PREFETCH_H_
+#define SPTK_INPUT_INPUT_SOURCE_FROM_STREAM_WITH_PREFETCH_H_
+
+#include <condition_variable>  // std::condition_variable
+#include <istream>             // std::istream
+#include <memory>              // std::shared_ptr
+#include <mutex>               // std::mutex
+#include <ostream>             // std::ostream
+#include <thread>              // std::thread
+#include <vector>              // std::vector
+
+#include "SPTK/input/input_source_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Use stream as input source with reading ahead.
+ *
+ * A background thread fills a ring of large buffers from the stream in chunks
+ * of 64 KiB while the caller consumes the data read so far, so that waiting for
+ * reads overlaps with computation. The results are the same as those of
+ * InputSourceFromStream. The stream must not be used by others until this
+ * object is destroyed, and it is untied from its output stream in the
+ * meantime. If the background thread is still waiting for input when this
+ * object is destroyed, e.g., on an idle pipe, the thread is detached and the
+ * stream stays in use until the process exits.
+ */
+class InputSourceFromStreamWithPrefetch : public InputSourceInterface {
+ public:
+  /**
+   * @param[in] zero_padding If true, pad with zero in the last reading.
+   * @param[in] read_size Read size.
+   * @param[in] input_stream Input stream.
+   */
+  InputSourceFromStreamWithPrefetch(bool zero_padding, int read_size,
+                                    std::istream* input_stream);
+
+  /**
+   * @param[in] zero_padding If true, pad with zero in the last reading.
+   * @param[in] read_size Read size.
+   * @param[in] buffer_size Size of each buffer in bytes.
+   * @param[in] num_buffer Number of buffers.
+   * @param[in] input_stream Input stream.
+   */
+  InputSourceFromStreamWithPrefetch(bool zero_padding, int read_size,
+                                    int buffer_size, int num_buffer,
+                                    std::istream* input_stream);
+
+  virtual ~InputSourceFromStreamWithPrefetch();
+
+  /**
+   * @return Size of data.
+   */
+  virtual int GetSize() const {
+    return read_size_;
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  virtual bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @param[out] buffer Read data.
+   * @return True on success, false on failure.
+   */
+  virtual bool Get(std::vector<double>* buffer);
+
+ private:
+  // Data shared with the background thread, which may outlive this object.
+  struct State {
+    State(int buffer_size, int num_buffer)
+        : buffers(num_buffer, std::vector<char>(buffer_size)),
+          filled_sizes(num_buffer, 0),
+          is_filled(num_buffer, false),
+          num_used_buffer(0),
+          is_end_of_stream(false),
+          is_stopping(false),
+          is_finished(false) {
+    }
+
+    // Buffers, their filled sizes, and whether they are completely filled.
+    std::vector<std::vector<char> > buffers;
+    std::vector<int> filled_sizes;
+    std::vector<bool> is_filled;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    int num_used_buffer;
+    bool is_end_of_stream;
+    bool is_stopping;
+    bool is_finished;
+  };
+
+  static void Prefetch(std::shared_ptr<State> state,
+                       std::istream* input_stream);
+
+  const bool zero_padding_;
+  const int read_size_;
+  const int buffer_size_;
+  const int num_buffer_;
+  std::istream* input_stream_;
+  std::ostream* tied_stream_;
+
+  bool is_valid_;
+
+  std::shared_ptr<State> state_;
+
+  // Used only by the caller.
+  int current_buffer_index_;
+  int current_position_;
+
+  std::thread thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSourceFromStreamWithPrefetch);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_INPUT_INPUT_SOURCE_FROM_STREAM_WITH_PREFETCH_H_
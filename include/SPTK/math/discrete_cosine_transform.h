@@ -45,6 +45,7 @@
 #ifndef SPTK_MATH_DISCRETE_COSINE_TRANSFORM_H_
 #define SPTK_MATH_DISCRETE_COSINE_TRANSFORM_H_
 
+#include <memory>  // std::shared_ptr
 #include <vector>  // std::vector
 
 #include "SPTK/math/fourier_transform.h"
@@ -153,8 +154,7 @@ class DiscreteCosineTransform {
 
   const FourierTransform fourier_transform_;
 
-  std::vector<double> cosine_table_;
-  std::vector<double> sine_table_;
+  std::shared_ptr<const std::vector<double> > table_;
 
   DISALLOW_COPY_AND_ASSIGN(DiscreteCosineTransform);
 };
@@ -47,6 +47,7 @@
 
 #include <vector>  // std::vector
 
+#include "SPTK/utils/simd_kernels.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -106,9 +107,27 @@ class DistanceCalculation {
   bool Run(const std::vector<double>& vector1,
            const std::vector<double>& vector2, double* distance) const;
 
+  /**
+   * Calculate distances between one vector and a range of vectors at once.
+   * The results are the same as those of the above.
+   *
+   * @param[in] vector1 @f$M@f$-th order vector.
+   * @param[in] vector_sequence2 @f$M@f$-th order vectors.
+   * @param[in] begin Index of the first vector in @p vector_sequence2.
+   * @param[in] end Index of the last vector in @p vector_sequence2 plus one.
+   * @param[out] distances Distances between @p vector1 and the vectors.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<double>& vector1,
+           const std::vector<std::vector<double> >& vector_sequence2,
+           int begin, int end, double* distances) const;
+
  private:
+  bool Calculate(const double* x, const double* y, double* distance) const;
+
   const int num_order_;
   const DistanceMetrics distance_metric_;
+  const SimdKernels& simd_kernels_;
 
   bool is_valid_;
 
@@ -50,6 +50,7 @@
 
 #include "SPTK/math/distance_calculation.h"
 #include "SPTK/utils/sptk_utils.h"
+#include "SPTK/utils/thread_pool.h"
 
 namespace sptk {
 
@@ -172,6 +173,27 @@ class DynamicTimeWarping {
            std::vector<std::pair<int, int> >* viterbi_path,
            double* total_score) const;
 
+  /**
+   * Run dynamic time warping on a thread pool. The cost matrix is split into
+   * tiles, and the tiles on each anti-diagonal are processed in parallel
+   * after calculating their local distances at once. The results are the same
+   * as those of the above.
+   *
+   * @param[in] query_vector_sequence @f$M@f$-th order query vectors.
+   *            The shape is @f$[T_x, M+1]@f$.
+   * @param[in] reference_vector_sequence @f$M@f$-th order reference vectors.
+   *            The shape is @f$[T_y, M+1]@f$.
+   * @param[out] viterbi_path Best sequence of the pairs of index.
+   * @param[out] total_score Score of dynamic time warping.
+   * @param[in,out] thread_pool Thread pool. If NULL or it has one thread, run
+   *                on the caller thread.
+   * @return True on success, false on failure.
+   */
+  bool Run(const std::vector<std::vector<double> >& query_vector_sequence,
+           const std::vector<std::vector<double> >& reference_vector_sequence,
+           std::vector<std::pair<int, int> >* viterbi_path,
+           double* total_score, ThreadPool* thread_pool) const;
+
  private:
   const int num_order_;
   const LocalPathConstraints local_path_constraint_;
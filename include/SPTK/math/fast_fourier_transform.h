@@ -45,8 +45,11 @@
 #ifndef SPTK_MATH_FAST_FOURIER_TRANSFORM_H_
 #define SPTK_MATH_FAST_FOURIER_TRANSFORM_H_
 
+#include <memory>  // std::shared_ptr
 #include <vector>  // std::vector
 
+#include "SPTK/math/fast_fourier_transform_planner.h"
+#include "SPTK/utils/simd_kernels.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -83,6 +86,14 @@ class FastFourierTransform {
    */
   FastFourierTransform(int num_order, int fft_length);
 
+  /**
+   * @param[in] num_order Order of input, @f$M@f$.
+   * @param[in] fft_length FFT length, @f$L@f$.
+   * @param[in] plan Variant of FFT.
+   */
+  FastFourierTransform(int num_order, int fft_length,
+                       const FastFourierTransformPlanner::ComplexPlan& plan);
+
   virtual ~FastFourierTransform() {
   }
 
@@ -132,9 +143,13 @@ class FastFourierTransform {
   const int fft_length_;
   const int half_fft_length_;
 
+  const SimdKernels& simd_kernels_;
+  const int radix_;
+
   bool is_valid_;
 
-  std::vector<double> sine_table_;
+  // Twiddle factors laid out contiguously for each butterfly stage.
+  std::shared_ptr<const std::vector<double> > twiddle_table_;
 
   DISALLOW_COPY_AND_ASSIGN(FastFourierTransform);
 };
@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_MATH_FAST_FOURIER_TRANSFORM_PLANNER_H_
+#define SPTK_MATH_FAST_FOURIER_TRANSFORM_PLANNER_H_
+
+#include <string>  // std::string
+
+#include "SPTK/utils/simd_kernels.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Choose the fastest FFT variant for each FFT length.
+ *
+ * The planner is controlled by two environment variables. If
+ * @c SPTK_FFT_WISDOM names a file, plans are loaded from it at the first use
+ * and every newly measured plan is merged into it. Unknown FFT lengths are
+ * planned by timing all variants on the host only if @c SPTK_FFT_PLANNING is
+ * @c measure. Since the variants of real-valued FFT may differ in rounding,
+ * the results then depend on the timing. Otherwise, no timing is done and
+ * plans not found in the wisdom file fall back to the default variant, so
+ * that the results are deterministic.
+ *
+ * The wisdom file is a text file with one plan per line:
+ * @code
+ *   complex <fft_length> <instruction_set> <radix>
+ *   real <fft_length> <packing>
+ * @endcode
+ */
+class FastFourierTransformPlanner {
+ public:
+  /**
+   * Packing of real-valued input into complex-valued FFT.
+   */
+  enum RealPackings {
+    kHalfLengthComplex = 0,
+    kFullLengthComplex,
+    kNumRealPackings
+  };
+
+  /**
+   * Variant of complex-valued FFT.
+   */
+  struct ComplexPlan {
+    ComplexPlan()
+        : instruction_set(SimdKernels::Get().instruction_set), radix(2) {
+    }
+
+    //! Instruction set of butterfly kernel.
+    SimdKernels::InstructionSets instruction_set;
+
+    //! Radix of butterfly, 2 or 4.
+    int radix;
+  };
+
+  /**
+   * Variant of real-valued FFT.
+   */
+  struct RealPlan {
+    RealPlan() : packing(kHalfLengthComplex) {
+    }
+
+    //! Packing strategy.
+    RealPackings packing;
+  };
+
+  /**
+   * @param[in] fft_length FFT length.
+   * @return Plan of complex-valued FFT.
+   */
+  static ComplexPlan GetComplexPlan(int fft_length);
+
+  /**
+   * @param[in] fft_length FFT length.
+   * @return Plan of real-valued FFT.
+   */
+  static RealPlan GetRealPlan(int fft_length);
+
+  /**
+   * Read plans from wisdom file. Existing plans are overwritten.
+   *
+   * @param[in] file_name Wisdom file.
+   * @return True on success, false on failure.
+   */
+  static bool LoadWisdom(const std::string& file_name);
+
+  /**
+   * Write all plans to wisdom file. Plans in the file for other FFT lengths
+   * are kept.
+   *
+   * @param[in] file_name Wisdom file.
+   * @return True on success, false on failure.
+   */
+  static bool SaveWisdom(const std::string& file_name);
+
+ private:
+  static ComplexPlan GetComplexPlanFromWisdom(int fft_length);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_MATH_FAST_FOURIER_TRANSFORM_PLANNER_H_
@@ -142,6 +142,13 @@ namespace sptk {
  * constraint between static and dynamic components is obtained by the maximum
  * likelihood parameter generation algorithm.
  *
+ * The terms that do not depend on the input, i.e., the precision matrices
+ * @f$\boldsymbol{\varSigma}_m^{(XX)^{-1}}@f$, the regression matrices, and
+ * @f$\boldsymbol{D}_m^{(Y)}@f$, are precomputed in the constructor. The
+ * posterior probabilities and the conditional means are computed for a block
+ * of frames at once so that the parameters of each mixture component are
+ * reused while they stay in cache.
+ *
  * [1] T. Toda, A. W. Black, and K. Tokuda, &quot;Voice conversion based on
  *     maximum-likelihood estimation of spectral parameter trajectory,&quot;
  *     IEEE Transactions on Audio, Speech, and Language Processing, vol. 15,
@@ -219,8 +226,9 @@ class GaussianMixtureModelBasedConversion {
 
   bool is_valid_;
 
+  std::vector<double> log_constants_;
   std::vector<std::vector<double> > source_mean_vectors_;
-  std::vector<SymmetricMatrix> source_covariance_matrices_;
+  std::vector<Matrix> source_precision_matrices_;
   std::vector<Matrix> e_slope_;
   std::vector<std::vector<double> > e_bias_;
   std::vector<SymmetricMatrix> d_;
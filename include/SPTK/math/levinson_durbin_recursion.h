@@ -105,6 +105,10 @@ namespace sptk {
  * @f[
  *   K = \sqrt{E^{(M)}}.
  * @f]
+ *
+ * Several frames can be solved at once. The recursion of four frames is run in
+ * SIMD lanes, where the computation of each frame is the same as that of the
+ * single frame version.
  */
 class LevinsonDurbinRecursion {
  public:
@@ -121,6 +125,8 @@ class LevinsonDurbinRecursion {
 
    private:
     std::vector<double> c_;
+    std::vector<double> r_;
+    std::vector<double> a_;
 
     friend class LevinsonDurbinRecursion;
     DISALLOW_COPY_AND_ASSIGN(Buffer);
@@ -169,6 +175,20 @@ class LevinsonDurbinRecursion {
   bool Run(std::vector<double>* input_and_output, bool* is_stable,
            LevinsonDurbinRecursion::Buffer* buffer) const;
 
+  /**
+   * @param[in] autocorrelations @f$M@f$-th order autocorrelation of each frame.
+   * @param[out] linear_predictive_coefficients @f$M@f$-th order LPC
+   *             coefficients of each frame.
+   * @param[out] is_stable True if the obtained coefficients of each frame are
+   *             stable.
+   * @param[out] buffer Buffer.
+   * @return True on success, false if any frame fails.
+   */
+  bool Run(const std::vector<std::vector<double> >& autocorrelations,
+           std::vector<std::vector<double> >* linear_predictive_coefficients,
+           std::vector<bool>* is_stable,
+           LevinsonDurbinRecursion::Buffer* buffer) const;
+
  private:
   const int num_order_;
 
@@ -45,9 +45,11 @@
 #ifndef SPTK_MATH_REAL_VALUED_FAST_FOURIER_TRANSFORM_H_
 #define SPTK_MATH_REAL_VALUED_FAST_FOURIER_TRANSFORM_H_
 
+#include <memory>  // std::shared_ptr
 #include <vector>  // std::vector
 
 #include "SPTK/math/fast_fourier_transform.h"
+#include "SPTK/math/fast_fourier_transform_planner.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace sptk {
@@ -102,6 +104,15 @@ class RealValuedFastFourierTransform {
    */
   RealValuedFastFourierTransform(int num_order, int fft_length);
 
+  /**
+   * @param[in] num_order Order of input, @f$M@f$.
+   * @param[in] fft_length FFT length, @f$L@f$.
+   * @param[in] plan Variant of FFT.
+   */
+  RealValuedFastFourierTransform(
+      int num_order, int fft_length,
+      const FastFourierTransformPlanner::RealPlan& plan);
+
   virtual ~RealValuedFastFourierTransform() {
   }
 
@@ -151,12 +162,13 @@ class RealValuedFastFourierTransform {
   const int num_order_;
   const int fft_length_;
   const int half_fft_length_;
+  const FastFourierTransformPlanner::RealPackings packing_;
 
   const FastFourierTransform fast_fourier_transform_;
 
   bool is_valid_;
 
-  std::vector<double> sine_table_;
+  std::shared_ptr<const std::vector<double> > sine_table_;
 
   DISALLOW_COPY_AND_ASSIGN(RealValuedFastFourierTransform);
 };
@@ -0,0 +1,304 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_UTILS_FEATURE_CONTAINER_H_
+#define SPTK_UTILS_FEATURE_CONTAINER_H_
+
+#include <cstdint>  // int64_t
+#include <istream>  // std::istream
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Shape and timing information stored in a feature container.
+ */
+struct FeatureContainerHeader {
+  FeatureContainerHeader()
+      : data_type("d"), vector_length(1), frame_period(0.0),
+        sampling_rate(0.0) {
+  }
+
+  //! Data type symbol, e.g., d for double.
+  std::string data_type;
+
+  //! Length of vector in each frame.
+  int vector_length;
+
+  //! Frame period in points (0 if unknown).
+  double frame_period;
+
+  //! Sampling rate in kHz (0 if unknown).
+  double sampling_rate;
+};
+
+/**
+ * Range of frames which forms one chunk, e.g., one utterance.
+ */
+struct FeatureContainerChunk {
+  //! Index of the first frame.
+  int64_t first_frame;
+
+  //! Number of frames in the chunk.
+  int64_t num_frame;
+};
+
+/**
+ * Write frames into a feature container.
+ *
+ * A feature container is a raw SPTK stream with a 64-byte header in front and
+ * a chunk index behind:
+ * @code
+ *   "SPTKFEAT", version, data type, vector length, frame period,
+ *   sampling rate, (reserved)                                   64 bytes
+ *   frames                                                      raw data
+ *   (first frame, number of frames) x number of chunks          16 bytes each
+ *   number of frames, number of chunks, "SPTKINDX"              24 bytes
+ * @endcode
+ * All numbers are stored in the native byte order. Since the index is placed
+ * after the frames, the container can be written to a pipe.
+ */
+class FeatureContainerWriter {
+ public:
+  /**
+   * @param[in] header Header information.
+   * @param[in] output_stream Output stream.
+   */
+  FeatureContainerWriter(const FeatureContainerHeader& header,
+                         std::ostream* output_stream);
+
+  virtual ~FeatureContainerWriter() {
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @return Size of one frame in bytes.
+   */
+  int GetFrameSize() const {
+    return frame_size_;
+  }
+
+  /**
+   * @return Number of frames written so far.
+   */
+  int64_t GetNumFrame() const {
+    return num_frame_;
+  }
+
+  /**
+   * Start a new chunk. Frames written before the first call of this function
+   * form one chunk.
+   *
+   * @return True on success, false on failure.
+   */
+  bool StartChunk();
+
+  /**
+   * @param[in] frames Frames in the data type given by header.
+   * @param[in] num_frame Number of frames.
+   * @return True on success, false on failure.
+   */
+  bool Write(const char* frames, int num_frame);
+
+  /**
+   * Write the chunk index. No frame can be written after this.
+   *
+   * @return True on success, false on failure.
+   */
+  bool Close();
+
+ private:
+  bool WriteHeader();
+
+  const FeatureContainerHeader header_;
+  std::ostream* output_stream_;
+  int frame_size_;
+
+  bool is_valid_;
+  bool is_header_written_;
+  bool is_closed_;
+  int64_t num_frame_;
+  std::vector<FeatureContainerChunk> chunks_;
+
+  DISALLOW_COPY_AND_ASSIGN(FeatureContainerWriter);
+};
+
+/**
+ * Read frames from a feature container via memory mapping.
+ *
+ * The frames are accessed without copying, so random access to any frame or
+ * chunk costs nothing but page faults.
+ */
+class FeatureContainerReader {
+ public:
+  /**
+   * @param[in] file_name Name of container file.
+   */
+  explicit FeatureContainerReader(const std::string& file_name);
+
+  virtual ~FeatureContainerReader();
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @return Header information.
+   */
+  const FeatureContainerHeader& GetHeader() const {
+    return header_;
+  }
+
+  /**
+   * @return Number of frames.
+   */
+  int64_t GetNumFrame() const {
+    return num_frame_;
+  }
+
+  /**
+   * @return Number of chunks.
+   */
+  int GetNumChunk() const {
+    return static_cast<int>(chunks_.size());
+  }
+
+  /**
+   * @return Size of one frame in bytes.
+   */
+  int GetFrameSize() const {
+    return frame_size_;
+  }
+
+  /**
+   * @param[in] chunk_index Chunk index.
+   * @param[out] chunk Frame range of the chunk.
+   * @return True on success, false on failure.
+   */
+  bool GetChunk(int chunk_index, FeatureContainerChunk* chunk) const;
+
+  /**
+   * @param[in] frame_index Frame index.
+   * @return Pointer to the frame in the mapped memory, NULL on failure.
+   */
+  const char* GetFrame(int64_t frame_index) const;
+
+  /**
+   * @param[in] frame_index Frame index.
+   * @param[out] frame Frame converted to double.
+   * @return True on success, false on failure.
+   */
+  bool GetFrame(int64_t frame_index, std::vector<double>* frame) const;
+
+ private:
+  FeatureContainerHeader header_;
+  int frame_size_;
+  int64_t num_frame_;
+  std::vector<FeatureContainerChunk> chunks_;
+
+  void* mapped_memory_;
+  int64_t mapped_size_;
+  const char* frames_;
+
+  bool is_valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(FeatureContainerReader);
+};
+
+/**
+ * Check whether the file is a feature container.
+ *
+ * @param[in] file_name Name of file.
+ * @return True if the file starts with the container header.
+ */
+bool IsFeatureContainer(const std::string& file_name);
+
+/**
+ * Let an input stream read a feature container or a stream encoded by
+ * LosslessFeatureEncoding as a raw stream.
+ *
+ * If the stream starts with either header, its stream buffer is replaced. For
+ * a container, the header and the chunk index are skipped. A regular file
+ * stays seekable within the frames. A pipe is read ahead by 1 MiB to find the
+ * chunk index at its end, so a container with more than 65534 chunks must be
+ * given as a file; otherwise the stream ends as broken after passing a part of
+ * the index. An encoded stream is decoded chunk by chunk and cannot be sought.
+ * Other streams are read as they are. The stream is checked only once, at the
+ * first call.
+ *
+ * @param[in,out] input_stream Input stream.
+ * @return Size of one element of the frames in bytes, or 0 if the stream is
+ *         neither a feature container nor an encoded stream.
+ */
+int PrepareFeatureInputStream(std::istream* input_stream);
+
+/**
+ * Check whether the input prepared by PrepareFeatureInputStream is broken.
+ *
+ * A broken container or encoded stream ends as the end of stream does. This
+ * tells the two apart.
+ *
+ * @param[in] input_stream Input stream.
+ * @param[out] error_message Description of the error if broken.
+ * @return True if the stream has ended on a broken input.
+ */
+bool IsFeatureInputBroken(std::istream* input_stream,
+                          std::string* error_message);
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_FEATURE_CONTAINER_H_
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_UTILS_PIPELINE_H_
+#define SPTK_UTILS_PIPELINE_H_
+
+#include <istream>  // std::istream
+#include <memory>   // std::unique_ptr
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+#include "SPTK/command/command_interface.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Run a pipeline of SPTK commands in process.
+ *
+ * A pipeline is written as in shell, e.g.,
+ * @code
+ *   x2x +sd | frame -l 400 -p 80 | window -l 400 -L 512 | mgcep -l 512 -q 4
+ * @endcode
+ * The commands @c x2x, @c frame, @c window, and @c mgcep are supported with
+ * all their options. They are run by the same code as the commands
+ * themselves, see sptk::CommandInterface, so that the output is identical.
+ * Input files, @c -h, the other commands, and shell syntax other than pipes,
+ * e.g., quotes and redirections, are not supported.
+ *
+ * The commands run concurrently on their own threads and pass data through
+ * bounded buffers in memory, so that the output of the last command is
+ * written while the input is still being read. Warnings of the commands are
+ * written to the standard error of the process.
+ *
+ * The commands are created once by the constructor and Run() can be called
+ * from several threads at the same time.
+ */
+class Pipeline {
+ public:
+  /**
+   * @param[in] command_line Pipeline written as in shell.
+   */
+  explicit Pipeline(const std::string& command_line);
+
+  virtual ~Pipeline() {
+  }
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return is_valid_;
+  }
+
+  /**
+   * @return True if all commands and options are supported. If not, the
+   *         pipeline needs to be run by the commands themselves.
+   */
+  bool IsSupported() const {
+    return is_supported_;
+  }
+
+  /**
+   * @return Reason why this object is invalid or not supported.
+   */
+  const std::string& GetErrorMessage() const {
+    return error_message_;
+  }
+
+  /**
+   * @param[in] input_stream Input of the first command.
+   * @param[out] output_stream Output of the last command.
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::istream* input_stream, std::ostream* output_stream,
+           std::string* error_message) const;
+
+ private:
+  bool is_valid_;
+  bool is_supported_;
+  std::string error_message_;
+
+  std::vector<std::string> command_names_;
+  std::vector<std::unique_ptr<CommandInterface> > commands_;
+
+  DISALLOW_COPY_AND_ASSIGN(Pipeline);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_PIPELINE_H_
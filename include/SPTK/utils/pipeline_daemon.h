@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_UTILS_PIPELINE_DAEMON_H_
+#define SPTK_UTILS_PIPELINE_DAEMON_H_
+
+#include <sys/types.h>  // off_t
+
+#include <atomic>  // std::atomic
+#include <map>     // std::map
+#include <memory>  // std::shared_ptr
+#include <mutex>   // std::mutex
+#include <set>     // std::set
+#include <string>  // std::string
+
+#include "SPTK/utils/pipeline.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Serve pipelines of SPTK commands over a Unix domain socket.
+ *
+ * Worker threads wait for requests on the socket and run them with
+ * sptk::Pipeline. Each worker serves one request at a time, and a client which
+ * neither sends nor receives data for a minute is disconnected. Pipelines are created once per command line and kept for
+ * later requests so that a request pays neither process startup nor table
+ * initialization. The input of a request is streamed through the socket or
+ * passed as a file descriptor of shared memory sealed against shrinking, and
+ * the output is streamed back through the socket while the pipeline runs.
+ */
+class PipelineDaemon {
+ public:
+  /**
+   * Status of request.
+   */
+  enum Status {
+    kSuccess = 0,
+    kUnsupported,
+    kFailure,
+    kNumStatuses
+  };
+
+  /**
+   * @param[in] socket_path Path of socket.
+   * @param[in] num_worker Number of worker threads.
+   */
+  PipelineDaemon(const std::string& socket_path, int num_worker);
+
+  virtual ~PipelineDaemon() {
+  }
+
+  /**
+   * Serve requests until SIGINT or SIGTERM is received. Requests being
+   * served then are cut off.
+   *
+   * @param[out] error_message Error message on failure.
+   * @return True on success, false on failure.
+   */
+  bool Run(std::string* error_message);
+
+  /**
+   * @return Socket path given by @c SPTK_DAEMON_SOCKET, or a path in /tmp
+   *         unique to the user.
+   */
+  static std::string GetDefaultSocketPath();
+
+  /**
+   * @return Number of hardware threads, but at least 4, so that a slow client
+   *         does not keep the others waiting.
+   */
+  static int GetDefaultNumWorker();
+
+  /**
+   * Send a request to a daemon and write its output.
+   *
+   * If kUnsupported is returned, nothing has been read from @p input_fd.
+   *
+   * @param[in] socket_path Path of socket.
+   * @param[in] command_line Pipeline written as in shell.
+   * @param[in] input_fd File descriptor of input. Unless shared memory is
+   *            used, it is read until its end.
+   * @param[in] input_size Size of input in bytes. Used only with shared
+   *            memory.
+   * @param[in] is_shared_memory_used If true, @p input_fd is passed to the
+   *            daemon instead of its contents. It must be a memory file
+   *            sealed with F_SEAL_SHRINK.
+   * @param[in] output_fd File descriptor to write output.
+   * @param[out] message Error message from the daemon.
+   * @return Status. kUnsupported is also returned if no daemon is running.
+   */
+  static Status Request(const std::string& socket_path,
+                        const std::string& command_line, int input_fd,
+                        off_t input_size, bool is_shared_memory_used,
+                        int output_fd, std::string* message);
+
+ private:
+  void RunWorker(int listen_fd);
+
+  void HandleConnection(int connection_fd);
+
+  bool AddConnection(int connection_fd);
+
+  void RemoveConnection(int connection_fd);
+
+  std::shared_ptr<const Pipeline> GetPipeline(const std::string& command_line);
+
+  const std::string socket_path_;
+  const int num_worker_;
+
+  std::atomic<bool> is_stopping_;
+
+  std::mutex mutex_;
+  std::map<std::string, std::shared_ptr<const Pipeline> > pipelines_;
+
+  // Connections being served, which are shut down on stop.
+  std::mutex connection_mutex_;
+  std::set<int> connection_fds_;
+
+  DISALLOW_COPY_AND_ASSIGN(PipelineDaemon);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_PIPELINE_DAEMON_H_
@@ -0,0 +1,244 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#ifndef SPTK_UTILS_PROFILER_H_
+#define SPTK_UTILS_PROFILER_H_
+
+#include <atomic>   // std::atomic
+#include <chrono>   // std::chrono
+#include <cstdint>  // int64_t
+#include <ostream>  // std::ostream
+#include <string>   // std::string
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Statistics of one instrumented function.
+ *
+ * All counters are updated atomically so that an instance can be shared by
+ * threads.
+ */
+struct ProfileCounter {
+  /**
+   * @param[in] name Name of counter, e.g., class name and function name.
+   */
+  explicit ProfileCounter(const std::string& name)
+      : name_(name),
+        num_call_(0),
+        num_nanosecond_(0),
+        num_frame_(0),
+        num_byte_read_(0),
+        num_byte_written_(0),
+        num_iteration_(0) {
+  }
+
+  //! Name of counter.
+  const std::string name_;
+
+  //! Number of calls.
+  std::atomic<int64_t> num_call_;
+
+  //! Cumulative time in nanoseconds.
+  std::atomic<int64_t> num_nanosecond_;
+
+  //! Number of processed frames.
+  std::atomic<int64_t> num_frame_;
+
+  //! Number of read bytes.
+  std::atomic<int64_t> num_byte_read_;
+
+  //! Number of written bytes.
+  std::atomic<int64_t> num_byte_written_;
+
+  //! Number of iterations of iterative algorithms.
+  std::atomic<int64_t> num_iteration_;
+};
+
+/**
+ * Collect hot-path statistics of SPTK.
+ *
+ * Profiling is enabled by the environment variable @c SPTK_PROFILE or by the
+ * option @c --profile[=FILE] accepted by every command through
+ * InitializeCommand(). If the value is @c 1 or @c stderr, or no file is given,
+ * the statistics are written to the standard error at exit as one line of
+ * JSON. Otherwise, the value is taken as a file name and the line is appended
+ * to the file, so that all commands in a pipeline can share one file. If
+ * profiling is disabled, every instrumented function costs only one
+ * comparison.
+ */
+class Profiler {
+ public:
+  /**
+   * @return True if profiling is enabled.
+   */
+  static bool IsEnabled();
+
+  /**
+   * Enable profiling if @c --profile or @c --profile=FILE is given, and remove
+   * the option from the arguments so that the rest can be parsed as usual.
+   * This must be called before any instrumented function.
+   *
+   * @param[in,out] argc Number of arguments.
+   * @param[in,out] argv Arguments.
+   */
+  static void ParseCommandLine(int* argc, char* argv[]);
+
+  /**
+   * Get a counter. The same counter is returned for the same name.
+   *
+   * @param[in] name Name of counter.
+   * @return Counter, or NULL if profiling is disabled.
+   */
+  static ProfileCounter* GetCounter(const char* name);
+
+  /**
+   * Get a counter through a cache owned by the caller. The counter is stored in
+   * the cache only if profiling is enabled, so that profiling enabled after
+   * the first call is not missed.
+   *
+   * @param[in] name Name of counter.
+   * @param[in,out] cache Cache of counter, initially NULL.
+   * @return Counter, or NULL if profiling is disabled.
+   */
+  static ProfileCounter* GetCounter(const char* name,
+                                    std::atomic<ProfileCounter*>* cache);
+
+  /**
+   * Write all statistics as JSON. This is called automatically at exit.
+   *
+   * @param[out] output_stream Output stream.
+   */
+  static void Dump(std::ostream* output_stream);
+};
+
+/**
+ * Measure a scope and update its counter.
+ */
+class ScopedProfile {
+ public:
+  /**
+   * @param[in] counter Counter to be updated, or NULL to do nothing.
+   */
+  explicit ScopedProfile(ProfileCounter* counter) : counter_(counter) {
+    if (NULL != counter_) {
+      start_time_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~ScopedProfile() {
+    if (NULL != counter_) {
+      const std::chrono::steady_clock::duration elapsed_time(
+          std::chrono::steady_clock::now() - start_time_);
+      counter_->num_call_.fetch_add(1, std::memory_order_relaxed);
+      counter_->num_nanosecond_.fetch_add(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time)
+              .count(),
+          std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @param[in] num_frame Number of processed frames.
+   */
+  void AddFrame(int64_t num_frame) {
+    if (NULL != counter_) {
+      counter_->num_frame_.fetch_add(num_frame, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @param[in] num_byte Number of read bytes.
+   */
+  void AddByteRead(int64_t num_byte) {
+    if (NULL != counter_) {
+      counter_->num_byte_read_.fetch_add(num_byte, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @param[in] num_byte Number of written bytes.
+   */
+  void AddByteWritten(int64_t num_byte) {
+    if (NULL != counter_) {
+      counter_->num_byte_written_.fetch_add(num_byte,
+                                            std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @param[in] num_iteration Number of iterations.
+   */
+  void AddIteration(int64_t num_iteration) {
+    if (NULL != counter_) {
+      counter_->num_iteration_.fetch_add(num_iteration,
+                                         std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  ProfileCounter* const counter_;
+  std::chrono::steady_clock::time_point start_time_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedProfile);
+};
+
+}  // namespace sptk
+
+/**
+ * Profile the rest of the current scope under the given name. The counter is
+ * looked up once per call site after profiling is enabled.
+ */
+#define SPTK_PROFILE_SCOPE(name)                                        \
+  static std::atomic<sptk::ProfileCounter*> sptk_profile_counter(NULL); \
+  sptk::ScopedProfile sptk_profile_scope(                               \
+      sptk::Profiler::GetCounter(name, &sptk_profile_counter))
+
+#define SPTK_PROFILE_FRAME(n) sptk_profile_scope.AddFrame(n)
+#define SPTK_PROFILE_BYTE_READ(n) sptk_profile_scope.AddByteRead(n)
+#define SPTK_PROFILE_BYTE_WRITTEN(n) sptk_profile_scope.AddByteWritten(n)
+#define SPTK_PROFILE_ITERATION(n) sptk_profile_scope.AddIteration(n)
+
+#endif  // SPTK_UTILS_PROFILER_H_
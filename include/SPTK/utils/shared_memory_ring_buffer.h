@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_UTILS_SHARED_MEMORY_RING_BUFFER_H_
+#define SPTK_UTILS_SHARED_MEMORY_RING_BUFFER_H_
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // uint64_t
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Lock-free single-producer single-consumer ring buffer in shared memory.
+ *
+ * The buffer lives in an anonymous file created by Create() and is mapped by
+ * the writing and the reading processes. The file is created by memfd_create
+ * on Linux and by shm_open elsewhere. Data are written and read in place;
+ * a process sleeps only when the buffer is full or empty, and is woken up
+ * through a futex on Linux.
+ *
+ * A launcher connects SPTK commands with ring buffers by giving them as the
+ * standard input and output, and tells it to the commands through the
+ * environment variable @c SPTK_SHARED_MEMORY_STREAM, which is a
+ * comma-separated list of @c stdin and @c stdout.
+ * AttachStandardStreams() then makes @c std::cin and @c std::cout use the ring
+ * buffers. Otherwise the standard streams are used as usual.
+ */
+class SharedMemoryRingBuffer {
+ public:
+  /**
+   * Create a ring buffer.
+   *
+   * @param[in] capacity Capacity in bytes, rounded up to a power of two.
+   * @param[out] fd File descriptor of the ring buffer.
+   * @return True on success, false on failure.
+   */
+  static bool Create(std::size_t capacity, int* fd);
+
+  /**
+   * @param[in] fd File descriptor given by Create().
+   */
+  explicit SharedMemoryRingBuffer(int fd);
+
+  virtual ~SharedMemoryRingBuffer();
+
+  /**
+   * @return True if this object is valid.
+   */
+  bool IsValid() const {
+    return NULL != header_;
+  }
+
+  /**
+   * Wait for data to be read.
+   *
+   * @param[out] data Beginning of readable data.
+   * @param[out] size Size of contiguous readable data.
+   * @return False if the writer is closed and no data remains.
+   */
+  bool GetReadableRegion(const char** data, std::size_t* size);
+
+  /**
+   * @param[in] size Size of data read from the readable region.
+   */
+  void Consume(std::size_t size);
+
+  /**
+   * Wait for space to be written.
+   *
+   * @param[out] data Beginning of writable space.
+   * @param[out] size Size of contiguous writable space.
+   * @return False if the reader is closed.
+   */
+  bool GetWritableRegion(char** data, std::size_t* size);
+
+  /**
+   * @param[in] size Size of data written to the writable region.
+   */
+  void Commit(std::size_t size);
+
+  /**
+   * Tell the reader that no more data are written.
+   */
+  void CloseWriter();
+
+  /**
+   * Tell the writer that no more data are read.
+   */
+  void CloseReader();
+
+  /**
+   * Use ring buffers given by a launcher as @c std::cin and @c std::cout. This
+   * should be called at the beginning of commands.
+   */
+  static void AttachStandardStreams();
+
+ private:
+  struct Header;
+
+  Header* header_;
+  char* data_;
+  std::size_t mapped_size_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedMemoryRingBuffer);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_SHARED_MEMORY_RING_BUFFER_H_
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_UTILS_SHARED_TABLE_CACHE_H_
+#define SPTK_UTILS_SHARED_TABLE_CACHE_H_
+
+#include <memory>   // std::shared_ptr, std::static_pointer_cast
+#include <sstream>  // std::ostringstream
+#include <string>   // std::string
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Process-wide cache of immutable tables such as twiddle factors and windows.
+ *
+ * A table is identified by a key made of its type and parameters, and is
+ * shared by all objects created with the same key. The cache holds only weak
+ * references, so that a table is released when the last object using it is
+ * destroyed. All functions are thread-safe.
+ */
+class SharedTableCache {
+ public:
+  /**
+   * Get a table, making it if not cached.
+   *
+   * @param[in] key Key of table. It must include the type of table.
+   * @param[in] make_table Function called as @c make_table(T*) to fill a new
+   *            table. It may get other tables from the cache.
+   * @return Shared table.
+   */
+  template <typename T, typename Function>
+  static std::shared_ptr<const T> Get(const std::string& key,
+                                      Function make_table) {
+    std::shared_ptr<const void> table(Find(key));
+    if (!table) {
+      std::shared_ptr<T> new_table(new T());
+      make_table(new_table.get());
+      table = Insert(key, new_table);
+    }
+    return std::static_pointer_cast<const T>(table);
+  }
+
+  /**
+   * Make key from type name and parameters, e.g., @c "fft/512".
+   *
+   * @param[in] type Type of table.
+   * @param[in] parameters Parameters of table.
+   * @return Key.
+   */
+  template <typename... Parameters>
+  static std::string MakeKey(const char* type,
+                             const Parameters&... parameters) {
+    std::ostringstream oss;
+    oss.precision(17);
+    oss << type;
+    AppendToKey(&oss, parameters...);
+    return oss.str();
+  }
+
+  /**
+   * @return Number of tables alive in the cache.
+   */
+  static int GetNumTable();
+
+ private:
+  static std::shared_ptr<const void> Find(const std::string& key);
+
+  // Return the cached table if another thread has inserted it in the meantime.
+  static std::shared_ptr<const void> Insert(
+      const std::string& key, const std::shared_ptr<const void>& table);
+
+  static void AppendToKey(std::ostringstream*) {
+  }
+
+  template <typename T, typename... Parameters>
+  static void AppendToKey(std::ostringstream* oss, const T& parameter,
+                          const Parameters&... parameters) {
+    *oss << "/" << parameter;
+    AppendToKey(oss, parameters...);
+  }
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_SHARED_TABLE_CACHE_H_
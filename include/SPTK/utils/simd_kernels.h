@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_UTILS_SIMD_KERNELS_H_
+#define SPTK_UTILS_SIMD_KERNELS_H_
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Table of hot-path kernels specialized for an instruction set.
+ *
+ * All variants are compiled into one binary and the best one for the host is
+ * selected once at the first call of Get(). The selection can be overridden by
+ * the environment variable @c SPTK_SIMD, e.g., @c SPTK_SIMD=scalar. If it is
+ * @c check, every kernel runs all supported variants and aborts when their
+ * results differ from those of the scalar reference implementation. An unknown
+ * value or a variant not supported by the host is warned about on the
+ * standard error, and the default is used instead.
+ *
+ * All variants give bit-exact results, so that outputs do not depend on the
+ * host. Reductions accumulate the terms in eight interleaved partial sums in
+ * every variant. SIMD variants are built only by GCC 4.9 or later (GCC 5 or
+ * later for AVX-512) or Clang.
+ */
+struct SimdKernels {
+  /**
+   * Instruction sets.
+   */
+  enum InstructionSets {
+    kScalar = 0,
+    kSse2,
+    kAvx2,
+    kAvx512,
+    kNeon,
+    kCheck,
+    kNumInstructionSets
+  };
+
+  /**
+   * @param[in] instruction_set Instruction set.
+   * @return True if the host can run the variant.
+   */
+  static bool IsSupported(InstructionSets instruction_set);
+
+  /**
+   * @param[in] instruction_set Instruction set.
+   * @return Name of instruction set, e.g., @c avx2.
+   */
+  static const char* GetName(InstructionSets instruction_set);
+
+  /**
+   * @return Kernels selected for the host.
+   */
+  static const SimdKernels& Get();
+
+  /**
+   * @param[in] instruction_set Instruction set.
+   * @return Kernels of the given instruction set, or NULL if not supported.
+   */
+  static const SimdKernels* Get(InstructionSets instruction_set);
+
+  //! Instruction set of this table.
+  InstructionSets instruction_set;
+
+  /**
+   * @f$\sum_{i=0}^{L-1} x(i) y(i)@f$.
+   */
+  double (*dot_product)(const double* x, const double* y, int length);
+
+  /**
+   * @f$\sum_{i=0}^{L-1} |x(i) - y(i)|@f$.
+   */
+  double (*manhattan_distance)(const double* x, const double* y, int length);
+
+  /**
+   * @f$\sum_{i=0}^{L-1} (x(i) - y(i))^2@f$.
+   */
+  double (*squared_euclidean_distance)(const double* x, const double* y,
+                                       int length);
+
+  /**
+   * Radix-2 decimation-in-frequency butterflies of one FFT block, where the
+   * first half of @p real and @p imag is paired with the second half.
+   */
+  void (*fft_butterfly)(const double* cosine, const double* sine, int length,
+                        double* real, double* imag);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_SIMD_KERNELS_H_
@@ -80,6 +80,12 @@ bool ReadStream(bool zero_padding, int stream_skip, int read_point,
                 int read_size, std::vector<T>* sequence_to_read,
                 std::istream* input_stream, int* actual_read_size);
 
+bool GetRemainingStreamSize(std::istream* input_stream, std::streamoff* size);
+bool IsInputPending(std::istream* input_stream);
+bool PrepareInputStream(int type_byte, std::istream* input_stream);
+bool GetInputError(std::istream* input_stream, std::string* error_message);
+void ExitOnInputError(std::istream* input_stream);
+
 template <typename T>
 bool WriteStream(T data_to_write, std::ostream* output_stream);
 bool WriteStream(const sptk::Matrix& matrix_to_write,
@@ -119,6 +125,7 @@ double AddInLogSpace(double log_x, double log_y);
 void PrintDataType(const std::string& symbol, std::ostream* stream);
 void PrintErrorMessage(const std::string& program_name,
                        const std::ostringstream& message);
+void InitializeCommand(int* argc, char* argv[]);
 
 }  // namespace sptk
 
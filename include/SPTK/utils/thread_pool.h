@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#ifndef SPTK_UTILS_THREAD_POOL_H_
+#define SPTK_UTILS_THREAD_POOL_H_
+
+#include <algorithm>           // std::min
+#include <atomic>              // std::atomic
+#include <condition_variable>  // std::condition_variable
+#include <deque>               // std::deque
+#include <functional>          // std::function
+#include <memory>              // std::unique_ptr
+#include <mutex>               // std::mutex
+#include <thread>              // std::thread
+#include <vector>              // std::vector
+
+#include "SPTK/utils/sptk_utils.h"
+
+namespace sptk {
+
+/**
+ * Work-stealing thread pool.
+ *
+ * A pool of @f$T@f$ threads consists of @f$T-1@f$ worker threads and the
+ * calling thread, which also runs tasks while waiting. Each worker has its own
+ * task queue and steals tasks from the others when it becomes idle. Parallel
+ * functions may be nested.
+ *
+ * The number of threads of the default pool is given by the option @c -T
+ * of the commands using the pool, or by the environment variable
+ * @c SPTK_NUM_THREADS. The default is one, i.e., everything runs on the
+ * calling thread.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @param[in] num_thread Number of threads, @f$T@f$.
+   */
+  explicit ThreadPool(int num_thread);
+
+  virtual ~ThreadPool();
+
+  /**
+   * @return Number of threads.
+   */
+  int GetNumThread() const {
+    return num_thread_;
+  }
+
+  /**
+   * Call @c function(first, last) for chunks of @f$[b, e)@f$ in parallel and
+   * wait for all of them.
+   *
+   * @param[in] begin Begin index, @f$b@f$.
+   * @param[in] end End index, @f$e@f$.
+   * @param[in] grain_size Maximum number of indices in one chunk.
+   * @param[in] function Function to be called.
+   */
+  void ParallelFor(int begin, int end, int grain_size,
+                   const std::function<void(int, int)>& function);
+
+  /**
+   * Reduce @f$[b, e)@f$ in parallel. The range is split into chunks of
+   * @p grain_size indices regardless of the number of threads and the results
+   * of the chunks are combined by a fixed binary tree, so that floating-point
+   * results do not depend on the number of threads.
+   *
+   * @param[in] begin Begin index, @f$b@f$.
+   * @param[in] end End index, @f$e@f$.
+   * @param[in] grain_size Number of indices in one chunk.
+   * @param[in] identity Result for empty range.
+   * @param[in] map Function called as @c map(first, last) for each chunk.
+   * @param[in] combine Function called as @c combine(left, right).
+   * @return Reduced value.
+   */
+  template <typename T, typename Map, typename Combine>
+  T ParallelReduce(int begin, int end, int grain_size, const T& identity,
+                   Map map, Combine combine) {
+    if (end <= begin) {
+      return identity;
+    }
+    if (grain_size <= 0) {
+      grain_size = 1;
+    }
+
+    const int num_chunk((end - begin + grain_size - 1) / grain_size);
+    std::vector<T> results(num_chunk, identity);
+    ParallelFor(0, num_chunk, 1, [&](int first, int last) {
+      for (int i(first); i < last; ++i) {
+        const int chunk_begin(begin + i * grain_size);
+        const int chunk_end(std::min(end, chunk_begin + grain_size));
+        results[i] = map(chunk_begin, chunk_end);
+      }
+    });
+
+    for (int stride(1); stride < num_chunk; stride *= 2) {
+      for (int i(0); i + stride < num_chunk; i += 2 * stride) {
+        results[i] = combine(results[i], results[i + stride]);
+      }
+    }
+    return results[0];
+  }
+
+  /**
+   * Process a stream in parallel keeping its order. Blocks of items are read
+   * by @c read(Input*) until it returns false, processed by
+   * @c process(const Input&, Output*) in parallel, and written by
+   * @c write(const Output&) in the input order.
+   *
+   * @param[in] block_size Number of items processed in parallel.
+   * @param[in] read Read function.
+   * @param[in] process Process function.
+   * @param[in] write Write function.
+   * @return True on success, false if @c process or @c write fails.
+   */
+  template <typename Input, typename Output, typename Read, typename Process,
+            typename Write>
+  bool ParallelMap(int block_size, Read read, Process process, Write write) {
+    if (block_size <= 0) {
+      block_size = 1;
+    }
+
+    std::vector<Input> inputs(block_size);
+    std::vector<Output> outputs(block_size);
+    std::unique_ptr<bool[]> is_succeeded(new bool[block_size]);
+    for (;;) {
+      int num_item(0);
+      while (num_item < block_size && read(&inputs[num_item])) {
+        ++num_item;
+      }
+      if (0 == num_item) {
+        return true;
+      }
+
+      ParallelFor(0, num_item, 1, [&](int first, int last) {
+        for (int i(first); i < last; ++i) {
+          is_succeeded[i] = process(inputs[i], &outputs[i]);
+        }
+      });
+
+      for (int i(0); i < num_item; ++i) {
+        if (!is_succeeded[i] || !write(outputs[i])) {
+          return false;
+        }
+      }
+      if (num_item < block_size) {
+        return true;
+      }
+    }
+  }
+
+  /**
+   * @return Default pool shared in the process.
+   */
+  static ThreadPool& GetDefault();
+
+  /**
+   * @return Number of threads of the default pool.
+   */
+  static int GetDefaultNumThread();
+
+  /**
+   * Take the option @c -T @e num_thread from the arguments, and remove it so
+   * that the rest can be parsed as usual. This must be called before the first
+   * call of GetDefault().
+   *
+   * @param[in,out] argc Number of arguments.
+   * @param[in,out] argv Arguments.
+   * @return False if the number of threads is invalid.
+   */
+  static bool ParseCommandLine(int* argc, char* argv[]);
+
+ private:
+  struct TaskGroup {
+    explicit TaskGroup(int num_task) : num_remaining_task(num_task) {
+    }
+
+    std::atomic<int> num_remaining_task;
+  };
+
+  struct Task {
+    const std::function<void(int, int)>* function;
+    int first;
+    int last;
+    TaskGroup* group;
+  };
+
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void RunWorker(int worker_index);
+
+  bool RunTask(int queue_index);
+
+  const int num_thread_;
+
+  std::vector<std::unique_ptr<TaskQueue> > queues_;
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::atomic<int> num_queued_task_;
+  std::atomic<int> next_queue_index_;
+  bool is_stopping_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadPool);
+};
+
+}  // namespace sptk
+
+#endif  // SPTK_UTILS_THREAD_POOL_H_
@@ -45,6 +45,7 @@
 #ifndef SPTK_WINDOW_DATA_WINDOWING_H_
 #define SPTK_WINDOW_DATA_WINDOWING_H_
 
+#include <memory>  // std::shared_ptr
 #include <vector>  // std::vector
 
 #include "SPTK/utils/sptk_utils.h"
@@ -143,7 +144,7 @@ class DataWindowing {
 
   bool is_valid_;
 
-  std::vector<double> window_;
+  std::shared_ptr<const std::vector<double> > window_;
 
   DISALLOW_COPY_AND_ASSIGN(DataWindowing);
 };
@@ -45,6 +45,8 @@
 #ifndef SPTK_WINDOW_STANDARD_WINDOW_H_
 #define SPTK_WINDOW_STANDARD_WINDOW_H_
 
+#include <memory>  // std::shared_ptr
+#include <string>  // std::string
 #include <vector>  // std::vector
 
 #include "SPTK/utils/sptk_utils.h"
@@ -112,9 +114,14 @@ class StandardWindow : public WindowInterface {
    * @return Window.
    */
   virtual const std::vector<double>& Get() const {
-    return window_;
+    return *window_;
   }
 
+  /**
+   * @return Key of window in SharedTableCache.
+   */
+  virtual std::string GetCacheKey() const;
+
  private:
   const int window_length_;
   const WindowType window_type_;
@@ -122,7 +129,7 @@ class StandardWindow : public WindowInterface {
 
   bool is_valid_;
 
-  std::vector<double> window_;
+  std::shared_ptr<const std::vector<double> > window_;
 
   DISALLOW_COPY_AND_ASSIGN(StandardWindow);
 };
@@ -45,6 +45,7 @@
 #ifndef SPTK_WINDOW_WINDOW_INTERFACE_H_
 #define SPTK_WINDOW_WINDOW_INTERFACE_H_
 
+#include <string>  // std::string
 #include <vector>  // std::vector
 
 namespace sptk {
@@ -68,6 +69,14 @@ class WindowInterface {
    * @return Window.
    */
   virtual const std::vector<double>& Get() const = 0;
+
+  /**
+   * @return Key of window in SharedTableCache, or empty string if the window
+   *         is not shared.
+   */
+  virtual std::string GetCacheKey() const {
+    return std::string();
+  }
 };
 
 }  // namespace sptk
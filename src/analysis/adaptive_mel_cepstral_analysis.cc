@@ -44,10 +44,212 @@
 
 #include "SPTK/analysis/adaptive_mel_cepstral_analysis.h"
 
-#include <algorithm>  // std::fill, std::transform
+#include <algorithm>  // std::fill
 #include <cmath>      // std::log
 #include <cstddef>    // std::size_t
 
+namespace {
+
+// Number of channels processed in SIMD lanes.
+const int kNumLane(4);
+
+// Positions of states in units of lanes.
+struct Layout {
+  Layout(int num_order, int num_pade_order)
+      : b(0),
+        gradient(b + num_order + 1),
+        e(gradient + num_order),
+        d1(e + num_order + 1),
+        p1(d1 + num_pade_order + 1),
+        d2(p1 + num_pade_order + 1),
+        p2(d2 + num_pade_order * (num_order + 2)),
+        prev_prediction_error(p2 + num_pade_order + 1),
+        prev_epsilon(prev_prediction_error + 1),
+        size(prev_epsilon + 1) {
+  }
+
+  const int b;
+  const int gradient;
+  const int e;
+  const int d1;
+  const int p1;
+  const int d2;
+  const int p2;
+  const int prev_prediction_error;
+  const int prev_epsilon;
+  const int size;
+};
+
+struct Parameters {
+  int num_order;
+  int num_pade_order;
+  double alpha;
+  double beta;
+  const double* pade_coefficients;
+  double min_epsilon;
+  double momentum;
+  double forgetting_factor;
+  double step_size_factor;
+};
+
+// Update the states of L channels sample by sample. The i-th state of the l-th
+// channel is stored in s[i * L + l].
+template <int L>
+void Update(const Parameters& parameters, const Layout& layout,
+            const double* input_signals, int stride, int length,
+            double* prediction_errors, double* s) {
+  const int num_order(parameters.num_order);
+  const int num_pade_order(parameters.num_pade_order);
+  const double alpha(parameters.alpha);
+  const double beta(parameters.beta);
+  const double* pade_coefficients(parameters.pade_coefficients);
+
+  double* b(s + layout.b * L);
+  double* gradient(s + layout.gradient * L);
+  double* e(s + layout.e * L);
+  double* d1(s + layout.d1 * L);
+  double* p1(s + layout.p1 * L);
+  double* p2(s + layout.p2 * L);
+  double* prev_prediction_error(s + layout.prev_prediction_error * L);
+  double* prev_epsilon(s + layout.prev_epsilon * L);
+
+  for (int t(0); t < length; ++t) {
+    const double* x(input_signals + t * stride);
+
+    // Apply inverse MLSA digital filter whose coefficients are -b(1), ...,
+    // -b(M). Since its gain is always one, the input is not scaled.
+    double curr_prediction_error[L];
+    if (0 == num_order) {
+      for (int l(0); l < L; ++l) {
+        curr_prediction_error[l] = x[l];
+      }
+    } else {
+      // First stage:
+      double first_output[L];
+      double y[L];
+      for (int l(0); l < L; ++l) {
+        first_output[l] = 0.0;
+        y[l] = x[l];
+      }
+      for (int i(num_pade_order); 0 < i; --i) {
+        const double c(pade_coefficients[i]);
+        const bool is_odd(1 == i % 2);
+        for (int l(0); l < L; ++l) {
+          d1[i * L + l] = beta * p1[(i - 1) * L + l] + alpha * d1[i * L + l];
+          p1[i * L + l] = d1[i * L + l] * -b[L + l];
+          const double v(p1[i * L + l] * c);
+          y[l] += is_odd ? v : -v;
+          first_output[l] += v;
+        }
+      }
+      for (int l(0); l < L; ++l) {
+        p1[l] = y[l];
+        first_output[l] += y[l];
+      }
+
+      // Second stage:
+      double second_output[L];
+      for (int l(0); l < L; ++l) {
+        second_output[l] = 0.0;
+        y[l] = first_output[l];
+      }
+      for (int i(num_pade_order); 0 < i; --i) {
+        double* d2(s + (layout.d2 + (i - 1) * (num_order + 2)) * L);
+        // Update and delay the signals at once. The j-th signal is written
+        // to the (j+1)-th position after it is read.
+        double z[L];
+        double prev[L];
+        double curr[L];
+        for (int l(0); l < L; ++l) {
+          d2[l] = p2[(i - 1) * L + l];
+          d2[L + l] = beta * p2[(i - 1) * L + l] + alpha * d2[L + l];
+          z[l] = 0.0;
+          prev[l] = d2[L + l];
+          curr[l] = d2[2 * L + l];
+          d2[2 * L + l] = prev[l];
+        }
+        for (int j(2); j <= num_order; ++j) {
+          double* d(d2 + (j + 1) * L);
+          const double* w(b + j * L);
+          for (int l(0); l < L; ++l) {
+            const double next(d[l]);
+            prev[l] = curr[l] + alpha * (next - prev[l]);
+            z[l] += prev[l] * -w[l];
+            d[l] = prev[l];
+            curr[l] = next;
+          }
+        }
+
+        const double c(pade_coefficients[i]);
+        const bool is_odd(1 == i % 2);
+        for (int l(0); l < L; ++l) {
+          p2[i * L + l] = z[l];
+          const double v(z[l] * c);
+          y[l] += is_odd ? v : -v;
+          second_output[l] += v;
+        }
+      }
+      for (int l(0); l < L; ++l) {
+        p2[l] = y[l];
+        second_output[l] += y[l];
+        curr_prediction_error[l] = second_output[l];
+      }
+    }
+
+    // Update epsilon using Eq. (29).
+    double curr_epsilon[L];
+    for (int l(0); l < L; ++l) {
+      curr_epsilon[l] =
+          (parameters.forgetting_factor * prev_epsilon[l]) +
+          (1.0 - parameters.forgetting_factor) *
+              (curr_prediction_error[l] * curr_prediction_error[l]);
+      if (curr_epsilon[l] < parameters.min_epsilon) {
+        curr_epsilon[l] = parameters.min_epsilon;
+      }
+    }
+
+    // Apply phi digital filter and update MLSA digital filter coefficients
+    // using Eq. (27) in one pass. The i-th output of the filter is written to
+    // the (i+1)-th position after it is read.
+    {
+      double sigma[L];
+      double mu[L];
+      double prev[L];
+      double curr[L];
+      for (int l(0); l < L; ++l) {
+        sigma[l] =
+            2.0 * (1.0 - parameters.momentum) * curr_prediction_error[l];
+        mu[l] = parameters.step_size_factor / (num_order * curr_epsilon[l]);
+        e[l] = alpha * e[l] + beta * prev_prediction_error[l];
+        prev[l] = e[l];
+      }
+      for (int i(0); i < num_order; ++i) {
+        double* y(e + (i + 1) * L);
+        double* g(gradient + i * L);
+        double* w(b + (i + 1) * L);
+        for (int l(0); l < L; ++l) {
+          const double next(y[l]);
+          if (0 < i) prev[l] = curr[l] + alpha * (next - prev[l]);
+          curr[l] = next;
+          y[l] = prev[l];
+          g[l] = parameters.momentum * g[l] - sigma[l] * prev[l];
+          w[l] -= mu[l] * g[l];
+        }
+      }
+    }
+
+    // Store outputs.
+    double* prediction_error(prediction_errors + t * stride);
+    for (int l(0); l < L; ++l) {
+      prediction_error[l] = curr_prediction_error[l];
+      prev_prediction_error[l] = curr_prediction_error[l];
+      prev_epsilon[l] = curr_epsilon[l];
+    }
+  }
+}
+
+}  // namespace
+
 namespace sptk {
 
 AdaptiveMelCepstralAnalysis::AdaptiveMelCepstralAnalysis(
@@ -80,82 +282,129 @@ bool AdaptiveMelCepstralAnalysis::Run(
     return false;
   }
 
-  // Prepare memories.
-  const int num_order(GetNumOrder());
-  if (buffer->mlsa_digital_filter_coefficients_.size() !=
-      static_cast<std::size_t>(num_order + 1)) {
-    buffer->mlsa_digital_filter_coefficients_.resize(num_order + 1);
-    std::fill(buffer->mlsa_digital_filter_coefficients_.begin(),
-              buffer->mlsa_digital_filter_coefficients_.end(), 0.0);
+  return Run(&input_signal, 1, prediction_error, mel_cepstrum, buffer);
+}
+
+bool AdaptiveMelCepstralAnalysis::Run(
+    const double* input_signals, int length, double* prediction_errors,
+    std::vector<double>* mel_cepstrum,
+    AdaptiveMelCepstralAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || length <= 0 || NULL == input_signals ||
+      NULL == prediction_errors || NULL == buffer) {
+    return false;
   }
-  if (buffer->inverse_mlsa_digital_filter_coefficients_.size() !=
-      static_cast<std::size_t>(num_order + 1)) {
-    buffer->inverse_mlsa_digital_filter_coefficients_.resize(num_order + 1);
-    buffer->inverse_mlsa_digital_filter_coefficients_[0] = 0.0;
+
+  if (!Analyze(1, input_signals, length, prediction_errors, buffer)) {
+    return false;
   }
-  if (buffer->buffer_for_phi_digital_filter_.size() !=
-      static_cast<std::size_t>(num_order + 1)) {
-    buffer->buffer_for_phi_digital_filter_.resize(num_order + 1);
-    std::fill(buffer->buffer_for_phi_digital_filter_.begin(),
-              buffer->buffer_for_phi_digital_filter_.end(), 0.0);
-  }
-  if (buffer->gradient_.size() != static_cast<std::size_t>(num_order)) {
-    buffer->gradient_.resize(num_order);
-    std::fill(buffer->gradient_.begin(), buffer->gradient_.end(), 0.0);
-  }
-
-  // Apply inverse MLSA digital filter.
-  std::transform(buffer->mlsa_digital_filter_coefficients_.begin() + 1,
-                 buffer->mlsa_digital_filter_coefficients_.end(),
-                 buffer->inverse_mlsa_digital_filter_coefficients_.begin() + 1,
-                 [](double x) { return -x; });
-  double curr_prediction_error;
-  if (!mlsa_digital_filter_.Run(
-          buffer->inverse_mlsa_digital_filter_coefficients_, input_signal,
-          &curr_prediction_error, &buffer->buffer_for_mlsa_digital_filter_)) {
+
+  if (NULL != mel_cepstrum && !Convert(0, mel_cepstrum, buffer)) {
+    return false;
+  }
+
+  return true;
+}
+
+bool AdaptiveMelCepstralAnalysis::Run(
+    int num_channel, const double* input_signals, int length,
+    double* prediction_errors, std::vector<std::vector<double> >* mel_cepstra,
+    AdaptiveMelCepstralAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || num_channel <= 0 || length <= 0 || NULL == input_signals ||
+      NULL == prediction_errors || NULL == buffer) {
+    return false;
+  }
+
+  if (!Analyze(num_channel, input_signals, length, prediction_errors,
+               buffer)) {
     return false;
   }
 
-  // Apply phi digital filter.
-  {
-    const double alpha(GetAlpha());
-    const double beta(1.0 - alpha * alpha);
-    double* e(&buffer->buffer_for_phi_digital_filter_[0]);
-    e[0] = alpha * e[0] + beta * buffer->prev_prediction_error_;
-    for (int i(1); i < num_order; ++i) {
-      e[i] += alpha * (e[i + 1] - e[i - 1]);
+  if (NULL != mel_cepstra) {
+    if (mel_cepstra->size() != static_cast<std::size_t>(num_channel)) {
+      mel_cepstra->resize(num_channel);
     }
-    for (int i(num_order); 0 < i; --i) {
-      e[i] = e[i - 1];
+    for (int c(0); c < num_channel; ++c) {
+      if (!Convert(c, &((*mel_cepstra)[c]), buffer)) {
+        return false;
+      }
     }
   }
 
-  // Update epsilon using Eq. (29).
-  double curr_epsilon((forgetting_factor_ * buffer->prev_epsilon_) +
-                      (1.0 - forgetting_factor_) *
-                          (curr_prediction_error * curr_prediction_error));
-  if (curr_epsilon < min_epsilon_) {
-    curr_epsilon = min_epsilon_;
-  }
-
-  // Update MLSA digital filter coefficients using Eq. (27).
-  if (0 < num_order) {
-    const double sigma(2.0 * (1.0 - momentum_) * curr_prediction_error);
-    const double mu(step_size_factor_ / (num_order * curr_epsilon));
-    const double* e(&buffer->buffer_for_phi_digital_filter_[1]);
-    double* gradient(&buffer->gradient_[0]);
-    double* b(&buffer->mlsa_digital_filter_coefficients_[1]);
-    for (int i(0); i < num_order; ++i) {
-      gradient[i] = momentum_ * gradient[i] - sigma * e[i];
-      b[i] -= mu * gradient[i];
+  return true;
+}
+
+bool AdaptiveMelCepstralAnalysis::Analyze(
+    int num_channel, const double* input_signals, int length,
+    double* prediction_errors,
+    AdaptiveMelCepstralAnalysis::Buffer* buffer) const {
+  const Layout layout(GetNumOrder(), GetNumPadeOrder());
+
+  // Prepare memories.
+  if (buffer->num_channel_ != num_channel) {
+    buffer->num_channel_ = num_channel;
+    buffer->states_.resize(layout.size * num_channel);
+    std::fill(buffer->states_.begin(), buffer->states_.end(), 0.0);
+    const int num_lane_channel(num_channel - num_channel % kNumLane);
+    for (int c(0); c < num_lane_channel; c += kNumLane) {
+      double* s(&(buffer->states_[layout.size * c]));
+      std::fill(s + layout.prev_epsilon * kNumLane,
+                s + (layout.prev_epsilon + 1) * kNumLane, 1.0);
+    }
+    for (int c(num_lane_channel); c < num_channel; ++c) {
+      buffer->states_[layout.size * c + layout.prev_epsilon] = 1.0;
     }
   }
-  buffer->mlsa_digital_filter_coefficients_[0] = 0.5 * std::log(curr_epsilon);
 
-  // Store outputs.
-  *prediction_error = curr_prediction_error;
-  buffer->prev_prediction_error_ = curr_prediction_error;
-  buffer->prev_epsilon_ = curr_epsilon;
+  Parameters parameters;
+  parameters.num_order = GetNumOrder();
+  parameters.num_pade_order = GetNumPadeOrder();
+  parameters.alpha = GetAlpha();
+  parameters.beta = 1.0 - parameters.alpha * parameters.alpha;
+  parameters.pade_coefficients =
+      &(mlsa_digital_filter_.GetPadeCoefficients()[0]);
+  parameters.min_epsilon = min_epsilon_;
+  parameters.momentum = momentum_;
+  parameters.forgetting_factor = forgetting_factor_;
+  parameters.step_size_factor = step_size_factor_;
+
+  // Process every four channels in SIMD lanes and the rest one by one.
+  int c(0);
+  for (; c + kNumLane <= num_channel; c += kNumLane) {
+    Update<kNumLane>(parameters, layout, input_signals + c, num_channel,
+                     length, prediction_errors + c,
+                     &(buffer->states_[layout.size * c]));
+  }
+  for (; c < num_channel; ++c) {
+    Update<1>(parameters, layout, input_signals + c, num_channel, length,
+              prediction_errors + c, &(buffer->states_[layout.size * c]));
+  }
+
+  return true;
+}
+
+bool AdaptiveMelCepstralAnalysis::Convert(
+    int channel, std::vector<double>* mel_cepstrum,
+    AdaptiveMelCepstralAnalysis::Buffer* buffer) const {
+  const int num_order(GetNumOrder());
+  const Layout layout(num_order, GetNumPadeOrder());
+  const int num_channel(buffer->num_channel_);
+  const int num_lane_channel(num_channel - num_channel % kNumLane);
+  const int num_lane(channel < num_lane_channel ? kNumLane : 1);
+  const int lane(channel < num_lane_channel ? channel % kNumLane : 0);
+  const double* s(&(buffer->states_[layout.size * (channel - lane)]));
+
+  // Gather MLSA digital filter coefficients of the channel.
+  if (buffer->mlsa_digital_filter_coefficients_.size() !=
+      static_cast<std::size_t>(num_order + 1)) {
+    buffer->mlsa_digital_filter_coefficients_.resize(num_order + 1);
+  }
+  double* b(&(buffer->mlsa_digital_filter_coefficients_[0]));
+  for (int m(1); m <= num_order; ++m) {
+    b[m] = s[(layout.b + m) * num_lane + lane];
+  }
+  b[0] = 0.5 * std::log(s[layout.prev_epsilon * num_lane + lane]);
 
   if (!mlsa_digital_filter_coefficients_to_mel_cepstrum_.Run(
           buffer->mlsa_digital_filter_coefficients_, mel_cepstrum)) {
@@ -85,4 +85,34 @@ bool AdaptiveMelGeneralizedCepstralAnalysis::Run(
       &buffer->buffer_for_generalized_cepstral_analysis_);
 }
 
+bool AdaptiveMelGeneralizedCepstralAnalysis::Run(
+    const double* input_signals, int length, double* prediction_errors,
+    std::vector<double>* mel_generalized_cepstrum,
+    AdaptiveMelGeneralizedCepstralAnalysis::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || length <= 0 || NULL == input_signals ||
+      NULL == prediction_errors || NULL == buffer) {
+    return false;
+  }
+
+  if (0 == generalized_cepstral_analysis_.GetNumStage()) {
+    return mel_cepstral_analysis_.Run(
+        input_signals, length, prediction_errors, mel_generalized_cepstrum,
+        &buffer->buffer_for_mel_cepstral_analysis_);
+  }
+
+  std::vector<double>* generalized_cepstrum(
+      NULL == mel_generalized_cepstrum ? &buffer->generalized_cepstrum_
+                                       : mel_generalized_cepstrum);
+  for (int t(0); t < length; ++t) {
+    if (!generalized_cepstral_analysis_.Run(
+            input_signals[t], &(prediction_errors[t]), generalized_cepstrum,
+            &buffer->buffer_for_generalized_cepstral_analysis_)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
@@ -50,6 +50,8 @@
 #include <cstddef>     // std::size_t
 #include <functional>  // std::minus, std::plus
 
+#include "SPTK/utils/profiler.h"
+
 namespace {
 
 void CoefficientsFrequencyTransform(const std::vector<double>& input,
@@ -128,6 +130,7 @@ MelCepstralAnalysis::MelCepstralAnalysis(int fft_length, int num_order,
 bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
                               std::vector<double>* mel_cepstrum,
                               MelCepstralAnalysis::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("MelCepstralAnalysis::Run");
   // Check inputs.
   const int half_fft_length(fft_length_ / 2);
   if (!is_valid_ ||
@@ -192,6 +195,7 @@ bool MelCepstralAnalysis::Run(const std::vector<double>& periodogram,
   // Perform Newton-Raphson method.
   double prev_epsilon(DBL_MAX);
   for (int n(0); n < num_iteration_; ++n) {
+    SPTK_PROFILE_ITERATION(1);
     // \tilde{c} -> c
     buffer->cepstrum_.resize(half_fft_length + 1);
     if (!inverse_frequency_transform_.Run(
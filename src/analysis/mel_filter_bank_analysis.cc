@@ -49,6 +49,8 @@
 #include <cstddef>    // std::size_t
 #include <numeric>    // std::accumulate
 
+#include "SPTK/utils/shared_table_cache.h"
+
 namespace {
 
 // Note that HTK use 1127 instead of 1127.01048.
@@ -84,49 +86,68 @@ MelFilterBankAnalysis::MelFilterBankAnalysis(int fft_length, int num_channel,
     return;
   }
 
+  filter_bank_ = SharedTableCache::Get<FilterBank>(
+      SharedTableCache::MakeKey("MelFilterBankAnalysis", fft_length_,
+                                num_channel_, sampling_rate, lowest_frequency,
+                                highest_frequency),
+      [=](FilterBank* filter_bank) {
+        MakeFilterBank(fft_length, num_channel, sampling_rate,
+                       lowest_frequency, highest_frequency, filter_bank);
+      });
+}
+
+void MelFilterBankAnalysis::MakeFilterBank(int fft_length, int num_channel,
+                                           double sampling_rate,
+                                           double lowest_frequency,
+                                           double highest_frequency,
+                                           FilterBank* filter_bank) {
+  int lower_bin_index;
   {
     const int min(1);
     const int index(static_cast<int>(
-        (lowest_frequency / sampling_rate * fft_length_) + 1.5));
-    lower_bin_index_ = std::max(min, index);
+        (lowest_frequency / sampling_rate * fft_length) + 1.5));
+    lower_bin_index = std::max(min, index);
   }
 
+  int upper_bin_index;
   {
-    const int max(fft_length_ / 2);
+    const int max(fft_length / 2);
     const int index(static_cast<int>(
-        (highest_frequency / sampling_rate * fft_length_) + 0.5));
-    upper_bin_index_ = std::min(max, index);
+        (highest_frequency / sampling_rate * fft_length) + 0.5));
+    upper_bin_index = std::min(max, index);
   }
+  filter_bank->lower_bin_index = lower_bin_index;
+  filter_bank->upper_bin_index = upper_bin_index;
 
   const double mel_low(HzToMel(lowest_frequency));
   const double mel_high(HzToMel(highest_frequency));
 
   // Create vector of filter-bank center frequencies.
-  std::vector<double> center_frequencies(num_channel_ + 1);
+  std::vector<double> center_frequencies(num_channel + 1);
   double* cf(&(center_frequencies[0]));
   {
     const double diff(mel_high - mel_low);
-    for (int m(0); m <= num_channel_; ++m) {
-      cf[m] = diff * (m + 1) / (num_channel_ + 1) + mel_low;
+    for (int m(0); m <= num_channel; ++m) {
+      cf[m] = diff * (m + 1) / (num_channel + 1) + mel_low;
     }
   }
 
   // Create lower channel map.
-  channel_indices_.resize(fft_length_ / 2, -1);
-  int* map(&(channel_indices_[0]));
+  filter_bank->channel_indices.resize(fft_length / 2, -1);
+  int* map(&(filter_bank->channel_indices[0]));
   {
-    for (int k(lower_bin_index_), m(0); k < upper_bin_index_; ++k) {
-      const double mel_k(SampleMel(k, fft_length_, sampling_rate));
-      while (cf[m] < mel_k && m <= num_channel_) ++m;
+    for (int k(lower_bin_index), m(0); k < upper_bin_index; ++k) {
+      const double mel_k(SampleMel(k, fft_length, sampling_rate));
+      while (cf[m] < mel_k && m <= num_channel) ++m;
       map[k] = m;
     }
   }
 
   // Create vector of lower channel weights.
-  channel_weights_.resize(fft_length_ / 2);
-  double* w(&(channel_weights_[0]));
-  for (int k(lower_bin_index_); k < upper_bin_index_; ++k) {
-    const double mel_k(SampleMel(k, fft_length_, sampling_rate));
+  filter_bank->channel_weights.resize(fft_length / 2);
+  double* w(&(filter_bank->channel_weights[0]));
+  for (int k(lower_bin_index); k < upper_bin_index; ++k) {
+    const double mel_k(SampleMel(k, fft_length, sampling_rate));
     const int m(map[k]);
     if (0 < m) {
       w[k] = (cf[m] - mel_k) / (cf[m] - cf[m - 1]);
@@ -154,11 +175,12 @@ bool MelFilterBankAnalysis::Run(const std::vector<double>& power_spectrum,
   std::fill(filter_bank_output->begin(), filter_bank_output->end(), 0.0);
 
   // Apply mel-filter-banks.
-  const int* map(&(channel_indices_[0]));
-  const double* w(&(channel_weights_[0]));
+  const int* map(&(filter_bank_->channel_indices[0]));
+  const double* w(&(filter_bank_->channel_weights[0]));
   const double* input(&(power_spectrum[0]));
   double* output(&((*filter_bank_output)[0]));
-  for (int k(lower_bin_index_); k < upper_bin_index_; ++k) {
+  for (int k(filter_bank_->lower_bin_index);
+       k < filter_bank_->upper_bin_index; ++k) {
     const int m(map[k]);
     const double x(use_power_ ? input[k] : std::sqrt(input[k]));
     if (0 < m) {
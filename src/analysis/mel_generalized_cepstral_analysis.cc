@@ -49,6 +49,8 @@
 #include <cstddef>     // std::size_t
 #include <functional>  // std::plus
 
+#include "SPTK/utils/profiler.h"
+
 namespace {
 
 void CoefficientsFrequencyTransform(const std::vector<double>& input,
@@ -178,6 +180,7 @@ bool MelGeneralizedCepstralAnalysis::Run(
     const std::vector<double>& periodogram,
     std::vector<double>* mel_generalized_cepstrum,
     MelGeneralizedCepstralAnalysis::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("MelGeneralizedCepstralAnalysis::Run");
   if (0.0 == gamma_) {
     return mel_cepstral_analysis_->Run(
         periodogram, mel_generalized_cepstrum,
@@ -277,6 +280,7 @@ bool MelGeneralizedCepstralAnalysis::Run(
   // Update coefficients using gradient method.
   if (-1.0 != gamma_) {
     for (int n(1); n <= num_iteration_; ++n) {
+      SPTK_PROFILE_ITERATION(1);
       double epsilon;
       if (!NewtonRaphsonMethod(gamma_, &epsilon, buffer)) {
         return false;
@@ -0,0 +1,603 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/capi/sptk_capi.h"
+
+#include <algorithm>  // std::copy
+#include <cstddef>    // std::size_t
+#include <new>        // std::bad_alloc, std::nothrow
+#include <vector>     // std::vector
+
+#include "SPTK/analysis/mel_generalized_cepstral_analysis.h"
+#include "SPTK/conversion/waveform_to_spectrum.h"
+#include "SPTK/filter/mlsa_digital_filter.h"
+#include "SPTK/math/frequency_transform.h"
+#include "SPTK/math/real_valued_fast_fourier_transform.h"
+#include "SPTK/utils/sptk_utils.h"
+#include "SPTK/window/data_windowing.h"
+#include "SPTK/window/standard_window.h"
+
+struct sptk_window {
+  sptk_window(int input_length, int output_length,
+              sptk::StandardWindow::WindowType window_type,
+              sptk::DataWindowing::NormalizationType normalization_type,
+              bool periodic)
+      : standard_window(input_length, window_type, periodic),
+        data_windowing(&standard_window, output_length, normalization_type) {
+  }
+  sptk::StandardWindow standard_window;
+  sptk::DataWindowing data_windowing;
+};
+
+struct sptk_window_buffer {
+  std::vector<double> input;
+  std::vector<double> output;
+};
+
+struct sptk_spectrum {
+  sptk_spectrum(int frame_length, int fft_length,
+                sptk::SpectrumToSpectrum::InputOutputFormats output_format,
+                double epsilon, double relative_floor_in_decibels)
+      : waveform_to_spectrum(frame_length, fft_length, output_format, epsilon,
+                             relative_floor_in_decibels) {
+  }
+  sptk::WaveformToSpectrum waveform_to_spectrum;
+};
+
+struct sptk_spectrum_buffer {
+  sptk::WaveformToSpectrum::Buffer buffer;
+  std::vector<double> input;
+  std::vector<double> output;
+};
+
+struct sptk_fftr {
+  sptk_fftr(int num_order, int fft_length) : fftr(num_order, fft_length) {
+  }
+  sptk::RealValuedFastFourierTransform fftr;
+};
+
+struct sptk_fftr_buffer {
+  sptk::RealValuedFastFourierTransform::Buffer buffer;
+  std::vector<double> input;
+  std::vector<double> real_part_output;
+  std::vector<double> imag_part_output;
+};
+
+struct sptk_mgcep {
+  sptk_mgcep(int fft_length, int num_order, double alpha, double gamma,
+             int num_iteration, double convergence_threshold)
+      : analysis(fft_length, num_order, alpha, gamma, num_iteration,
+                 convergence_threshold) {
+  }
+  sptk::MelGeneralizedCepstralAnalysis analysis;
+};
+
+struct sptk_mgcep_buffer {
+  sptk::MelGeneralizedCepstralAnalysis::Buffer buffer;
+  std::vector<double> input;
+  std::vector<double> output;
+};
+
+struct sptk_freqt {
+  sptk_freqt(int num_input_order, int num_output_order, double alpha)
+      : frequency_transform(num_input_order, num_output_order, alpha) {
+  }
+  sptk::FrequencyTransform frequency_transform;
+};
+
+struct sptk_freqt_buffer {
+  sptk::FrequencyTransform::Buffer buffer;
+  std::vector<double> input;
+  std::vector<double> output;
+};
+
+struct sptk_mlsa {
+  sptk_mlsa(int num_filter_order, int num_pade_order, double alpha,
+            bool transposition)
+      : filter(num_filter_order, num_pade_order, alpha, transposition) {
+  }
+  sptk::MlsaDigitalFilter filter;
+};
+
+struct sptk_mlsa_buffer {
+  sptk::MlsaDigitalFilter::Buffer buffer;
+  std::vector<double> filter_coefficients;
+};
+
+namespace {
+
+// Exceptions must not cross the C interface.
+template <typename Function>
+sptk_status Guard(Function function) {
+  try {
+    return function();
+  } catch (const std::bad_alloc&) {
+    return SPTK_ERROR_OUT_OF_MEMORY;
+  } catch (...) {
+    return SPTK_ERROR_FAILURE;
+  }
+}
+
+template <typename T, typename Create>
+sptk_status CreateHandle(T** handle, Create create) {
+  if (NULL == handle) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  *handle = NULL;
+  return Guard([handle, &create]() {
+    T* created_handle(create());
+    if (NULL == created_handle) {
+      return SPTK_ERROR_OUT_OF_MEMORY;
+    }
+    *handle = created_handle;
+    return SPTK_SUCCESS;
+  });
+}
+
+// Run @c run(input_frame, &output_frame) for each frame of a block.
+template <typename Run>
+sptk_status RunFrames(const double* input, int input_length, size_t num_frame,
+                      double* output, int output_length,
+                      std::vector<double>* input_frame,
+                      std::vector<double>* output_frame, Run run) {
+  if ((NULL == input || NULL == output) && 0 < num_frame) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return Guard([&]() {
+    input_frame->resize(input_length);
+    for (size_t t(0); t < num_frame; ++t) {
+      const double* input_begin(input + t * input_length);
+      std::copy(input_begin, input_begin + input_length, input_frame->begin());
+      if (!run(*input_frame, output_frame) ||
+          output_frame->size() != static_cast<std::size_t>(output_length)) {
+        return SPTK_ERROR_FAILURE;
+      }
+      std::copy(output_frame->begin(), output_frame->end(),
+                output + t * output_length);
+    }
+    return SPTK_SUCCESS;
+  });
+}
+
+}  // namespace
+
+extern "C" {
+
+const char* sptk_get_version(void) {
+  return sptk::kVersion;
+}
+
+int sptk_get_capi_version(void) {
+  return SPTK_CAPI_VERSION;
+}
+
+const char* sptk_get_status_string(sptk_status status) {
+  switch (status) {
+    case SPTK_SUCCESS: {
+      return "Success";
+    }
+    case SPTK_ERROR_INVALID_ARGUMENT: {
+      return "Invalid argument";
+    }
+    case SPTK_ERROR_OUT_OF_MEMORY: {
+      return "Out of memory";
+    }
+    case SPTK_ERROR_FAILURE: {
+      return "Failure";
+    }
+    default: {
+      return "Unknown status";
+    }
+  }
+}
+
+sptk_status sptk_window_create(int input_length, int output_length,
+                               sptk_window_type window_type,
+                               sptk_normalization_type normalization_type,
+                               int periodic, sptk_window** window) {
+  if (window_type < SPTK_WINDOW_BARTLETT ||
+      SPTK_WINDOW_TRAPEZOIDAL < window_type ||
+      normalization_type < SPTK_NORMALIZATION_NONE ||
+      SPTK_NORMALIZATION_MAGNITUDE < normalization_type) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const sptk_status status(CreateHandle(window, [&]() {
+    return new (std::nothrow) sptk_window(
+        input_length, output_length,
+        static_cast<sptk::StandardWindow::WindowType>(window_type),
+        static_cast<sptk::DataWindowing::NormalizationType>(normalization_type),
+        0 != periodic);
+  }));
+  if (SPTK_SUCCESS == status && (!(*window)->standard_window.IsValid() ||
+                                 !(*window)->data_windowing.IsValid())) {
+    sptk_window_destroy(*window);
+    *window = NULL;
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return status;
+}
+
+void sptk_window_destroy(sptk_window* window) {
+  delete window;
+}
+
+int sptk_window_get_input_length(const sptk_window* window) {
+  return NULL == window ? 0 : window->data_windowing.GetInputLength();
+}
+
+int sptk_window_get_output_length(const sptk_window* window) {
+  return NULL == window ? 0 : window->data_windowing.GetOutputLength();
+}
+
+sptk_status sptk_window_buffer_create(sptk_window_buffer** buffer) {
+  return CreateHandle(
+      buffer, []() { return new (std::nothrow) sptk_window_buffer(); });
+}
+
+void sptk_window_buffer_destroy(sptk_window_buffer* buffer) {
+  delete buffer;
+}
+
+sptk_status sptk_window_run(const sptk_window* window,
+                            sptk_window_buffer* buffer, const double* input,
+                            size_t num_frame, double* output) {
+  if (NULL == window || NULL == buffer) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const sptk::DataWindowing& data_windowing(window->data_windowing);
+  return RunFrames(input, data_windowing.GetInputLength(), num_frame, output,
+                   data_windowing.GetOutputLength(), &buffer->input,
+                   &buffer->output,
+                   [&data_windowing](const std::vector<double>& input_frame,
+                                     std::vector<double>* output_frame) {
+                     return data_windowing.Run(input_frame, output_frame);
+                   });
+}
+
+sptk_status sptk_spectrum_create(int frame_length, int fft_length,
+                                 sptk_spectrum_format output_format,
+                                 double epsilon,
+                                 double relative_floor_in_decibels,
+                                 sptk_spectrum** spectrum) {
+  if (output_format < SPTK_SPECTRUM_LOG_AMPLITUDE_IN_DECIBELS ||
+      SPTK_SPECTRUM_POWER < output_format) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const sptk_status status(CreateHandle(spectrum, [&]() {
+    return new (std::nothrow) sptk_spectrum(
+        frame_length, fft_length,
+        static_cast<sptk::SpectrumToSpectrum::InputOutputFormats>(
+            output_format),
+        epsilon, relative_floor_in_decibels);
+  }));
+  if (SPTK_SUCCESS == status && !(*spectrum)->waveform_to_spectrum.IsValid()) {
+    sptk_spectrum_destroy(*spectrum);
+    *spectrum = NULL;
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return status;
+}
+
+void sptk_spectrum_destroy(sptk_spectrum* spectrum) {
+  delete spectrum;
+}
+
+int sptk_spectrum_get_input_length(const sptk_spectrum* spectrum) {
+  return NULL == spectrum ? 0
+                          : spectrum->waveform_to_spectrum.GetFrameLength();
+}
+
+int sptk_spectrum_get_output_length(const sptk_spectrum* spectrum) {
+  return NULL == spectrum
+             ? 0
+             : spectrum->waveform_to_spectrum.GetFftLength() / 2 + 1;
+}
+
+sptk_status sptk_spectrum_buffer_create(sptk_spectrum_buffer** buffer) {
+  return CreateHandle(
+      buffer, []() { return new (std::nothrow) sptk_spectrum_buffer(); });
+}
+
+void sptk_spectrum_buffer_destroy(sptk_spectrum_buffer* buffer) {
+  delete buffer;
+}
+
+sptk_status sptk_spectrum_run(const sptk_spectrum* spectrum,
+                              sptk_spectrum_buffer* buffer,
+                              const double* input, size_t num_frame,
+                              double* output) {
+  if (NULL == spectrum || NULL == buffer) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const sptk::WaveformToSpectrum& waveform_to_spectrum(
+      spectrum->waveform_to_spectrum);
+  sptk::WaveformToSpectrum::Buffer* spectrum_buffer(&buffer->buffer);
+  return RunFrames(
+      input, sptk_spectrum_get_input_length(spectrum), num_frame, output,
+      sptk_spectrum_get_output_length(spectrum), &buffer->input,
+      &buffer->output,
+      [&waveform_to_spectrum, spectrum_buffer](
+          const std::vector<double>& input_frame,
+          std::vector<double>* output_frame) {
+        return waveform_to_spectrum.Run(input_frame, output_frame,
+                                        spectrum_buffer);
+      });
+}
+
+sptk_status sptk_fftr_create(int num_order, int fft_length, sptk_fftr** fftr) {
+  const sptk_status status(CreateHandle(fftr, [&]() {
+    return new (std::nothrow) sptk_fftr(num_order, fft_length);
+  }));
+  if (SPTK_SUCCESS == status && !(*fftr)->fftr.IsValid()) {
+    sptk_fftr_destroy(*fftr);
+    *fftr = NULL;
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return status;
+}
+
+void sptk_fftr_destroy(sptk_fftr* fftr) {
+  delete fftr;
+}
+
+int sptk_fftr_get_input_length(const sptk_fftr* fftr) {
+  return NULL == fftr ? 0 : fftr->fftr.GetNumOrder() + 1;
+}
+
+int sptk_fftr_get_output_length(const sptk_fftr* fftr) {
+  return NULL == fftr ? 0 : fftr->fftr.GetFftLength();
+}
+
+sptk_status sptk_fftr_buffer_create(sptk_fftr_buffer** buffer) {
+  return CreateHandle(
+      buffer, []() { return new (std::nothrow) sptk_fftr_buffer(); });
+}
+
+void sptk_fftr_buffer_destroy(sptk_fftr_buffer* buffer) {
+  delete buffer;
+}
+
+sptk_status sptk_fftr_run(const sptk_fftr* fftr, sptk_fftr_buffer* buffer,
+                          const double* input, size_t num_frame,
+                          double* real_part_output, double* imag_part_output) {
+  if (NULL == fftr || NULL == buffer ||
+      ((NULL == input || NULL == real_part_output ||
+        NULL == imag_part_output) &&
+       0 < num_frame)) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const int input_length(sptk_fftr_get_input_length(fftr));
+  const int output_length(sptk_fftr_get_output_length(fftr));
+  return Guard([&]() {
+    buffer->input.resize(input_length);
+    for (size_t t(0); t < num_frame; ++t) {
+      const double* input_begin(input + t * input_length);
+      std::copy(input_begin, input_begin + input_length,
+                buffer->input.begin());
+      if (!fftr->fftr.Run(buffer->input, &buffer->real_part_output,
+                          &buffer->imag_part_output, &buffer->buffer)) {
+        return SPTK_ERROR_FAILURE;
+      }
+      std::copy(buffer->real_part_output.begin(),
+                buffer->real_part_output.begin() + output_length,
+                real_part_output + t * output_length);
+      std::copy(buffer->imag_part_output.begin(),
+                buffer->imag_part_output.begin() + output_length,
+                imag_part_output + t * output_length);
+    }
+    return SPTK_SUCCESS;
+  });
+}
+
+sptk_status sptk_mgcep_create(int fft_length, int num_order, double alpha,
+                              double gamma, int num_iteration,
+                              double convergence_threshold,
+                              sptk_mgcep** mgcep) {
+  const sptk_status status(CreateHandle(mgcep, [&]() {
+    return new (std::nothrow)
+        sptk_mgcep(fft_length, num_order, alpha, gamma, num_iteration,
+                   convergence_threshold);
+  }));
+  if (SPTK_SUCCESS == status && !(*mgcep)->analysis.IsValid()) {
+    sptk_mgcep_destroy(*mgcep);
+    *mgcep = NULL;
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return status;
+}
+
+void sptk_mgcep_destroy(sptk_mgcep* mgcep) {
+  delete mgcep;
+}
+
+int sptk_mgcep_get_input_length(const sptk_mgcep* mgcep) {
+  return NULL == mgcep ? 0 : mgcep->analysis.GetFftLength() / 2 + 1;
+}
+
+int sptk_mgcep_get_output_length(const sptk_mgcep* mgcep) {
+  return NULL == mgcep ? 0 : mgcep->analysis.GetNumOrder() + 1;
+}
+
+sptk_status sptk_mgcep_buffer_create(sptk_mgcep_buffer** buffer) {
+  return CreateHandle(
+      buffer, []() { return new (std::nothrow) sptk_mgcep_buffer(); });
+}
+
+void sptk_mgcep_buffer_destroy(sptk_mgcep_buffer* buffer) {
+  delete buffer;
+}
+
+sptk_status sptk_mgcep_run(const sptk_mgcep* mgcep, sptk_mgcep_buffer* buffer,
+                           const double* input, size_t num_frame,
+                           double* output) {
+  if (NULL == mgcep || NULL == buffer) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const sptk::MelGeneralizedCepstralAnalysis& analysis(mgcep->analysis);
+  sptk::MelGeneralizedCepstralAnalysis::Buffer* analysis_buffer(
+      &buffer->buffer);
+  return RunFrames(input, sptk_mgcep_get_input_length(mgcep), num_frame,
+                   output, sptk_mgcep_get_output_length(mgcep),
+                   &buffer->input, &buffer->output,
+                   [&analysis, analysis_buffer](
+                       const std::vector<double>& input_frame,
+                       std::vector<double>* output_frame) {
+                     return analysis.Run(input_frame, output_frame,
+                                         analysis_buffer);
+                   });
+}
+
+sptk_status sptk_freqt_create(int num_input_order, int num_output_order,
+                              double alpha, sptk_freqt** freqt) {
+  const sptk_status status(CreateHandle(freqt, [&]() {
+    return new (std::nothrow)
+        sptk_freqt(num_input_order, num_output_order, alpha);
+  }));
+  if (SPTK_SUCCESS == status && !(*freqt)->frequency_transform.IsValid()) {
+    sptk_freqt_destroy(*freqt);
+    *freqt = NULL;
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return status;
+}
+
+void sptk_freqt_destroy(sptk_freqt* freqt) {
+  delete freqt;
+}
+
+int sptk_freqt_get_input_length(const sptk_freqt* freqt) {
+  return NULL == freqt ? 0
+                       : freqt->frequency_transform.GetNumInputOrder() + 1;
+}
+
+int sptk_freqt_get_output_length(const sptk_freqt* freqt) {
+  return NULL == freqt ? 0
+                       : freqt->frequency_transform.GetNumOutputOrder() + 1;
+}
+
+sptk_status sptk_freqt_buffer_create(sptk_freqt_buffer** buffer) {
+  return CreateHandle(
+      buffer, []() { return new (std::nothrow) sptk_freqt_buffer(); });
+}
+
+void sptk_freqt_buffer_destroy(sptk_freqt_buffer* buffer) {
+  delete buffer;
+}
+
+sptk_status sptk_freqt_run(const sptk_freqt* freqt, sptk_freqt_buffer* buffer,
+                           const double* input, size_t num_frame,
+                           double* output) {
+  if (NULL == freqt || NULL == buffer) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const sptk::FrequencyTransform& frequency_transform(
+      freqt->frequency_transform);
+  sptk::FrequencyTransform::Buffer* transform_buffer(&buffer->buffer);
+  return RunFrames(input, sptk_freqt_get_input_length(freqt), num_frame,
+                   output, sptk_freqt_get_output_length(freqt),
+                   &buffer->input, &buffer->output,
+                   [&frequency_transform, transform_buffer](
+                       const std::vector<double>& input_frame,
+                       std::vector<double>* output_frame) {
+                     return frequency_transform.Run(input_frame, output_frame,
+                                                    transform_buffer);
+                   });
+}
+
+sptk_status sptk_mlsa_create(int num_filter_order, int num_pade_order,
+                             double alpha, int transposition,
+                             sptk_mlsa** mlsa) {
+  const sptk_status status(CreateHandle(mlsa, [&]() {
+    return new (std::nothrow) sptk_mlsa(num_filter_order, num_pade_order,
+                                        alpha, 0 != transposition);
+  }));
+  if (SPTK_SUCCESS == status && !(*mlsa)->filter.IsValid()) {
+    sptk_mlsa_destroy(*mlsa);
+    *mlsa = NULL;
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  return status;
+}
+
+void sptk_mlsa_destroy(sptk_mlsa* mlsa) {
+  delete mlsa;
+}
+
+int sptk_mlsa_get_num_filter_order(const sptk_mlsa* mlsa) {
+  return NULL == mlsa ? 0 : mlsa->filter.GetNumFilterOrder();
+}
+
+sptk_status sptk_mlsa_buffer_create(sptk_mlsa_buffer** buffer) {
+  return CreateHandle(
+      buffer, []() { return new (std::nothrow) sptk_mlsa_buffer(); });
+}
+
+void sptk_mlsa_buffer_destroy(sptk_mlsa_buffer* buffer) {
+  delete buffer;
+}
+
+sptk_status sptk_mlsa_run(const sptk_mlsa* mlsa, sptk_mlsa_buffer* buffer,
+                          const double* filter_coefficients,
+                          const double* input, size_t num_sample,
+                          double* output) {
+  if (NULL == mlsa || NULL == buffer || NULL == filter_coefficients ||
+      ((NULL == input || NULL == output) && 0 < num_sample)) {
+    return SPTK_ERROR_INVALID_ARGUMENT;
+  }
+  const int num_coefficient(sptk_mlsa_get_num_filter_order(mlsa) + 1);
+  return Guard([&]() {
+    buffer->filter_coefficients.assign(filter_coefficients,
+                                       filter_coefficients + num_coefficient);
+    for (size_t t(0); t < num_sample; ++t) {
+      if (!mlsa->filter.Run(buffer->filter_coefficients, input[t], &output[t],
+                            &buffer->buffer)) {
+        return SPTK_ERROR_FAILURE;
+      }
+    }
+    return SPTK_SUCCESS;
+  });
+}
+
+}  // extern "C"
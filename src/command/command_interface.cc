@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/command/command_interface.h"
+
+#include <fstream>   // std::ifstream
+#include <iostream>  // std::cerr, std::cin, std::cout, std::endl
+#include <sstream>   // std::ostringstream
+#include <vector>    // std::vector
+
+#include "SPTK/command/command_line_parser.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+void PrintError(const std::string& command_name, const std::string& message) {
+  std::ostringstream error_message;
+  error_message << message;
+  sptk::PrintErrorMessage(command_name, error_message);
+}
+
+}  // namespace
+
+namespace sptk {
+
+int RunCommand(const std::string& command_name, int argc, char* argv[],
+               void (*print_usage)(std::ostream*), CommandInterface* command) {
+  if (argc < 1 || NULL == argv || NULL == print_usage || NULL == command) {
+    return 1;
+  }
+
+  const std::vector<std::string> arguments(argv + 1, argv + argc);
+  const CommandLineParser parser(std::string(command->GetOptionString()) +
+                                 "h");
+  CommandLineParser::Options options;
+  std::vector<std::string> operands;
+  std::string error_message;
+  const bool is_parsed(
+      parser.Parse(arguments, &options, &operands, &error_message));
+
+  // Options are processed in order until an invalid one as getopt does.
+  for (const std::pair<char, std::string>& option : options) {
+    if ('h' == option.first) {
+      print_usage(&std::cout);
+      return 0;
+    }
+    if (!command->SetOption(option.first, option.second, &error_message)) {
+      PrintError(command_name, error_message);
+      return 1;
+    }
+  }
+  if (!is_parsed) {
+    std::cerr << argv[0] << ": " << error_message << std::endl;
+    print_usage(&std::cerr);
+    return 1;
+  }
+
+  const char* input_file(NULL);
+  for (const std::string& operand : operands) {
+    bool is_consumed;
+    if (!command->SetOperand(operand, &is_consumed, &error_message)) {
+      PrintError(command_name, error_message);
+      return 1;
+    }
+    if (is_consumed) {
+      continue;
+    }
+    if (NULL != input_file) {
+      PrintError(command_name, "Too many input files");
+      return 1;
+    }
+    input_file = operand.c_str();
+  }
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    PrintError(command_name, std::string("Cannot open file ") + input_file);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  if (!command->Prepare(&error_message)) {
+    PrintError(command_name, error_message);
+    return 1;
+  }
+
+  error_message.clear();
+  if (!command->Run(&input_stream, &std::cout, &error_message)) {
+    if (!error_message.empty()) {
+      PrintError(command_name, error_message);
+    }
+    return 1;
+  }
+
+  return 0;
+}
+
+}  // namespace sptk
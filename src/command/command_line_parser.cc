@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/command/command_line_parser.h"
+
+#include <cstddef>  // std::size_t
+
+namespace sptk {
+
+bool CommandLineParser::Parse(const std::vector<std::string>& arguments,
+                              Options* options,
+                              std::vector<std::string>* operands,
+                              std::string* error_message) const {
+  if (NULL == options || NULL == operands || NULL == error_message) {
+    return false;
+  }
+
+  options->clear();
+  operands->clear();
+
+  for (std::size_t i(0); i < arguments.size(); ++i) {
+    const std::string& argument(arguments[i]);
+    if ("--" == argument) {
+      operands->insert(operands->end(), arguments.begin() + i + 1,
+                       arguments.end());
+      break;
+    }
+    if (argument.size() < 2 || '-' != argument[0]) {
+      operands->push_back(argument);
+      continue;
+    }
+
+    for (std::size_t j(1); j < argument.size(); ++j) {
+      const char option(argument[j]);
+      const std::string::size_type position(
+          ':' == option ? std::string::npos : option_string_.find(option));
+      if (std::string::npos == position) {
+        *error_message = "invalid option -- '" + std::string(1, option) + "'";
+        return false;
+      }
+      if (option_string_.size() <= position + 1 ||
+          ':' != option_string_[position + 1]) {
+        options->push_back(std::make_pair(option, std::string()));
+        continue;
+      }
+
+      // The rest of the argument or the next argument is the value.
+      if (j + 1 < argument.size()) {
+        options->push_back(std::make_pair(option, argument.substr(j + 1)));
+      } else if (i + 1 < arguments.size()) {
+        options->push_back(std::make_pair(option, arguments[++i]));
+      } else {
+        *error_message =
+            "option requires an argument -- '" + std::string(1, option) + "'";
+        return false;
+      }
+      break;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace sptk
@@ -0,0 +1,1241 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/command/data_transform_command.h"
+
+#include <cfloat>     // DBL_MAX, FLT_MAX
+#include <climits>    // INT_MIN, INT_MAX, SCHAR_MIN, SCHAR_MAX, etc.
+#include <cstdint>    // int8_t, int16_t, int32_t, int64_t, etc.
+#include <sstream>    // std::ostringstream
+#include <stdexcept>  // std::invalid_argument
+#include <string>     // std::stold
+
+#include "SPTK/utils/int24_t.h"
+#include "SPTK/utils/uint24_t.h"
+
+namespace {
+
+enum NumericType {
+  kUnknown = 0,
+  kSignedInteger,
+  kUnsignedInteger,
+  kFloatingPoint,
+};
+
+typedef sptk::DataTransformCommand::WarningType WarningType;
+
+const int kBufferSize(128);
+
+template <typename T1, typename T2>
+class DataTransform
+    : public sptk::DataTransformCommand::DataTransformInterface {
+ public:
+  DataTransform(const std::string& print_format, int num_column,
+                NumericType input_numeric_type, WarningType warning_type,
+                bool rounding, bool is_ascii_input, bool is_ascii_output,
+                T2 minimum_value = 0, T2 maximum_value = 0)
+      : print_format_(print_format),
+        num_column_(num_column),
+        input_numeric_type_(input_numeric_type),
+        warning_type_(warning_type),
+        rounding_(rounding),
+        is_ascii_input_(is_ascii_input),
+        is_ascii_output_(is_ascii_output),
+        minimum_value_(minimum_value),
+        maximum_value_(maximum_value) {
+  }
+
+  ~DataTransform() {
+  }
+
+  virtual bool Run(std::istream* input_stream,
+                   std::ostream* output_stream) const {
+    char buffer[kBufferSize];
+    int index(0);
+    for (;; ++index) {
+      // Read.
+      T1 input_data;
+      if (is_ascii_input_) {
+        std::string word;
+        *input_stream >> word;
+        if (word.empty()) break;
+        try {
+          input_data = std::stold(word);
+        } catch (std::invalid_argument&) {
+          return false;
+        }
+      } else {
+        if (!sptk::ReadStream(&input_data, input_stream)) {
+          break;
+        }
+      }
+
+      // Convert.
+      T2 output_data(input_data);
+
+      bool is_clipped(false);
+      {
+        // Clipping.
+        if (minimum_value_ < maximum_value_) {
+          if (kSignedInteger == input_numeric_type_) {
+            if (static_cast<int64_t>(input_data) <
+                static_cast<int64_t>(minimum_value_)) {
+              output_data = minimum_value_;
+              is_clipped = true;
+            } else if (static_cast<int64_t>(maximum_value_) <
+                       static_cast<int64_t>(input_data)) {
+              output_data = maximum_value_;
+              is_clipped = true;
+            }
+          } else if (kUnsignedInteger == input_numeric_type_) {
+            if (static_cast<uint64_t>(input_data) <
+                static_cast<uint64_t>(minimum_value_)) {
+              output_data = minimum_value_;
+              is_clipped = true;
+            } else if (static_cast<uint64_t>(maximum_value_) <
+                       static_cast<uint64_t>(input_data)) {
+              output_data = maximum_value_;
+              is_clipped = true;
+            }
+          } else if (kFloatingPoint == input_numeric_type_) {
+            if (static_cast<long double>(input_data) <
+                static_cast<long double>(minimum_value_)) {
+              output_data = minimum_value_;
+              is_clipped = true;
+            } else if (static_cast<long double>(maximum_value_) <
+                       static_cast<long double>(input_data)) {
+              output_data = maximum_value_;
+              is_clipped = true;
+            }
+          }
+        }
+
+        // Rounding.
+        if (rounding_ && !is_clipped) {
+          if (0.0 < input_data) {
+            output_data = static_cast<T2>(input_data + 0.5);
+          } else {
+            output_data = static_cast<T2>(input_data - 0.5);
+          }
+        }
+      }
+
+      if (is_clipped && sptk::DataTransformCommand::kIgnore != warning_type_) {
+        std::ostringstream error_message;
+        error_message << index << "th data is over the range of output type";
+        sptk::PrintErrorMessage("x2x", error_message);
+        if (sptk::DataTransformCommand::kExit == warning_type_) return false;
+      }
+
+      // Write output.
+      if (is_ascii_output_) {
+        if (!sptk::SnPrintf(output_data, print_format_, sizeof(buffer),
+                            buffer)) {
+          return false;
+        }
+        *output_stream << buffer;
+        if (0 == (index + 1) % num_column_) {
+          *output_stream << std::endl;
+        } else {
+          *output_stream << "\t";
+        }
+      } else {
+        if (!sptk::WriteStream(output_data, output_stream)) {
+          return false;
+        }
+      }
+    }
+
+    if (is_ascii_output_ && 0 != index % num_column_) {
+      *output_stream << std::endl;
+    }
+
+    return true;
+  }
+
+ private:
+  const std::string print_format_;
+  const int num_column_;
+  const NumericType input_numeric_type_;
+  const WarningType warning_type_;
+  const bool rounding_;
+  const bool is_ascii_input_;
+  const bool is_ascii_output_;
+  const T2 minimum_value_;
+  const T2 maximum_value_;
+
+  DataTransform<T1, T2>(const DataTransform<T1, T2>&);
+  void operator=(const DataTransform<T1, T2>&);
+};
+
+}  // namespace
+
+namespace sptk {
+
+class DataTransformCommand::DataTransformWrapper {
+ public:
+  DataTransformWrapper(const std::string& input_data_type,
+                       const std::string& output_data_type,
+                       const std::string& given_print_format, int num_column,
+                       WarningType warning_type, bool given_rounding_flag)
+      : data_transform_(NULL) {
+    std::string print_format(given_print_format);
+    if (print_format.empty() && "a" == output_data_type) {
+      if ("c" == input_data_type || "s" == input_data_type ||
+          "h" == input_data_type || "i" == input_data_type) {
+        print_format = "%d";
+      } else if ("l" == input_data_type) {
+        print_format = "%lld";
+      } else if ("C" == input_data_type || "S" == input_data_type ||
+                 "H" == input_data_type || "I" == input_data_type) {
+        print_format = "%u";
+      } else if ("L" == input_data_type) {
+        print_format = "%llu";
+      } else if ("f" == input_data_type || "d" == input_data_type) {
+        print_format = "%g";
+      } else if ("e" == input_data_type || "a" == input_data_type) {
+        print_format = "%Lg";
+      }
+    }
+
+    NumericType input_numeric_type(kUnknown);
+    if ("c" == input_data_type || "s" == input_data_type ||
+        "h" == input_data_type || "i" == input_data_type ||
+        "l" == input_data_type) {
+      input_numeric_type = kSignedInteger;
+    } else if ("C" == input_data_type || "S" == input_data_type ||
+               "H" == input_data_type || "I" == input_data_type ||
+               "L" == input_data_type) {
+      input_numeric_type = kUnsignedInteger;
+    } else if ("f" == input_data_type || "d" == input_data_type ||
+               "e" == input_data_type || "a" == input_data_type) {
+      input_numeric_type = kFloatingPoint;
+    }
+
+    bool rounding(false);
+    if (("f" == input_data_type || "d" == input_data_type ||
+         "e" == input_data_type || "a" == input_data_type) &&
+        ("c" == output_data_type || "C" == output_data_type ||
+         "s" == output_data_type || "S" == output_data_type ||
+         "h" == output_data_type || "H" == output_data_type ||
+         "i" == output_data_type || "I" == output_data_type ||
+         "l" == output_data_type || "L" == output_data_type)) {
+      rounding = given_rounding_flag;
+    }
+
+    const bool is_ascii_input("a" == input_data_type);
+    const bool is_ascii_output("a" == output_data_type);
+
+    // c -> *
+    if ("c" == input_data_type && "c" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0), sptk::int24_t(0));
+    } else if ("c" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("c" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("c" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(SCHAR_MAX));
+    } else if ("c" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("c" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("c" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("c" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<int8_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // s -> *
+    else if ("s" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<int16_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("s" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("s" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0), sptk::int24_t(0));
+    } else if ("s" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("s" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("s" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("s" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("s" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(SHRT_MAX));
+    } else if ("s" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("s" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("s" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("s" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("s" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("s" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<int16_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // h -> *
+    else if ("h" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<sptk::int24_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("h" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("h" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0), sptk::int24_t(0));
+    } else if ("h" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("h" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("h" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("h" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("h" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::INT24_MAX));
+    } else if ("h" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, sptk::INT24_MAX);
+    } else if ("h" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, sptk::INT24_MAX);
+    } else if ("h" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("h" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("h" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("h" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::int24_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0), sptk::int24_t(0));
+    }
+
+    // i -> *
+    else if ("i" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<int32_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("i" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("i" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(sptk::INT24_MIN),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("i" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("i" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("i" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("i" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("i" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("i" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, INT_MAX);
+    } else if ("i" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, INT_MAX);
+    } else if ("i" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("i" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("i" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("i" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<int32_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // l -> *
+    else if ("l" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<int64_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("l" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("l" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(sptk::INT24_MIN),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("l" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, INT_MIN, INT_MAX);
+    } else if ("l" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("l" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("l" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("l" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("l" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UINT_MAX);
+    } else if ("l" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, LLONG_MAX);
+    } else if ("l" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("l" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("l" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("l" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<int64_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // C -> *
+    else if ("C" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<uint8_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("C" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0), sptk::int24_t(0));
+    } else if ("C" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(0));
+    } else if ("C" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("C" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<uint8_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // S -> *
+    else if ("S" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<uint16_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("S" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("S" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0), sptk::int24_t(0));
+    } else if ("S" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("S" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(0));
+    } else if ("S" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("S" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<uint16_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // H -> *
+    else if ("H" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<sptk::uint24_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("H" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("H" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("H" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("H" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("H" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(0));
+    } else if ("H" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("H" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<sptk::uint24_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(0));
+    }
+
+    // I -> *
+    else if ("I" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<uint32_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("I" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("I" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("I" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, INT_MAX);
+    } else if ("I" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("I" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("I" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("I" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("I" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("I" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("I" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("I" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("I" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("I" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<uint32_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // L -> *
+    else if ("L" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<uint64_t, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SCHAR_MAX);
+    } else if ("L" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, SHRT_MAX);
+    } else if ("L" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(0),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("L" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, INT_MAX);
+    } else if ("L" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, LLONG_MAX);
+    } else if ("L" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("L" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("L" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("L" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UINT_MAX);
+    } else if ("L" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("L" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("L" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("L" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("L" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<uint64_t, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // f -> *
+    else if ("f" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<float, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("f" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<float, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("f" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<float, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(sptk::INT24_MIN),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("f" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<float, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, INT_MIN, INT_MAX);
+    } else if ("f" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<float, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, LLONG_MIN, LLONG_MAX);
+    } else if ("f" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<float, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("f" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<float, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("f" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<float, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("f" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<float, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UINT_MAX);
+    } else if ("f" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<float, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, ULLONG_MAX);
+    } else if ("f" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<float, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("f" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<float, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("f" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<float, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("f" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<float, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // d -> *
+    else if ("d" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<double, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("d" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<double, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("d" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<double, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(sptk::INT24_MIN),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("d" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<double, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, INT_MIN, INT_MAX);
+    } else if ("d" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<double, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, LLONG_MIN, LLONG_MAX);
+    } else if ("d" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<double, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("d" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<double, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("d" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<double, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("d" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<double, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UINT_MAX);
+    } else if ("d" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<double, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, ULLONG_MAX);
+    } else if ("d" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<double, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, -FLT_MAX, FLT_MAX);
+    } else if ("d" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<double, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("d" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<double, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("d" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<double, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // e -> *
+    else if ("e" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<long double, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("e" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<long double, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("e" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<long double, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(sptk::INT24_MIN),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("e" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<long double, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, INT_MIN, INT_MAX);
+    } else if ("e" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<long double, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, LLONG_MIN, LLONG_MAX);
+    } else if ("e" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("e" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("e" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<long double, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("e" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UINT_MAX);
+    } else if ("e" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, ULLONG_MAX);
+    } else if ("e" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<long double, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, -FLT_MAX, FLT_MAX);
+    } else if ("e" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<long double, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, -DBL_MAX, DBL_MAX);
+    } else if ("e" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<long double, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("e" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<long double, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+
+    // a -> *
+    else if ("a" == input_data_type && "c" == output_data_type) {  // NOLINT
+      data_transform_ = new DataTransform<long double, int8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SCHAR_MIN, SCHAR_MAX);
+    } else if ("a" == input_data_type && "s" == output_data_type) {
+      data_transform_ = new DataTransform<long double, int16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, SHRT_MIN, SHRT_MAX);
+    } else if ("a" == input_data_type && "h" == output_data_type) {
+      data_transform_ = new DataTransform<long double, sptk::int24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::int24_t(sptk::INT24_MIN),
+          sptk::int24_t(sptk::INT24_MAX));
+    } else if ("a" == input_data_type && "i" == output_data_type) {
+      data_transform_ = new DataTransform<long double, int32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, INT_MIN, INT_MAX);
+    } else if ("a" == input_data_type && "l" == output_data_type) {
+      data_transform_ = new DataTransform<long double, int64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, LLONG_MIN, LLONG_MAX);
+    } else if ("a" == input_data_type && "C" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint8_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UCHAR_MAX);
+    } else if ("a" == input_data_type && "S" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint16_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, USHRT_MAX);
+    } else if ("a" == input_data_type && "H" == output_data_type) {
+      data_transform_ = new DataTransform<long double, sptk::uint24_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, sptk::uint24_t(0),
+          sptk::uint24_t(sptk::UINT24_MAX));
+    } else if ("a" == input_data_type && "I" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint32_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, UINT_MAX);
+    } else if ("a" == input_data_type && "L" == output_data_type) {
+      data_transform_ = new DataTransform<long double, uint64_t>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, 0, ULLONG_MAX);
+    } else if ("a" == input_data_type && "f" == output_data_type) {
+      data_transform_ = new DataTransform<long double, float>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, -FLT_MAX, FLT_MAX);
+    } else if ("a" == input_data_type && "d" == output_data_type) {
+      data_transform_ = new DataTransform<long double, double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output, -DBL_MAX, DBL_MAX);
+    } else if ("a" == input_data_type && "e" == output_data_type) {
+      data_transform_ = new DataTransform<long double, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    } else if ("a" == input_data_type && "a" == output_data_type) {
+      data_transform_ = new DataTransform<long double, long double>(
+          print_format, num_column, input_numeric_type, warning_type, rounding,
+          is_ascii_input, is_ascii_output);
+    }
+  }
+
+  ~DataTransformWrapper() {
+    delete data_transform_;
+  }
+
+  bool IsValid() const {
+    return NULL != data_transform_;
+  }
+
+  bool Run(std::istream* input_stream, std::ostream* output_stream) const {
+    return IsValid() && data_transform_->Run(input_stream, output_stream);
+  }
+
+ private:
+  DataTransformInterface* data_transform_;
+
+  DISALLOW_COPY_AND_ASSIGN(DataTransformWrapper);
+};
+
+
+const char* const DataTransformCommand::kDefaultDataTypes("da");
+const bool DataTransformCommand::kDefaultRoundingFlag(false);
+const DataTransformCommand::WarningType
+    DataTransformCommand::kDefaultWarningType(kExit);
+const int DataTransformCommand::kDefaultNumColumn(1);
+
+DataTransformCommand::DataTransformCommand()
+    : rounding_flag_(kDefaultRoundingFlag),
+      warning_type_(kDefaultWarningType),
+      num_column_(kDefaultNumColumn),
+      print_format_(""),
+      data_types_(kDefaultDataTypes) {
+}
+
+DataTransformCommand::~DataTransformCommand() {
+}
+
+bool DataTransformCommand::SetOption(char option, const std::string& argument,
+                                     std::string* error_message) {
+  switch (option) {
+    case 'r': {
+      rounding_flag_ = true;
+      break;
+    }
+    case 'e': {
+      const int min(0);
+      const int max(static_cast<int>(kNumWarningTypes) - 1);
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) ||
+          !IsInRange(tmp, min, max)) {
+        std::ostringstream stream;
+        stream << "The argument for the -e option must be an integer "
+               << "in the range of " << min << " to " << max;
+        *error_message = stream.str();
+        return false;
+      }
+      warning_type_ = static_cast<WarningType>(tmp);
+      break;
+    }
+    case 'c': {
+      if (!ConvertStringToInteger(argument, &num_column_) ||
+          num_column_ <= 0) {
+        *error_message =
+            "The argument for the -c option must be a positive integer";
+        return false;
+      }
+      break;
+    }
+    case 'f': {
+      print_format_ = argument;
+      if ("%" != print_format_.substr(0, 1)) {
+        *error_message = "The argument for the -f option must be begin with %";
+        return false;
+      }
+      break;
+    }
+    default: {
+      *error_message = "Unknown option -" + std::string(1, option);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool DataTransformCommand::SetOperand(const std::string& operand,
+                                      bool* is_consumed,
+                                      std::string* error_message) {
+  *is_consumed = ('+' == operand[0]);
+  if (*is_consumed) {
+    data_types_ = operand.substr(1, std::string::npos);
+    if (2 != data_types_.size()) {
+      *error_message = "The +type option must be two characters";
+      return false;
+    }
+  }
+  return true;
+}
+
+bool DataTransformCommand::Prepare(std::string* error_message) {
+  data_transform_.reset(new DataTransformWrapper(
+      data_types_.substr(0, 1), data_types_.substr(1, 1), print_format_,
+      num_column_, warning_type_, rounding_flag_));
+  if (!data_transform_->IsValid()) {
+    *error_message = "Unexpected argument for the +type option";
+    return false;
+  }
+  return true;
+}
+
+bool DataTransformCommand::Run(std::istream* input_stream,
+                               std::ostream* output_stream,
+                               std::string* error_message) const {
+  if (NULL == data_transform_ ||
+      !data_transform_->Run(input_stream, output_stream)) {
+    *error_message = "Failed to transform";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace sptk
@@ -0,0 +1,228 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/command/frame_command.h"
+
+#include <algorithm>  // std::copy, std::fill, std::transform
+#include <numeric>    // std::accumulate
+#include <sstream>    // std::ostringstream
+
+namespace sptk {
+
+const int FrameCommand::kDefaultFrameLength(256);
+const int FrameCommand::kDefaultFramePeriod(100);
+const FrameCommand::FramingTypes FrameCommand::kDefaultFramingType(
+    kBegginingOfDataIsCenterOfFirstFrame);
+
+FrameCommand::FrameCommand()
+    : frame_length_(kDefaultFrameLength),
+      frame_period_(kDefaultFramePeriod),
+      framing_type_(kDefaultFramingType),
+      zero_mean_(false) {
+}
+
+bool FrameCommand::SetOption(char option, const std::string& argument,
+                             std::string* error_message) {
+  switch (option) {
+    case 'l': {
+      if (!ConvertStringToInteger(argument, &frame_length_) ||
+          frame_length_ <= 0) {
+        *error_message =
+            "The argument for the -l option must be a positive integer";
+        return false;
+      }
+      break;
+    }
+    case 'p': {
+      if (!ConvertStringToInteger(argument, &frame_period_) ||
+          frame_period_ <= 0) {
+        *error_message =
+            "The argument for the -p option must be a positive integer";
+        return false;
+      }
+      break;
+    }
+    case 'n': {
+      const int min(0);
+      const int max(static_cast<int>(kNumFramingTypes) - 1);
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) ||
+          !IsInRange(tmp, min, max)) {
+        std::ostringstream stream;
+        stream << "The argument for the -n option must be an integer "
+               << "in the range of " << min << " to " << max;
+        *error_message = stream.str();
+        return false;
+      }
+      framing_type_ = static_cast<FramingTypes>(tmp);
+      break;
+    }
+    case 'z': {
+      zero_mean_ = true;
+      break;
+    }
+    default: {
+      *error_message = "Unknown option -" + std::string(1, option);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FrameCommand::Prepare(std::string* error_message) {
+  return true;
+}
+
+bool FrameCommand::Run(std::istream* input_stream, std::ostream* output_stream,
+                       std::string* error_message) const {
+  std::vector<double> data(frame_length_);
+  int actual_read_size;
+
+  // Extract the first frame.
+  {
+    int read_point;
+    int read_size;
+    if (kBegginingOfDataIsCenterOfFirstFrame == framing_type_) {
+      if (0 == frame_length_ % 2) {
+        read_point = frame_length_ / 2;
+        read_size = frame_length_ / 2;
+      } else {
+        read_point = (frame_length_ - 1) / 2;
+        read_size = (frame_length_ + 1) / 2;
+      }
+    } else if (kBegginingOfDataIsStartOfFirstFrame == framing_type_) {
+      read_point = 0;
+      read_size = frame_length_;
+    } else {
+      return true;
+    }
+
+    if (!ReadStream(true, 0, read_point, read_size, &data, input_stream,
+                    &actual_read_size)) {
+      return true;
+    }
+  }
+
+  // Extract the remaining frames.
+  const int overlap(frame_length_ - frame_period_);
+  if (0 < overlap) {
+    bool is_eof(input_stream->peek() == std::ios::traits_type::eof());
+    int center;
+    if (kBegginingOfDataIsCenterOfFirstFrame == framing_type_) {
+      center = frame_length_ / 2;
+    } else if (kBegginingOfDataIsStartOfFirstFrame == framing_type_) {
+      center = 0;
+    } else {
+      return true;
+    }
+    int last_data_position_in_frame(center + actual_read_size - 1);
+    while (center <= last_data_position_in_frame) {
+      if (is_eof) {
+        std::fill(data.begin() + last_data_position_in_frame + 1, data.end(),
+                  0.0);
+      }
+
+      // Write framed data.
+      if (!WriteData(data, output_stream, error_message)) {
+        return false;
+      }
+
+      // Move overlapped data.
+      std::copy(data.begin() + frame_period_, data.end(), data.begin());
+
+      // Read next data.
+      if (is_eof) {
+        last_data_position_in_frame -= frame_period_;
+      } else {
+        if (!ReadStream(true, 0, overlap, frame_period_, &data, input_stream,
+                        &actual_read_size)) {
+          *error_message = "Failed to read data";
+          return false;
+        }
+
+        if (input_stream->peek() == std::ios::traits_type::eof()) {
+          last_data_position_in_frame = overlap + actual_read_size - 1;
+          is_eof = true;
+        }
+      }
+    }
+  } else {
+    if (!WriteData(data, output_stream, error_message)) {
+      return false;
+    }
+
+    while (ReadStream(true, -overlap, 0, frame_length_, &data, input_stream,
+                      NULL)) {
+      if (!WriteData(data, output_stream, error_message)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool FrameCommand::WriteData(const std::vector<double>& data,
+                             std::ostream* output_stream,
+                             std::string* error_message) const {
+  bool is_written;
+  if (zero_mean_) {
+    std::vector<double> processed_data(data.size());
+    const double mean(std::accumulate(data.begin(), data.end(), 0.0) /
+                      data.size());
+    std::transform(data.begin(), data.end(), processed_data.begin(),
+                   [mean](double x) { return x - mean; });
+    is_written = WriteStream(0, data.size(), processed_data, output_stream,
+                             NULL);
+  } else {
+    is_written = WriteStream(0, data.size(), data, output_stream, NULL);
+  }
+  if (!is_written) {
+    *error_message = "Failed to write data";
+  }
+  return is_written;
+}
+
+}  // namespace sptk
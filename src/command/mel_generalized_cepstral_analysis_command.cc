@@ -0,0 +1,308 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/command/mel_generalized_cepstral_analysis_command.h"
+
+#include <cfloat>   // DBL_MAX
+#include <sstream>  // std::ostringstream
+#include <vector>   // std::vector
+
+namespace sptk {
+
+const int MelGeneralizedCepstralAnalysisCommand::kDefaultNumOrder(25);
+const double MelGeneralizedCepstralAnalysisCommand::kDefaultAlpha(0.35);
+const double MelGeneralizedCepstralAnalysisCommand::kDefaultGamma(0.0);
+const int MelGeneralizedCepstralAnalysisCommand::kDefaultFftLength(256);
+const MelGeneralizedCepstralAnalysisCommand::InputFormats
+    MelGeneralizedCepstralAnalysisCommand::kDefaultInputFormat(kWaveform);
+const MelGeneralizedCepstralAnalysisCommand::OutputFormats
+    MelGeneralizedCepstralAnalysisCommand::kDefaultOutputFormat(kCepstrum);
+const int MelGeneralizedCepstralAnalysisCommand::kDefaultNumIteration(30);
+const double
+    MelGeneralizedCepstralAnalysisCommand::kDefaultConvergenceThreshold(1e-3);
+
+MelGeneralizedCepstralAnalysisCommand::MelGeneralizedCepstralAnalysisCommand()
+    : num_order_(kDefaultNumOrder),
+      alpha_(kDefaultAlpha),
+      gamma_(kDefaultGamma),
+      fft_length_(kDefaultFftLength),
+      input_format_(kDefaultInputFormat),
+      output_format_(kDefaultOutputFormat),
+      num_iteration_(kDefaultNumIteration),
+      convergence_threshold_(kDefaultConvergenceThreshold),
+      epsilon_(0.0),
+      relative_floor_in_decibels_(-DBL_MAX) {
+}
+
+bool MelGeneralizedCepstralAnalysisCommand::SetOption(
+    char option, const std::string& argument, std::string* error_message) {
+  switch (option) {
+    case 'm': {
+      if (!ConvertStringToInteger(argument, &num_order_) || num_order_ < 0) {
+        *error_message = "The argument for the -m option must be a "
+                         "non-negative integer";
+        return false;
+      }
+      break;
+    }
+    case 'a': {
+      if (!ConvertStringToDouble(argument, &alpha_) || !IsValidAlpha(alpha_)) {
+        *error_message =
+            "The argument for the -a option must be in (-1.0, 1.0)";
+        return false;
+      }
+      break;
+    }
+    case 'g': {
+      if (!ConvertStringToDouble(argument, &gamma_) || !IsValidGamma(gamma_)) {
+        *error_message =
+            "The argument for the -g option must be in [-1.0, 0.0]";
+        return false;
+      }
+      break;
+    }
+    case 'c': {
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) || tmp < 1) {
+        *error_message = "The argument for the -c option must be a "
+                         "non-negative integer";
+        return false;
+      }
+      gamma_ = -1.0 / tmp;
+      break;
+    }
+    case 'l': {
+      if (!ConvertStringToInteger(argument, &fft_length_)) {
+        *error_message = "The argument for the -l option must be an integer";
+        return false;
+      }
+      break;
+    }
+    case 'q': {
+      const int min(0);
+      const int max(static_cast<int>(kNumInputFormats) - 1);
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) ||
+          !IsInRange(tmp, min, max)) {
+        std::ostringstream stream;
+        stream << "The argument for the -q option must be an integer "
+               << "in the range of " << min << " to " << max;
+        *error_message = stream.str();
+        return false;
+      }
+      input_format_ = static_cast<InputFormats>(tmp);
+      break;
+    }
+    case 'o': {
+      const int min(0);
+      const int max(static_cast<int>(kNumOutputFormats) - 1);
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) ||
+          !IsInRange(tmp, min, max)) {
+        std::ostringstream stream;
+        stream << "The argument for the -o option must be an integer "
+               << "in the range of " << min << " to " << max;
+        *error_message = stream.str();
+        return false;
+      }
+      output_format_ = static_cast<OutputFormats>(tmp);
+      break;
+    }
+    case 'i': {
+      if (!ConvertStringToInteger(argument, &num_iteration_) ||
+          num_iteration_ < 0) {
+        *error_message = "The argument for the -i option must be a "
+                         "non-negative integer";
+        return false;
+      }
+      break;
+    }
+    case 'd': {
+      if (!ConvertStringToDouble(argument, &convergence_threshold_) ||
+          convergence_threshold_ < 0.0) {
+        *error_message =
+            "The argument for the -d option must be a non-negative number";
+        return false;
+      }
+      break;
+    }
+    case 'e': {
+      if (!ConvertStringToDouble(argument, &epsilon_) || epsilon_ <= 0.0) {
+        *error_message =
+            "The argument for the -e option must be a positive number";
+        return false;
+      }
+      break;
+    }
+    case 'E': {
+      if (!ConvertStringToDouble(argument, &relative_floor_in_decibels_) ||
+          0.0 <= relative_floor_in_decibels_) {
+        *error_message =
+            "The argument for the -E option must be a negative number";
+        return false;
+      }
+      break;
+    }
+    default: {
+      *error_message = "Unknown option -" + std::string(1, option);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MelGeneralizedCepstralAnalysisCommand::Prepare(
+    std::string* error_message) {
+  if (kWaveform != input_format_) {
+    spectrum_to_spectrum_.reset(new SpectrumToSpectrum(
+        fft_length_,
+        static_cast<SpectrumToSpectrum::InputOutputFormats>(input_format_),
+        SpectrumToSpectrum::InputOutputFormats::kPowerSpectrum, epsilon_,
+        relative_floor_in_decibels_));
+    if (!spectrum_to_spectrum_->IsValid()) {
+      *error_message = "Failed to set condition for input formatting";
+      return false;
+    }
+  } else {
+    waveform_to_spectrum_.reset(new WaveformToSpectrum(
+        fft_length_, fft_length_,
+        SpectrumToSpectrum::InputOutputFormats::kPowerSpectrum, epsilon_,
+        relative_floor_in_decibels_));
+    if (!waveform_to_spectrum_->IsValid()) {
+      *error_message = "Failed to set condition for spectral analysis";
+      return false;
+    }
+  }
+
+  analysis_.reset(new MelGeneralizedCepstralAnalysis(
+      fft_length_, num_order_, alpha_, gamma_, num_iteration_,
+      convergence_threshold_));
+  if (!analysis_->IsValid()) {
+    *error_message = "Failed to set condition for cepstral analysis";
+    return false;
+  }
+
+  mel_cepstrum_to_mlsa_digital_filter_coefficients_.reset(
+      new MelCepstrumToMlsaDigitalFilterCoefficients(num_order_, alpha_));
+  if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_->IsValid()) {
+    *error_message = "Failed to set condition for output formatting";
+    return false;
+  }
+
+  generalized_cepstrum_gain_normalization_.reset(
+      new GeneralizedCepstrumGainNormalization(num_order_, gamma_));
+  if (!generalized_cepstrum_gain_normalization_->IsValid()) {
+    *error_message = "Failed to set condition for gain normalization";
+    return false;
+  }
+
+  return true;
+}
+
+bool MelGeneralizedCepstralAnalysisCommand::Run(
+    std::istream* input_stream, std::ostream* output_stream,
+    std::string* error_message) const {
+  if (NULL == generalized_cepstrum_gain_normalization_) {
+    *error_message = "Command is not prepared";
+    return false;
+  }
+
+  WaveformToSpectrum::Buffer buffer_for_spectral_analysis;
+  MelGeneralizedCepstralAnalysis::Buffer buffer_for_cepstral_analysis;
+
+  const int input_length(kWaveform == input_format_ ? fft_length_
+                                                    : fft_length_ / 2 + 1);
+  const int output_length(num_order_ + 1);
+  std::vector<double> input(input_length);
+  std::vector<double> processed_input(fft_length_ / 2 + 1);
+  std::vector<double> output(output_length);
+
+  while (ReadStream(false, 0, 0, input_length, &input, input_stream, NULL)) {
+    if (kWaveform != input_format_) {
+      if (!spectrum_to_spectrum_->Run(input, &processed_input)) {
+        *error_message = "Failed to convert spectrum";
+        return false;
+      }
+    } else {
+      if (!waveform_to_spectrum_->Run(input, &processed_input,
+                                      &buffer_for_spectral_analysis)) {
+        *error_message = "Failed to transform waveform to spectrum";
+        return false;
+      }
+    }
+
+    if (!analysis_->Run(processed_input, &output,
+                        &buffer_for_cepstral_analysis)) {
+      *error_message = "Failed to run mel-generalized cepstral analysis";
+      return false;
+    }
+
+    if (0.0 != alpha_ &&
+        (kMlsaFilterCoefficients == output_format_ ||
+         kGainNormalizedMlsaFilterCoefficients == output_format_)) {
+      if (!mel_cepstrum_to_mlsa_digital_filter_coefficients_->Run(&output)) {
+        *error_message = "Failed to convert to MLSA filter coefficients";
+        return false;
+      }
+    }
+
+    if (kGainNormalizedCepstrum == output_format_ ||
+        kGainNormalizedMlsaFilterCoefficients == output_format_) {
+      if (!generalized_cepstrum_gain_normalization_->Run(&output)) {
+        *error_message = "Failed to normalize generalized cepstrum";
+        return false;
+      }
+    }
+
+    if (!WriteStream(0, output_length, output, output_stream, NULL)) {
+      *error_message = "Failed to write mel-generalized cepstrum";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace sptk
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/command/window_command.h"
+
+#include <sstream>  // std::ostringstream
+#include <vector>   // std::vector
+
+namespace sptk {
+
+const int WindowCommand::kDefaultFrameLength(256);
+const DataWindowing::NormalizationType WindowCommand::kDefaultNormalizationType(
+    DataWindowing::NormalizationType::kPower);
+const StandardWindow::WindowType WindowCommand::kDefaultWindowType(
+    StandardWindow::WindowType::kBlackman);
+
+WindowCommand::WindowCommand()
+    : input_length_(kDefaultFrameLength),
+      output_length_(kDefaultFrameLength),
+      is_output_length_specified_(false),
+      normalization_type_(kDefaultNormalizationType),
+      window_type_(kDefaultWindowType) {
+}
+
+bool WindowCommand::SetOption(char option, const std::string& argument,
+                              std::string* error_message) {
+  switch (option) {
+    case 'l': {
+      if (!ConvertStringToInteger(argument, &input_length_) ||
+          input_length_ <= 0) {
+        *error_message =
+            "The argument for the -l option must be a positive integer";
+        return false;
+      }
+      break;
+    }
+    case 'L': {
+      if (!ConvertStringToInteger(argument, &output_length_) ||
+          output_length_ <= 0) {
+        *error_message =
+            "The argument for the -L option must be a positive integer";
+        return false;
+      }
+      is_output_length_specified_ = true;
+      break;
+    }
+    case 'n': {
+      const int min(0);
+      const int max(
+          static_cast<int>(DataWindowing::kNumNormalizationTypes) - 1);
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) ||
+          !IsInRange(tmp, min, max)) {
+        std::ostringstream stream;
+        stream << "The argument for the -n option must be an integer "
+               << "in the range of " << min << " to " << max;
+        *error_message = stream.str();
+        return false;
+      }
+      normalization_type_ = static_cast<DataWindowing::NormalizationType>(tmp);
+      break;
+    }
+    case 'w': {
+      const StandardWindow::WindowType window_types[] = {
+          StandardWindow::kBlackman,    StandardWindow::kHamming,
+          StandardWindow::kHanning,     StandardWindow::kBartlett,
+          StandardWindow::kTrapezoidal, StandardWindow::kRectangular,
+      };
+      const int min(0);
+      const int max(sizeof(window_types) / sizeof(window_types[0]) - 1);
+      int tmp;
+      if (!ConvertStringToInteger(argument, &tmp) ||
+          !IsInRange(tmp, min, max)) {
+        std::ostringstream stream;
+        stream << "The argument for the -w option must be an integer "
+               << "in the range of " << min << " to " << max;
+        *error_message = stream.str();
+        return false;
+      }
+      window_type_ = window_types[tmp];
+      break;
+    }
+    default: {
+      *error_message = "Unknown option -" + std::string(1, option);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool WindowCommand::Prepare(std::string* error_message) {
+  if (!is_output_length_specified_) {
+    output_length_ = input_length_;
+  } else if (output_length_ < input_length_) {
+    std::ostringstream stream;
+    stream << "The length of data sequence " << input_length_
+           << " must be equal to or less than that of windowed one "
+           << output_length_;
+    *error_message = stream.str();
+    return false;
+  }
+
+  standard_window_.reset(
+      new StandardWindow(input_length_, window_type_, false));
+  data_windowing_.reset(new DataWindowing(standard_window_.get(),
+                                          output_length_, normalization_type_));
+  if (!data_windowing_->IsValid()) {
+    *error_message = "Failed to initialize DataWindowing";
+    return false;
+  }
+
+  return true;
+}
+
+bool WindowCommand::Run(std::istream* input_stream, std::ostream* output_stream,
+                        std::string* error_message) const {
+  if (NULL == data_windowing_) {
+    *error_message = "Command is not prepared";
+    return false;
+  }
+
+  std::vector<double> data_sequence(input_length_);
+  std::vector<double> windowed_data_sequence(output_length_);
+
+  while (ReadStream(false, 0, 0, input_length_, &data_sequence, input_stream,
+                    NULL)) {
+    if (!data_windowing_->Run(data_sequence, &windowed_data_sequence)) {
+      *error_message = "Failed to apply a window function";
+      return false;
+    }
+
+    if (!WriteStream(0, output_length_, windowed_data_sequence, output_stream,
+                     NULL)) {
+      *error_message = "Failed to write windowed data sequence";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace sptk
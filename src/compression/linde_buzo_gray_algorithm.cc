@@ -44,12 +44,21 @@
 
 #include "SPTK/compression/linde_buzo_gray_algorithm.h"
 
+#include <atomic>   // std::atomic
 #include <cfloat>   // DBL_MAX
 #include <cmath>    // std::fabs
 #include <cstddef>  // std::size_t
 
 #include "SPTK/generation/normal_distributed_random_value_generation.h"
 
+namespace {
+
+// Number of input vectors quantized in one task. This also fixes the order of
+// summation of distances.
+const int kGrainSize(256);
+
+}  // namespace
+
 namespace sptk {
 
 LindeBuzoGrayAlgorithm::LindeBuzoGrayAlgorithm(
@@ -83,7 +92,7 @@ LindeBuzoGrayAlgorithm::LindeBuzoGrayAlgorithm(
 bool LindeBuzoGrayAlgorithm::Run(
     const std::vector<std::vector<double> >& input_vectors,
     std::vector<std::vector<double> >* codebook_vectors,
-    std::vector<int>* codebook_indices) const {
+    std::vector<int>* codebook_indices, ThreadPool* thread_pool) const {
   // Check inputs.
   const int num_input_vector(static_cast<int>(input_vectors.size()));
   if (!is_valid_ ||
@@ -99,6 +108,10 @@ bool LindeBuzoGrayAlgorithm::Run(
     codebook_indices->resize(num_input_vector);
   }
   std::vector<StatisticsAccumulation::Buffer> buffers(target_codebook_size_);
+  ThreadPool single_thread_pool(1);
+  if (NULL == thread_pool) {
+    thread_pool = &single_thread_pool;
+  }
 
   // Prepare random value generator.
   NormalDistributedRandomValueGeneration random_value_generation(seed_);
@@ -134,31 +147,43 @@ bool LindeBuzoGrayAlgorithm::Run(
     double prev_total_distance(DBL_MAX);
     for (int n(0); n < num_iteration_; ++n) {
       // Initialize.
-      double total_distance(0.0);
       for (int i(0); i < current_codebook_size; ++i) {
         statistics_accumulation_.Clear(&(buffers[i]));
       }
 
-      // Accumulate statistics (E-step).
-      for (int t(0); t < num_input_vector; ++t) {
-        int index;
-        if (!vector_quantization_.Run(input_vectors[t], *codebook_vectors,
-                                      &index)) {
-          return false;
-        }
-        (*codebook_indices)[t] = index;
-
-        if (!statistics_accumulation_.Run(input_vectors[t],
-                                          &(buffers[index]))) {
-          return false;
-        }
+      // Quantize input vectors (E-step).
+      std::atomic<bool> is_failed(false);
+      double total_distance(thread_pool->ParallelReduce(
+          0, num_input_vector, kGrainSize, 0.0,
+          [&](int first, int last) {
+            double sum(0.0);
+            for (int t(first); t < last; ++t) {
+              int index;
+              double distance;
+              if (!vector_quantization_.Run(input_vectors[t],
+                                            *codebook_vectors, &index) ||
+                  !distance_calculation_.Run(input_vectors[t],
+                                             (*codebook_vectors)[index],
+                                             &distance)) {
+                is_failed = true;
+                return sum;
+              }
+              (*codebook_indices)[t] = index;
+              sum += distance;
+            }
+            return sum;
+          },
+          [](double left, double right) { return left + right; }));
+      if (is_failed) {
+        return false;
+      }
 
-        double distance;
-        if (!distance_calculation_.Run(input_vectors[t],
-                                       (*codebook_vectors)[index], &distance)) {
+      // Accumulate statistics in the input order.
+      for (int t(0); t < num_input_vector; ++t) {
+        if (!statistics_accumulation_.Run(
+                input_vectors[t], &(buffers[(*codebook_indices)[t]]))) {
           return false;
         }
-        total_distance += distance;
       }
       total_distance /= num_input_vector;
 
@@ -0,0 +1,362 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/compression/lossless_feature_decoding.h"
+
+#include <algorithm>  // std::max, std::min, std::sort
+#include <climits>    // INT_MAX
+#include <cstdint>    // int32_t, int64_t, uint32_t, uint64_t
+#include <cstring>    // std::memcmp, std::memcpy
+#include <utility>    // std::make_pair, std::pair
+
+#include "SPTK/compression/lossless_feature_format.h"
+
+namespace {
+
+using sptk::lossless_feature_format::kChunkHeaderSize;
+using sptk::lossless_feature_format::kConstant;
+using sptk::lossless_feature_format::kDataTypeOffset;
+using sptk::lossless_feature_format::kFormatVersion;
+using sptk::lossless_feature_format::kHeaderSize;
+using sptk::lossless_feature_format::kHuffman;
+using sptk::lossless_feature_format::kMagic;
+using sptk::lossless_feature_format::kMagicSize;
+using sptk::lossless_feature_format::kMaxCodeLength;
+using sptk::lossless_feature_format::kNumSymbol;
+using sptk::lossless_feature_format::kRaw;
+using sptk::lossless_feature_format::kVectorLengthOffset;
+using sptk::lossless_feature_format::kVersionOffset;
+
+// Size of the first read of a chunk, which is doubled at each read.
+const int kMinChunkReadSize(1 << 20);
+
+// Build lookup table whose entry for every 12-bit prefix holds the decoded
+// symbol in the lower 8 bits and the code length in the upper bits.
+bool BuildTable(const unsigned char* code_lengths, std::vector<uint32_t>* table) {
+  std::vector<std::pair<int, int> > order;
+  for (int i(0); i < kNumSymbol; ++i) {
+    if (kMaxCodeLength < code_lengths[i]) return false;
+    if (0 < code_lengths[i]) {
+      order.push_back(std::make_pair(code_lengths[i], i));
+    }
+  }
+  if (order.empty()) return false;
+  std::sort(order.begin(), order.end());
+
+  table->assign(1 << kMaxCodeLength, 0);
+  uint32_t code(0);
+  int previous_length(0);
+  for (std::size_t i(0); i < order.size(); ++i) {
+    const int length(order[i].first);
+    code <<= length - previous_length;
+    const int shift(kMaxCodeLength - length);
+    const uint32_t first(code << shift);
+    const uint32_t last((code + 1) << shift);
+    if ((1u << kMaxCodeLength) < last) return false;
+    for (uint32_t j(first); j < last; ++j) {
+      (*table)[j] = (length << 8) | order[i].second;
+    }
+    ++code;
+    previous_length = length;
+  }
+  return true;
+}
+
+// Decode one byte plane and return the pointer to the next plane, or NULL on
+// failure.
+const char* DecodePlane(const char* p, const char* end, int num_element,
+                        unsigned char* plane, std::vector<uint32_t>* table) {
+  if (end <= p) return NULL;
+  const int type(static_cast<unsigned char>(*p++));
+
+  if (kRaw == type) {
+    if (end - p < num_element) return NULL;
+    std::memcpy(plane, p, num_element);
+    return p + num_element;
+  } else if (kConstant == type) {
+    if (end - p < 1) return NULL;
+    std::memset(plane, static_cast<unsigned char>(*p), num_element);
+    return p + 1;
+  } else if (kHuffman != type) {
+    return NULL;
+  }
+
+  if (end - p < kNumSymbol / 2 + 4) return NULL;
+  unsigned char code_lengths[kNumSymbol];
+  for (int i(0); i < kNumSymbol; i += 2) {
+    const unsigned char packed_lengths(static_cast<unsigned char>(*p++));
+    code_lengths[i] = packed_lengths >> 4;
+    code_lengths[i + 1] = packed_lengths & 0x0f;
+  }
+  if (!BuildTable(code_lengths, table)) {
+    return NULL;
+  }
+  uint32_t size;
+  std::memcpy(&size, p, sizeof(size));
+  p += sizeof(size);
+  if (end - p < static_cast<int64_t>(size)) return NULL;
+
+  const unsigned char* bits(reinterpret_cast<const unsigned char*>(p));
+  const unsigned char* bits_end(bits + size);
+  const uint32_t* lookup(&(*table)[0]);
+  uint64_t accumulator(0);
+  int num_accumulated_bits(0);
+  for (int i(0); i < num_element; ++i) {
+    // Refill; bits after the end are read as zero.
+    while (num_accumulated_bits <= 56) {
+      accumulator <<= 8;
+      if (bits < bits_end) accumulator |= *bits++;
+      num_accumulated_bits += 8;
+    }
+    const uint32_t entry(lookup[(accumulator >>
+                                 (num_accumulated_bits - kMaxCodeLength)) &
+                                ((1 << kMaxCodeLength) - 1)]);
+    if (0 == entry) return NULL;
+    plane[i] = static_cast<unsigned char>(entry & 0xff);
+    num_accumulated_bits -= static_cast<int>(entry >> 8);
+  }
+  return p + size;
+}
+
+// Check that the byte planes of a chunk fit in it before the memory to decode
+// them is allocated. Every element of a plane other than a constant one takes
+// at least one bit.
+bool CheckPlanes(const char* p, const char* end, int num_element,
+                 int num_plane) {
+  for (int k(0); k < num_plane; ++k) {
+    if (end <= p) return false;
+    const int type(static_cast<unsigned char>(*p++));
+    int64_t size;
+    if (kRaw == type) {
+      size = num_element;
+    } else if (kConstant == type) {
+      size = 1;
+    } else if (kHuffman == type) {
+      if (end - p < kNumSymbol / 2 + 4) return false;
+      uint32_t bits_size;
+      std::memcpy(&bits_size, p + kNumSymbol / 2, sizeof(bits_size));
+      if (static_cast<int64_t>(bits_size) * 8 < num_element) return false;
+      size = kNumSymbol / 2 + 4 + static_cast<int64_t>(bits_size);
+    } else {
+      return false;
+    }
+    if (end - p < size) return false;
+    p += size;
+  }
+  return p == end;
+}
+
+template <typename W>
+void Compose(const unsigned char* planes, int num_element, int vector_length,
+             char* frames) {
+  const int word_size(static_cast<int>(sizeof(W)));
+  for (int i(0); i < num_element; ++i) {
+    W x(0);
+    for (int k(word_size - 1); 0 <= k; --k) {
+      x = (x << 8) | planes[k * num_element + i];
+    }
+    if (vector_length <= i) {
+      W previous;
+      std::memcpy(&previous, frames + (i - vector_length) * word_size,
+                  word_size);
+      x ^= previous;
+    }
+    std::memcpy(frames + i * word_size, &x, word_size);
+  }
+}
+
+}  // namespace
+
+namespace sptk {
+
+LosslessFeatureDecoding::LosslessFeatureDecoding(std::istream* input_stream)
+    : vector_length_(0), word_size_(0), is_valid_(true) {
+  char header[kHeaderSize];
+  if (NULL == input_stream) {
+    is_valid_ = false;
+    return;
+  }
+  input_stream->read(header, kHeaderSize);
+  if (kHeaderSize != input_stream->gcount() ||
+      0 != std::memcmp(header, kMagic, kMagicSize)) {
+    is_valid_ = false;
+    return;
+  }
+
+  int32_t version;
+  std::memcpy(&version, header + kVersionOffset, sizeof(version));
+  int32_t vector_length;
+  std::memcpy(&vector_length, header + kVectorLengthOffset,
+              sizeof(vector_length));
+  vector_length_ = vector_length;
+  data_type_ = std::string(1, header[kDataTypeOffset]);
+  if ("d" == data_type_) {
+    word_size_ = static_cast<int>(sizeof(uint64_t));
+  } else if ("f" == data_type_) {
+    word_size_ = static_cast<int>(sizeof(uint32_t));
+  }
+
+  if (kFormatVersion != version || vector_length_ <= 0 || 0 == word_size_ ||
+      INT_MAX / word_size_ < vector_length_) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool LosslessFeatureDecoding::Run(
+    std::istream* input_stream, std::vector<char>* frames, int* num_frame,
+    LosslessFeatureDecoding::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == input_stream || NULL == frames ||
+      NULL == num_frame || NULL == buffer) {
+    return false;
+  }
+
+  // Read chunk.
+  int32_t chunk_header[2];
+  input_stream->read(reinterpret_cast<char*>(chunk_header), kChunkHeaderSize);
+  if (kChunkHeaderSize != input_stream->gcount()) {
+    return false;
+  }
+  const int32_t num_frame_in_chunk(chunk_header[0]);
+  const int32_t chunk_size(chunk_header[1]);
+  if (num_frame_in_chunk <= 0 || chunk_size <= 0) {
+    return false;
+  }
+
+  // The encoder never writes more than INT_MAX bytes of frames in a chunk, and
+  // never writes a byte plane larger than the raw one.
+  const int64_t num_element_in_chunk(static_cast<int64_t>(num_frame_in_chunk) *
+                                     vector_length_);
+  if (INT_MAX / word_size_ < num_element_in_chunk ||
+      (num_element_in_chunk + 1) * word_size_ < chunk_size) {
+    return false;
+  }
+  const int num_element(static_cast<int>(num_element_in_chunk));
+
+  // Grow the buffer only as the chunk arrives, so that a broken chunk size
+  // does not allocate memory beyond the rest of the input.
+  for (int read_size(0); read_size < chunk_size;) {
+    const int size(std::min(chunk_size - read_size,
+                            std::max(read_size, kMinChunkReadSize)));
+    if (buffer->chunk_.size() < static_cast<std::size_t>(read_size + size)) {
+      buffer->chunk_.resize(read_size + size);
+    }
+    input_stream->read(&buffer->chunk_[read_size], size);
+    if (size != input_stream->gcount()) {
+      return false;
+    }
+    read_size += size;
+  }
+
+  const char* p(&buffer->chunk_[0]);
+  const char* end(p + chunk_size);
+  if (!CheckPlanes(p, end, num_element, word_size_)) {
+    return false;
+  }
+
+  // Prepare memories.
+  const std::size_t frames_size(static_cast<std::size_t>(num_element) *
+                                word_size_);
+  if (buffer->planes_.size() < frames_size) {
+    buffer->planes_.resize(frames_size);
+  }
+  if (frames->size() < frames_size) {
+    frames->resize(frames_size);
+  }
+
+  // Decode byte planes.
+  for (int k(0); k < word_size_; ++k) {
+    p = DecodePlane(p, end, num_element, &buffer->planes_[k * num_element],
+                    &buffer->table_);
+    if (NULL == p) {
+      return false;
+    }
+  }
+  if (p != end) {
+    return false;
+  }
+
+  // Restore values.
+  if (sizeof(uint64_t) == static_cast<std::size_t>(word_size_)) {
+    Compose<uint64_t>(&buffer->planes_[0], num_element, vector_length_,
+                      &(*frames)[0]);
+  } else {
+    Compose<uint32_t>(&buffer->planes_[0], num_element, vector_length_,
+                      &(*frames)[0]);
+  }
+
+  *num_frame = num_frame_in_chunk;
+  return true;
+}
+
+bool LosslessFeatureDecoding::Skip(std::istream* input_stream,
+                                   int* num_frame) const {
+  if (!is_valid_ || NULL == input_stream || NULL == num_frame) {
+    return false;
+  }
+
+  int32_t chunk_header[2];
+  input_stream->read(reinterpret_cast<char*>(chunk_header), kChunkHeaderSize);
+  if (kChunkHeaderSize != input_stream->gcount() || chunk_header[0] <= 0 ||
+      chunk_header[1] < 0) {
+    return false;
+  }
+  const std::streamoff chunk_size(chunk_header[1]);
+
+  // Seek if possible, otherwise read through.
+  std::streamoff remaining_size;
+  if (sptk::GetRemainingStreamSize(input_stream, &remaining_size)) {
+    if (remaining_size < chunk_size) return false;
+    input_stream->seekg(chunk_size, std::ios::cur);
+  } else {
+    input_stream->ignore(chunk_size);
+    if (chunk_size != input_stream->gcount()) return false;
+  }
+
+  *num_frame = chunk_header[0];
+  return !input_stream->fail();
+}
+
+}  // namespace sptk
@@ -0,0 +1,307 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/compression/lossless_feature_encoding.h"
+
+#include <algorithm>   // std::sort
+#include <climits>     // INT_MAX
+#include <cstdint>     // int32_t, int64_t, uint32_t, uint64_t
+#include <cstring>     // std::memcpy, std::memset
+#include <functional>  // std::greater
+#include <queue>       // std::priority_queue
+#include <utility>     // std::make_pair, std::pair
+
+#include "SPTK/compression/lossless_feature_format.h"
+
+namespace {
+
+using sptk::lossless_feature_format::kConstant;
+using sptk::lossless_feature_format::kDataTypeOffset;
+using sptk::lossless_feature_format::kFormatVersion;
+using sptk::lossless_feature_format::kHeaderSize;
+using sptk::lossless_feature_format::kHuffman;
+using sptk::lossless_feature_format::kMagic;
+using sptk::lossless_feature_format::kMagicSize;
+using sptk::lossless_feature_format::kMaxCodeLength;
+using sptk::lossless_feature_format::kNumSymbol;
+using sptk::lossless_feature_format::kRaw;
+using sptk::lossless_feature_format::kVectorLengthOffset;
+using sptk::lossless_feature_format::kVersionOffset;
+
+// Calculate code lengths of Huffman code. If the longest code exceeds the
+// limit, the frequencies are flattened and the code is built again.
+void CalculateCodeLengths(const int* frequencies, int* code_lengths) {
+  std::vector<int> scaled_frequencies(frequencies, frequencies + kNumSymbol);
+  for (;;) {
+    // Nodes 0..255 are leaves and the others are internal nodes.
+    std::vector<int> parents(2 * kNumSymbol, -1);
+    std::priority_queue<std::pair<int64_t, int>,
+                        std::vector<std::pair<int64_t, int> >,
+                        std::greater<std::pair<int64_t, int> > >
+        queue;
+    for (int i(0); i < kNumSymbol; ++i) {
+      if (0 < scaled_frequencies[i]) {
+        queue.push(std::make_pair(scaled_frequencies[i], i));
+      }
+    }
+    int num_node(kNumSymbol);
+    while (1 < queue.size()) {
+      const std::pair<int64_t, int> a(queue.top());
+      queue.pop();
+      const std::pair<int64_t, int> b(queue.top());
+      queue.pop();
+      parents[a.second] = num_node;
+      parents[b.second] = num_node;
+      queue.push(std::make_pair(a.first + b.first, num_node));
+      ++num_node;
+    }
+
+    int max_code_length(0);
+    for (int i(0); i < kNumSymbol; ++i) {
+      int length(0);
+      if (0 < scaled_frequencies[i]) {
+        for (int node(i); -1 != parents[node]; node = parents[node]) {
+          ++length;
+        }
+        // A single symbol still needs one bit.
+        if (0 == length) length = 1;
+      }
+      code_lengths[i] = length;
+      if (max_code_length < length) max_code_length = length;
+    }
+    if (max_code_length <= kMaxCodeLength) return;
+
+    for (int i(0); i < kNumSymbol; ++i) {
+      if (0 < scaled_frequencies[i]) {
+        scaled_frequencies[i] = (scaled_frequencies[i] + 1) / 2;
+      }
+    }
+  }
+}
+
+// Assign canonical codes in the order of code length and symbol.
+void AssignCanonicalCodes(const int* code_lengths, uint32_t* codes) {
+  std::vector<std::pair<int, int> > order;
+  for (int i(0); i < kNumSymbol; ++i) {
+    if (0 < code_lengths[i]) {
+      order.push_back(std::make_pair(code_lengths[i], i));
+    }
+  }
+  std::sort(order.begin(), order.end());
+
+  uint32_t code(0);
+  int previous_length(0);
+  for (std::size_t i(0); i < order.size(); ++i) {
+    code <<= order[i].first - previous_length;
+    codes[order[i].second] = code;
+    ++code;
+    previous_length = order[i].first;
+  }
+}
+
+// Append one byte plane to the payload.
+void EncodePlane(const unsigned char* plane, int num_element,
+                 std::vector<char>* payload) {
+  int frequencies[kNumSymbol] = {0};
+  for (int i(0); i < num_element; ++i) {
+    ++frequencies[plane[i]];
+  }
+
+  if (num_element == frequencies[plane[0]]) {
+    payload->push_back(static_cast<char>(kConstant));
+    payload->push_back(static_cast<char>(plane[0]));
+    return;
+  }
+
+  int code_lengths[kNumSymbol];
+  CalculateCodeLengths(frequencies, code_lengths);
+  int64_t num_bits(0);
+  for (int i(0); i < kNumSymbol; ++i) {
+    num_bits += static_cast<int64_t>(frequencies[i]) * code_lengths[i];
+  }
+  const int64_t num_bytes((num_bits + 7) / 8);
+
+  if (num_element <= kNumSymbol / 2 + 4 + num_bytes) {
+    payload->push_back(static_cast<char>(kRaw));
+    payload->insert(payload->end(), reinterpret_cast<const char*>(plane),
+                    reinterpret_cast<const char*>(plane) + num_element);
+    return;
+  }
+
+  uint32_t codes[kNumSymbol];
+  AssignCanonicalCodes(code_lengths, codes);
+
+  // Two code lengths are packed into one byte.
+  payload->push_back(static_cast<char>(kHuffman));
+  for (int i(0); i < kNumSymbol; i += 2) {
+    payload->push_back(
+        static_cast<char>((code_lengths[i] << 4) | code_lengths[i + 1]));
+  }
+  const uint32_t size(static_cast<uint32_t>(num_bytes));
+  const char* size_bytes(reinterpret_cast<const char*>(&size));
+  payload->insert(payload->end(), size_bytes, size_bytes + sizeof(size));
+
+  // Write codes from the most significant bit.
+  uint64_t accumulator(0);
+  int num_accumulated_bits(0);
+  for (int i(0); i < num_element; ++i) {
+    accumulator = (accumulator << code_lengths[plane[i]]) | codes[plane[i]];
+    num_accumulated_bits += code_lengths[plane[i]];
+    while (8 <= num_accumulated_bits) {
+      num_accumulated_bits -= 8;
+      payload->push_back(
+          static_cast<char>((accumulator >> num_accumulated_bits) & 0xff));
+    }
+  }
+  if (0 < num_accumulated_bits) {
+    payload->push_back(static_cast<char>(
+        (accumulator << (8 - num_accumulated_bits)) & 0xff));
+  }
+}
+
+template <typename W>
+void CalculateResiduals(const char* frames, int num_element,
+                        int vector_length, uint64_t* residuals) {
+  const int word_size(static_cast<int>(sizeof(W)));
+  for (int i(0); i < num_element; ++i) {
+    W x;
+    std::memcpy(&x, frames + i * word_size, word_size);
+    if (vector_length <= i) {
+      W previous;
+      std::memcpy(&previous, frames + (i - vector_length) * word_size,
+                  word_size);
+      x ^= previous;
+    }
+    residuals[i] = x;
+  }
+}
+
+}  // namespace
+
+namespace sptk {
+
+LosslessFeatureEncoding::LosslessFeatureEncoding(int vector_length,
+                                                 const std::string& data_type)
+    : vector_length_(vector_length),
+      data_type_(data_type),
+      word_size_(0),
+      is_valid_(true) {
+  if ("d" == data_type_) {
+    word_size_ = static_cast<int>(sizeof(uint64_t));
+  } else if ("f" == data_type_) {
+    word_size_ = static_cast<int>(sizeof(uint32_t));
+  }
+
+  if (vector_length_ <= 0 || 0 == word_size_ ||
+      INT_MAX / word_size_ < vector_length_) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool LosslessFeatureEncoding::WriteHeader(std::ostream* output_stream) const {
+  if (!is_valid_ || NULL == output_stream) {
+    return false;
+  }
+
+  char header[kHeaderSize];
+  std::memset(header, 0, kHeaderSize);
+  std::memcpy(header, kMagic, kMagicSize);
+  std::memcpy(header + kVersionOffset, &kFormatVersion,
+              sizeof(kFormatVersion));
+  header[kDataTypeOffset] = data_type_[0];
+  const int32_t vector_length(vector_length_);
+  std::memcpy(header + kVectorLengthOffset, &vector_length,
+              sizeof(vector_length));
+  output_stream->write(header, kHeaderSize);
+
+  return !output_stream->fail();
+}
+
+bool LosslessFeatureEncoding::Run(
+    const char* frames, int num_frame, std::ostream* output_stream,
+    LosslessFeatureEncoding::Buffer* buffer) const {
+  // Check inputs.
+  if (!is_valid_ || NULL == frames || num_frame <= 0 ||
+      INT_MAX / word_size_ / vector_length_ < num_frame ||
+      NULL == output_stream || NULL == buffer) {
+    return false;
+  }
+
+  // Prepare memories.
+  const int num_element(num_frame * vector_length_);
+  if (buffer->residuals_.size() < static_cast<std::size_t>(num_element)) {
+    buffer->residuals_.resize(num_element);
+    buffer->plane_.resize(num_element);
+  }
+  buffer->payload_.clear();
+
+  uint64_t* residuals(&buffer->residuals_[0]);
+  if (sizeof(uint64_t) == static_cast<std::size_t>(word_size_)) {
+    CalculateResiduals<uint64_t>(frames, num_element, vector_length_,
+                                 residuals);
+  } else {
+    CalculateResiduals<uint32_t>(frames, num_element, vector_length_,
+                                 residuals);
+  }
+
+  // Encode byte planes from the least significant one.
+  unsigned char* plane(&buffer->plane_[0]);
+  for (int k(0); k < word_size_; ++k) {
+    for (int i(0); i < num_element; ++i) {
+      plane[i] = static_cast<unsigned char>((residuals[i] >> (8 * k)) & 0xff);
+    }
+    EncodePlane(plane, num_element, &buffer->payload_);
+  }
+
+  const int32_t chunk_header[2] = {
+      num_frame, static_cast<int32_t>(buffer->payload_.size())};
+  output_stream->write(reinterpret_cast<const char*>(chunk_header),
+                       sizeof(chunk_header));
+  output_stream->write(&buffer->payload_[0], buffer->payload_.size());
+
+  return !output_stream->fail();
+}
+
+}  // namespace sptk
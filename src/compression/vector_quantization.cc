@@ -47,6 +47,8 @@
 #include <cfloat>   // DBL_MAX
 #include <cstddef>  // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
 namespace sptk {
 
 VectorQuantization::VectorQuantization(int num_order)
@@ -64,6 +66,7 @@ bool VectorQuantization::Run(
     const std::vector<double>& input_vector,
     const std::vector<std::vector<double> >& codebook_vectors,
     int* codebook_index) const {
+  SPTK_PROFILE_SCOPE("VectorQuantization::Run");
   // Check inputs.
   const int codebook_size(static_cast<int>(codebook_vectors.size()));
   if (!is_valid_ ||
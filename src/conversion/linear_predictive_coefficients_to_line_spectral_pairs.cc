@@ -44,11 +44,14 @@
 
 #include "SPTK/conversion/linear_predictive_coefficients_to_line_spectral_pairs.h"
 
-#include <cmath>    // std::acos, std::ceil, std::fabs, std::floor
+#include <cmath>    // std::acos, std::ceil, std::cos, std::fabs, std::floor
 #include <cstddef>  // std::size_t
 
 namespace {
 
+// Number of grid points evaluated at once.
+const int kNumLane(4);
+
 double CalculateChebyshevPolynomial(const std::vector<double>& coefficients,
                                     double x) {
   const double* c(&coefficients[0]);
@@ -62,6 +65,49 @@ double CalculateChebyshevPolynomial(const std::vector<double>& coefficients,
   return x * b1 - b2 + c[0];
 }
 
+// Evaluate the polynomial at several points at once. The Clenshaw recurrence
+// of each point is the same as the above one.
+void CalculateChebyshevPolynomials(const std::vector<double>& coefficients,
+                                   const double* x, double* y) {
+  const double* c(&coefficients[0]);
+  double b2[kNumLane] = {0.0};
+  double b1[kNumLane] = {0.0};
+  for (int i(static_cast<int>(coefficients.size()) - 1); 0 < i; --i) {
+    for (int l(0); l < kNumLane; ++l) {
+      const double b0(2.0 * x[l] * b1[l] - b2[l] + c[i]);
+      b2[l] = b1[l];
+      b1[l] = b0;
+    }
+  }
+  for (int l(0); l < kNumLane; ++l) {
+    y[l] = x[l] * b1[l] - b2[l] + c[0];
+  }
+}
+
+// Refine a root in [x_lower, x_upper] by bisection and linear interpolation.
+double RefineRoot(const std::vector<double>& coefficients, double x_lower,
+                  double x_upper, double y_lower, double y_upper,
+                  int num_iteration, double convergence_threshold) {
+  for (int n(0); n < num_iteration; ++n) {
+    const double x_mid((x_lower + x_upper) * 0.5);
+    const double y_mid(CalculateChebyshevPolynomial(coefficients, x_mid));
+
+    if (y_mid * y_upper <= 0.0) {
+      x_lower = x_mid;
+      y_lower = y_mid;
+    } else {
+      x_upper = x_mid;
+      y_upper = y_mid;
+    }
+
+    if (std::fabs(y_mid) <= convergence_threshold) {
+      break;
+    }
+  }
+
+  return (y_lower * x_upper - y_upper * x_lower) / (y_lower - y_upper);
+}
+
 }  // namespace
 
 namespace sptk {
@@ -69,7 +115,7 @@ namespace sptk {
 LinearPredictiveCoefficientsToLineSpectralPairs::
     LinearPredictiveCoefficientsToLineSpectralPairs(
         int num_order, int num_split, int num_iteration,
-        double convergence_threshold)
+        double convergence_threshold, bool use_previous_frame)
     : num_order_(num_order),
       num_symmetric_polynomial_order_(
           static_cast<int>(std::ceil(num_order_ * 0.5))),
@@ -78,6 +124,7 @@ LinearPredictiveCoefficientsToLineSpectralPairs::
       num_split_(num_split),
       num_iteration_(num_iteration),
       convergence_threshold_(convergence_threshold),
+      use_previous_frame_(use_previous_frame),
       is_valid_(true) {
   if (num_order_ < 0 || num_split_ <= 0 || num_iteration_ <= 0 ||
       convergence_threshold_ < 0.0) {
@@ -110,6 +157,10 @@ bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
       static_cast<std::size_t>(num_asymmetric_polynomial_order_ + 1)) {
     buffer->c2_.resize(num_asymmetric_polynomial_order_ + 1);
   }
+  if (buffer->roots_.size() != static_cast<std::size_t>(num_order_)) {
+    buffer->roots_.resize(num_order_);
+    buffer->has_previous_roots_ = false;
+  }
 
   // Copy gain.
   (*line_spectral_pairs)[0] = linear_predictive_coefficients[0];
@@ -143,65 +194,143 @@ bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
     c2[0] *= 0.5;
   }
 
+  // Search roots of polynomials. If the search around the roots of the
+  // previous frame fails, the whole unit circle is searched.
+  const bool is_found(
+      (use_previous_frame_ && buffer->has_previous_roots_ &&
+       SearchRootsAroundPreviousRoots(buffer)) ||
+      SearchRootsOnGrid(buffer));
+  buffer->has_previous_roots_ = is_found;
+  if (!is_found) {
+    return false;
+  }
+
+  double* w(&((*line_spectral_pairs)[0]));
+  for (int m(0); m < num_order_; ++m) {
+    w[m + 1] = std::acos(buffer->roots_[m]) / sptk::kTwoPi;
+  }
+
+  return true;
+}
+
+bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
+    std::vector<double>* input_and_output,
+    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
+  if (NULL == input_and_output) return false;
+  return Run(*input_and_output, input_and_output, buffer);
+}
+
+bool LinearPredictiveCoefficientsToLineSpectralPairs::SearchRootsOnGrid(
+    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
   std::vector<double>* c(&buffer->c1_);
   int order(0);
   double x_prev(1.0);
   double y_prev(CalculateChebyshevPolynomial(*c, x_prev));
-  double* w(&((*line_spectral_pairs)[0]));
+  double* roots(&buffer->roots_[0]);
 
-  // Search roots of polynomials.
+  // Evaluate the polynomial at every kNumLane grid points at once, and then
+  // look for a sign change in order.
   const double delta(1.0 / num_split_);
   const double x_max(1.0 - delta);
   const double x_min(-1.0 - delta);
-  for (double x(x_max); x_min < x; x -= delta) {
-    double y(CalculateChebyshevPolynomial(*c, x));
-
-    if (y * y_prev <= 0.0) {
-      double x_lower(x);
-      double x_upper(x_prev);
-      double y_lower(y);
-      double y_upper(y_prev);
-
-      for (int n(0); n < num_iteration_; ++n) {
-        const double x_mid((x_lower + x_upper) * 0.5);
-        const double y_mid(CalculateChebyshevPolynomial(*c, x_mid));
-
-        if (y_mid * y_upper <= 0.0) {
-          x_lower = x_mid;
-          y_lower = y_mid;
-        } else {
-          x_upper = x_mid;
-          y_upper = y_mid;
-        }
+  double x(x_max);
+  while (x_min < x) {
+    double xs[kNumLane];
+    double ys[kNumLane];
+    xs[0] = x;
+    for (int l(1); l < kNumLane; ++l) {
+      xs[l] = xs[l - 1] - delta;
+    }
+    CalculateChebyshevPolynomials(*c, xs, ys);
 
-        if (std::fabs(y_mid) <= convergence_threshold_) {
-          break;
-        }
+    x = xs[kNumLane - 1] - delta;
+    for (int l(0); l < kNumLane; ++l) {
+      if (!(x_min < xs[l])) {
+        return false;
       }
 
-      const double x_interpolated((y_lower * x_upper - y_upper * x_lower) /
-                                  (y_lower - y_upper));
-      w[++order] = std::acos(x_interpolated) / sptk::kTwoPi;
-      if (num_order_ == order) return true;
+      if (ys[l] * y_prev <= 0.0) {
+        const double x_interpolated(RefineRoot(*c, xs[l], x_prev, ys[l],
+                                               y_prev, num_iteration_,
+                                               convergence_threshold_));
+        roots[order++] = x_interpolated;
+        if (num_order_ == order) return true;
 
-      // Update variables.
-      c = (c == &buffer->c1_) ? &buffer->c2_ : &buffer->c1_;
-      x = x_interpolated;
-      y = CalculateChebyshevPolynomial(*c, x);
-    }
+        // Update variables and restart from the next grid point.
+        c = (c == &buffer->c1_) ? &buffer->c2_ : &buffer->c1_;
+        x_prev = x_interpolated;
+        y_prev = CalculateChebyshevPolynomial(*c, x_prev);
+        x = x_prev - delta;
+        break;
+      }
 
-    x_prev = x;
-    y_prev = y;
+      x_prev = xs[l];
+      y_prev = ys[l];
+    }
   }
 
   return false;
 }
 
-bool LinearPredictiveCoefficientsToLineSpectralPairs::Run(
-    std::vector<double>* input_and_output,
-    LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
-  if (NULL == input_and_output) return false;
-  return Run(*input_and_output, input_and_output, buffer);
+bool LinearPredictiveCoefficientsToLineSpectralPairs::
+    SearchRootsAroundPreviousRoots(
+        LinearPredictiveCoefficientsToLineSpectralPairs::Buffer* buffer) const {
+  std::vector<double>* c(&buffer->c1_);
+  double* roots(&buffer->roots_[0]);
+
+  // The grid search of each root starts just above the corresponding root of
+  // the previous frame instead of the last found root, if the polynomial has
+  // the same sign at the two points. Since all roots are distinct and lie in
+  // (-1, 1), finding all of them in descending order means that no root is
+  // skipped.
+  const double delta(1.0 / num_split_);
+  const double x_min(-1.0 - delta);
+  double x_last(1.0);
+  for (int m(0); m < num_order_; ++m) {
+    double x_prev(x_last);
+    double y_prev(CalculateChebyshevPolynomial(*c, x_prev));
+    const double x_start(roots[m] + delta);
+    if (x_start < x_last) {
+      const double y_start(CalculateChebyshevPolynomial(*c, x_start));
+      if (0.0 < y_start * y_prev) {
+        x_prev = x_start;
+        y_prev = y_start;
+      }
+    }
+
+    bool is_found(false);
+    while (!is_found) {
+      double xs[kNumLane];
+      double ys[kNumLane];
+      xs[0] = x_prev - delta;
+      for (int l(1); l < kNumLane; ++l) {
+        xs[l] = xs[l - 1] - delta;
+      }
+      CalculateChebyshevPolynomials(*c, xs, ys);
+
+      for (int l(0); l < kNumLane; ++l) {
+        if (!(x_min < xs[l])) {
+          return false;
+        }
+        if (ys[l] * y_prev <= 0.0) {
+          roots[m] = RefineRoot(*c, xs[l], x_prev, ys[l], y_prev,
+                                num_iteration_, convergence_threshold_);
+          is_found = true;
+          break;
+        }
+        x_prev = xs[l];
+        y_prev = ys[l];
+      }
+    }
+
+    if (!(roots[m] < x_last)) {
+      return false;
+    }
+    x_last = roots[m];
+    c = (c == &buffer->c1_) ? &buffer->c2_ : &buffer->c1_;
+  }
+
+  return true;
 }
 
 }  // namespace sptk
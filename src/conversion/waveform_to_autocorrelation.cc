@@ -46,6 +46,15 @@
 
 #include <cstddef>  // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
+namespace {
+
+// Number of frames processed in SIMD lanes.
+const int kNumLane(4);
+
+}  // namespace
+
 namespace sptk {
 
 WaveformToAutocorrelation::WaveformToAutocorrelation(int frame_length,
@@ -60,6 +69,7 @@ WaveformToAutocorrelation::WaveformToAutocorrelation(int frame_length,
 bool WaveformToAutocorrelation::Run(
     const std::vector<double>& waveform,
     std::vector<double>* autocorrelation) const {
+  SPTK_PROFILE_SCOPE("WaveformToAutocorrelation::Run");
   // Check inputs.
   if (!is_valid_ ||
       waveform.size() != static_cast<std::size_t>(frame_length_) ||
@@ -87,4 +97,62 @@ bool WaveformToAutocorrelation::Run(
   return true;
 }
 
+bool WaveformToAutocorrelation::Run(
+    const std::vector<std::vector<double> >& waveforms,
+    std::vector<std::vector<double> >* autocorrelations) const {
+  SPTK_PROFILE_SCOPE("WaveformToAutocorrelation::Run");
+  // Check inputs.
+  if (!is_valid_ || NULL == autocorrelations) {
+    return false;
+  }
+  const int num_frame(static_cast<int>(waveforms.size()));
+  SPTK_PROFILE_FRAME(num_frame);
+  for (int n(0); n < num_frame; ++n) {
+    if (waveforms[n].size() != static_cast<std::size_t>(frame_length_)) {
+      return false;
+    }
+  }
+
+  // Prepare memories.
+  if (autocorrelations->size() != static_cast<std::size_t>(num_frame)) {
+    autocorrelations->resize(num_frame);
+  }
+  for (int n(0); n < num_frame; ++n) {
+    if ((*autocorrelations)[n].size() !=
+        static_cast<std::size_t>(num_order_ + 1)) {
+      (*autocorrelations)[n].resize(num_order_ + 1);
+    }
+  }
+
+  // Calculate autocorrelation of every four frames at once. The order of
+  // summation in each frame is the same as that of the single frame version.
+  int n(0);
+  for (; n + kNumLane <= num_frame; n += kNumLane) {
+    const double* x0(&(waveforms[n + 0][0]));
+    const double* x1(&(waveforms[n + 1][0]));
+    const double* x2(&(waveforms[n + 2][0]));
+    const double* x3(&(waveforms[n + 3][0]));
+    for (int m(0); m <= num_order_; ++m) {
+      double sum0(0.0), sum1(0.0), sum2(0.0), sum3(0.0);
+      for (int l(0); l < frame_length_ - m; ++l) {
+        sum0 += x0[l] * x0[l + m];
+        sum1 += x1[l] * x1[l + m];
+        sum2 += x2[l] * x2[l + m];
+        sum3 += x3[l] * x3[l + m];
+      }
+      (*autocorrelations)[n + 0][m] = sum0;
+      (*autocorrelations)[n + 1][m] = sum1;
+      (*autocorrelations)[n + 2][m] = sum2;
+      (*autocorrelations)[n + 3][m] = sum3;
+    }
+  }
+  for (; n < num_frame; ++n) {
+    if (!Run(waveforms[n], &((*autocorrelations)[n]))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace sptk
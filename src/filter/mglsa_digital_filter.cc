@@ -48,6 +48,8 @@
 #include <cmath>      // std::exp
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
 namespace sptk {
 
 MglsaDigitalFilter::MglsaDigitalFilter(int num_filter_order, int num_pade_order,
@@ -73,6 +75,7 @@ MglsaDigitalFilter::MglsaDigitalFilter(int num_filter_order, int num_pade_order,
 bool MglsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
                              double filter_input, double* filter_output,
                              MglsaDigitalFilter::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("MglsaDigitalFilter::Run");
   // Check inputs.
   if (!is_valid_ ||
       filter_coefficients.size() !=
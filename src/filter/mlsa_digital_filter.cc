@@ -48,6 +48,8 @@
 #include <cmath>      // std::exp
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
 namespace sptk {
 
 MlsaDigitalFilter::MlsaDigitalFilter(int num_filter_order, int num_pade_order,
@@ -56,6 +58,7 @@ MlsaDigitalFilter::MlsaDigitalFilter(int num_filter_order, int num_pade_order,
       num_pade_order_(num_pade_order),
       alpha_(alpha),
       transposition_(transposition),
+      simd_kernels_(SimdKernels::Get()),
       is_valid_(true) {
   if (num_filter_order_ < 0 || num_pade_order_ < 0 ||
       !sptk::IsValidAlpha(alpha_)) {
@@ -109,6 +112,7 @@ MlsaDigitalFilter::MlsaDigitalFilter(int num_filter_order, int num_pade_order,
 bool MlsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
                             double filter_input, double* filter_output,
                             MlsaDigitalFilter::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("MlsaDigitalFilter::Run");
   // Check inputs.
   if (!is_valid_ ||
       filter_coefficients.size() !=
@@ -194,12 +198,10 @@ bool MlsaDigitalFilter::Run(const std::vector<double>& filter_coefficients,
       } else {
         d2[0] = p2[i - 1];
         d2[1] = beta * p2[i - 1] + alpha_ * d2[1];
-        double y(0.0);
         for (int j(2); j <= num_filter_order_; ++j) {
           d2[j] += alpha_ * (d2[j + 1] - d2[j - 1]);
-          y += d2[j] * b[j];
         }
-        p2[i] = y;
+        p2[i] = simd_kernels_.dot_product(d2 + 2, b + 2, num_filter_order_ - 1);
         for (int j(num_filter_order_ + 1); 1 < j; --j) {
           d2[j] = d2[j - 1];
         }
@@ -87,6 +87,37 @@ DeltaCalculation::DeltaCalculation(
     }
   }
 
+  // Make terms of each window. The offset of each term is relative to the
+  // leftmost frame of the ring buffer.
+  const int center(max_window_width_ / 2);
+  terms_.resize(num_delta_);
+  for (int d(0); d < num_delta_; ++d) {
+    const std::vector<double>& w(window_coefficients[d]);
+    const int origin(-lefts_[d]);
+    std::vector<bool> is_used(w.size(), false);
+    if (-lefts_[d] == rights_[d]) {
+      for (int j(1); j <= rights_[d]; ++j) {
+        const double plus(w[origin + j]);
+        const double minus(w[origin - j]);
+        if (0.0 == plus && 0.0 == minus) {
+          is_used[origin + j] = is_used[origin - j] = true;
+        } else if (plus == minus || plus == -minus) {
+          const Term term = {plus == minus ? kSymmetric : kAntisymmetric,
+                             plus, center + j, center - j};
+          terms_[d].push_back(term);
+          is_used[origin + j] = is_used[origin - j] = true;
+        }
+      }
+    }
+    for (int j(lefts_[d]); j <= rights_[d]; ++j) {
+      if (!is_used[origin + j] && 0.0 != w[origin + j]) {
+        const Term term = {kSingle, w[origin + j], center + j, center + j};
+        terms_[d].push_back(term);
+      }
+    }
+  }
+
+  buffer_.frames.resize(max_window_width_);
   buffer_.statics.resize(max_window_width_);
   for (int j(0); j < max_window_width_; ++j) {
     buffer_.statics[j].resize(num_order_ + 1);
@@ -120,10 +151,57 @@ bool DeltaCalculation::Get(std::vector<double>* dynamics) {
     dynamics->resize(output_length);
   }
 
+  double* output(&((*dynamics)[0]));
+
+  if (!use_magic_number_) {
+    // Collect frames from the ring buffer in time order.
+    const int center(max_window_width_ / 2);
+    const int delay((max_window_width_ + 1) / 2);
+    for (int j(0); j < max_window_width_; ++j) {
+      const int k(GetPointerIndex(j - center - delay));
+      buffer_.frames[j] = &(buffer_.statics[k][0]);
+    }
+
+    // Calculate delta components of all windows at once.
+    for (int d(0); d < num_delta_; ++d) {
+      double* y(output + input_length * d);
+      std::fill(y, y + input_length, 0.0);
+      for (std::vector<Term>::const_iterator term(terms_[d].begin());
+           term != terms_[d].end(); ++term) {
+        const double w(term->coefficient);
+        const double* x1(buffer_.frames[term->plus]);
+        const double* x2(buffer_.frames[term->minus]);
+        switch (term->type) {
+          case kSingle: {
+            for (int m(0); m < input_length; ++m) {
+              y[m] += w * x1[m];
+            }
+            break;
+          }
+          case kSymmetric: {
+            for (int m(0); m < input_length; ++m) {
+              y[m] += w * (x1[m] + x2[m]);
+            }
+            break;
+          }
+          case kAntisymmetric: {
+            for (int m(0); m < input_length; ++m) {
+              y[m] += w * (x1[m] - x2[m]);
+            }
+            break;
+          }
+          default: {
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
   std::fill(dynamics->begin(), dynamics->end(), 0.0);
 
   // Calculate delta components.
-  double* output(&((*dynamics)[0]));
   for (int d(0); d < num_delta_; ++d) {
     for (int j(lefts_[d]), i(0); j <= rights_[d]; ++j, ++i) {
       // The below line means GetPointerIndex(j - delay - 1).
@@ -44,8 +44,15 @@
 
 #include "SPTK/generation/excitation_generation.h"
 
-#include <cmath>   // std::sqrt
-#include <vector>  // std::vector
+#include <algorithm>  // std::copy, std::min
+#include <cmath>      // std::sqrt
+#include <vector>     // std::vector
+
+namespace {
+
+const int kNoiseBufferSize(256);
+
+}  // namespace
 
 namespace sptk {
 
@@ -55,7 +62,10 @@ ExcitationGeneration::ExcitationGeneration(
     : input_source_(input_source),
       random_generation_(random_generation),
       is_valid_(true),
-      phase_(1.0) {
+      is_end_of_stream_(false),
+      phase_(1.0),
+      noise_buffer_(kNoiseBufferSize),
+      noise_index_(kNoiseBufferSize) {
   if (NULL == input_source_ || NULL == random_generation_ ||
       !input_source_->IsValid()) {
     is_valid_ = false;
@@ -65,63 +75,97 @@ ExcitationGeneration::ExcitationGeneration(
 
 bool ExcitationGeneration::Get(double* excitation, double* pulse, double* noise,
                                double* pitch) {
-  if (!is_valid_) {
+  int num_samples;
+  return Get(1, excitation, pulse, noise, pitch, &num_samples);
+}
+
+bool ExcitationGeneration::Get(int length, double* excitation, double* pulse,
+                               double* noise, double* pitch,
+                               int* num_samples) {
+  if (!is_valid_ || length <= 0 || NULL == num_samples) {
+    return false;
+  }
+  *num_samples = 0;
+  if (is_end_of_stream_) {
     return false;
   }
 
-  // Get pitch.
-  double pitch_in_current_point;
-  {
-    std::vector<double> tmp;
-    if (!input_source_->Get(&tmp) || tmp[0] < 0.0) {
-      return false;
-    }
-    pitch_in_current_point = tmp[0];
+  if (static_cast<int>(pitch_buffer_.size()) < length) {
+    pitch_buffer_.resize(length);
+    noise_output_buffer_.resize(length);
   }
+  double* p(pitch ? pitch : &(pitch_buffer_[0]));
+  double* d(noise ? noise : &(noise_output_buffer_[0]));
 
-  // Get noise.
-  double noise_in_current_point;
-  if (!random_generation_->Get(&noise_in_current_point)) {
+  // Get pitch. A negative pitch terminates the sequence as well as the end of
+  // input, so that the following pitch values are never read.
+  int n(0);
+  for (; n < length; ++n) {
+    if (!input_source_->Get(&input_buffer_) || input_buffer_[0] < 0.0) {
+      is_end_of_stream_ = true;
+      break;
+    }
+    p[n] = input_buffer_[0];
+  }
+  *num_samples = n;
+  if (0 == n) {
     return false;
   }
 
-  if (pitch) {
-    *pitch = pitch_in_current_point;
-  }
-  if (noise) {
-    *noise = noise_in_current_point;
+  // Get noise. The random values are consumed in the same order as the
+  // sample-by-sample generation.
+  for (int i(0); i < n;) {
+    if (kNoiseBufferSize <= noise_index_) {
+      if (kNoiseBufferSize <= n - i) {
+        const int size(n - i - (n - i) % kNoiseBufferSize);
+        if (!random_generation_->Generate(size, d + i)) {
+          return false;
+        }
+        i += size;
+        continue;
+      }
+      if (!random_generation_->Generate(kNoiseBufferSize,
+                                        &(noise_buffer_[0]))) {
+        return false;
+      }
+      noise_index_ = 0;
+    }
+    const int size(std::min(n - i, kNoiseBufferSize - noise_index_));
+    std::copy(noise_buffer_.begin() + noise_index_,
+              noise_buffer_.begin() + noise_index_ + size, d + i);
+    noise_index_ += size;
+    i += size;
   }
 
-  // If unvoiced point, return white noise.
-  if (input_source_->GetMagicNumber() == pitch_in_current_point) {
-    phase_ = 1.0;
+  // Place pulses. If unvoiced point, return white noise. If voiced point,
+  // return pulse or zero.
+  const double magic_number(input_source_->GetMagicNumber());
+  for (int i(0); i < n; ++i) {
+    double excitation_in_current_point;
+    double pulse_in_current_point;
+    if (magic_number == p[i]) {
+      phase_ = 1.0;
+      excitation_in_current_point = d[i];
+      pulse_in_current_point = 0.0;
+    } else {
+      if (1.0 <= phase_) {
+        phase_ -= 1.0;
+        pulse_in_current_point = std::sqrt(p[i]);
+      } else {
+        pulse_in_current_point = 0.0;
+      }
+      excitation_in_current_point = pulse_in_current_point;
+
+      // Proceed phase.
+      phase_ += 1.0 / p[i];
+    }
     if (excitation) {
-      *excitation = noise_in_current_point;
+      excitation[i] = excitation_in_current_point;
     }
     if (pulse) {
-      *pulse = 0.0;
+      pulse[i] = pulse_in_current_point;
     }
-    return true;
-  }
-
-  // If voiced point, return pulse or zero.
-  double pulse_in_current_point;
-  if (1.0 <= phase_) {
-    phase_ -= 1.0;
-    pulse_in_current_point = std::sqrt(pitch_in_current_point);
-  } else {
-    pulse_in_current_point = 0.0;
-  }
-
-  if (excitation) {
-    *excitation = pulse_in_current_point;
   }
-  if (pulse) {
-    *pulse = pulse_in_current_point;
-  }
-
-  // Proceed phase.
-  phase_ += 1.0 / pitch_in_current_point;
 
   return true;
 }
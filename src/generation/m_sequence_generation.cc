@@ -46,21 +46,63 @@
 
 namespace {
 
-const int kInitialValue(0x55555555);
-const int kB0(0x00000001);
-const int kB28(0x10000000);
-const int kB31(0x80000000);
-const int kB31F(0x7fffffff);
+// Number of chips of which next chip depends on.
+const int kNumStateChip(31);
+
+// Number of chips generated at once.
+const int kNumBlockChip(64);
+
+// Number of chips looked up at once.
+const int kNumChipPerTable(8);
+const int kTableSize(1 << kNumChipPerTable);
+const int kNumTable((kNumStateChip + kNumChipPerTable - 1) / kNumChipPerTable);
+
+// 31 chips following the first output, i.e., bit 1 to 31 of 0x55555555.
+const std::uint64_t kInitialState(0x2aaaaaaaULL);
+
+const std::uint64_t kStateMask((1ULL << kNumStateChip) - 1);
 
 }  // namespace
 
 namespace sptk {
 
-MSequenceGeneration::MSequenceGeneration() : x_(kInitialValue) {
+MSequenceGeneration::MSequenceGeneration()
+    : table_(kNumTable * kTableSize),
+      state_(kInitialState),
+      buffer_(0),
+      num_buffered_chip_(0) {
+  // Compute responses of next 64 chips to each of 31 chips by running
+  // X**31 + X**28 + 1 bit by bit.
+  std::vector<std::uint64_t> responses(kNumStateChip);
+  for (int j(0); j < kNumStateChip; ++j) {
+    std::vector<int> a(kNumStateChip + kNumBlockChip, 0);
+    a[j] = 1;
+    std::uint64_t response(0);
+    for (int n(0); n < kNumBlockChip; ++n) {
+      a[n + kNumStateChip] = a[n] ^ a[n + 28];
+      if (a[n + kNumStateChip]) response |= 1ULL << n;
+    }
+    responses[j] = response;
+  }
+
+  // Combine the responses by linearity.
+  for (int k(0); k < kNumTable; ++k) {
+    std::uint64_t* table(&(table_[k * kTableSize]));
+    for (int v(0); v < kTableSize; ++v) {
+      std::uint64_t response(0);
+      for (int b(0); b < kNumChipPerTable; ++b) {
+        const int j(k * kNumChipPerTable + b);
+        if ((v >> b & 1) && j < kNumStateChip) response ^= responses[j];
+      }
+      table[v] = response;
+    }
+  }
 }
 
 void MSequenceGeneration::Reset() {
-  x_ = kInitialValue;
+  state_ = kInitialState;
+  buffer_ = 0;
+  num_buffered_chip_ = 0;
 }
 
 bool MSequenceGeneration::Get(double* output) {
@@ -68,32 +110,66 @@ bool MSequenceGeneration::Get(double* output) {
     return false;
   }
 
-  // Generate m-sequence using X**31 + X**28 + 1.
-  int x0, x28;
+  if (0 == num_buffered_chip_) {
+    buffer_ = Proceed();
+    num_buffered_chip_ = kNumBlockChip;
+  }
 
-  x_ >>= 1;
+  *output = (buffer_ & 1) ? 1.0 : -1.0;
+  buffer_ >>= 1;
+  --num_buffered_chip_;
 
-  if (x_ & kB0) {
-    x0 = 1;
-  } else {
-    x0 = -1;
+  return true;
+}
+
+bool MSequenceGeneration::Generate(int length, double* outputs) {
+  if (length < 0 || (0 < length && NULL == outputs)) {
+    return false;
   }
 
-  if (x_ & kB28) {
-    x28 = 1;
-  } else {
-    x28 = -1;
+  // Flush buffered chips.
+  int n(0);
+  for (; n < length && 0 < num_buffered_chip_; ++n) {
+    outputs[n] = (buffer_ & 1) ? 1.0 : -1.0;
+    buffer_ >>= 1;
+    --num_buffered_chip_;
   }
 
-  if (x0 + x28) {
-    x_ &= kB31F;
-  } else {
-    x_ |= kB31;
+  // Write 64 chips at once.
+  for (; n + kNumBlockChip <= length; n += kNumBlockChip) {
+    const std::uint64_t chips(Proceed());
+    double* y(outputs + n);
+    for (int i(0); i < kNumBlockChip; ++i) {
+      y[i] = static_cast<double>(static_cast<int>(chips >> i & 1) * 2 - 1);
+    }
   }
 
-  *output = static_cast<double>(x0);
+  // Keep remaining chips.
+  if (n < length) {
+    buffer_ = Proceed();
+    num_buffered_chip_ = kNumBlockChip;
+    for (; n < length; ++n) {
+      outputs[n] = (buffer_ & 1) ? 1.0 : -1.0;
+      buffer_ >>= 1;
+      --num_buffered_chip_;
+    }
+  }
 
   return true;
 }
 
+std::uint64_t MSequenceGeneration::Proceed() {
+  // Compute next 64 chips following the current 31 chips.
+  std::uint64_t next(0);
+  for (int k(0); k < kNumTable; ++k) {
+    next ^= table_[k * kTableSize +
+                   ((state_ >> (k * kNumChipPerTable)) & (kTableSize - 1))];
+  }
+
+  // Output the current 31 chips and the first 33 chips of the next chips.
+  const std::uint64_t chips(state_ | (next << kNumStateChip));
+  state_ = (next >> (kNumBlockChip - kNumStateChip)) & kStateMask;
+  return chips;
+}
+
 }  // namespace sptk
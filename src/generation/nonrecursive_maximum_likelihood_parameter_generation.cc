@@ -44,9 +44,11 @@
 
 #include "SPTK/generation/nonrecursive_maximum_likelihood_parameter_generation.h"
 
-#include <algorithm>  // std::count
+#include <algorithm>  // std::count, std::fill, std::max
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
 namespace {
 
 bool CheckSize(const std::vector<std::vector<double> >& vectors, int size) {
@@ -71,11 +73,34 @@ bool CheckSize(const std::vector<sptk::SymmetricMatrix>& matrices, int size) {
   return true;
 }
 
-bool CheckRange(int index, int max, const double* array, bool reverse) {
-  return (-max <= index && index <= max && ((reverse && 0.0 != array[-index]) ||
-                                            (!reverse && 0.0 != array[index])))
-             ? true
-             : false;
+bool CheckDiagonal(const std::vector<sptk::SymmetricMatrix>& matrices) {
+  const int outer_size(static_cast<int>(matrices.size()));
+  for (int i(0); i < outer_size; ++i) {
+    const int inner_size(matrices[i].GetNumDimension());
+    for (int k(1); k < inner_size; ++k) {
+      for (int l(0); l < k; ++l) {
+        if (0.0 != matrices[i][k][l]) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool IsEqual(const sptk::SymmetricMatrix& a, const sptk::SymmetricMatrix& b) {
+  const int size(a.GetNumDimension());
+  if (size != b.GetNumDimension()) {
+    return false;
+  }
+  for (int k(0); k < size; ++k) {
+    for (int l(0); l <= k; ++l) {
+      if (a[k][l] != b[k][l]) {
+        return false;
+      }
+    }
+  }
+  return true;
 }
 
 }  // namespace
@@ -119,26 +144,197 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     const std::vector<std::vector<double> >& mean_vectors,
     const std::vector<std::vector<double> >& variance_vectors,
     std::vector<std::vector<double> >* smoothed_static_parameters) const {
-  if (!is_valid_ || variance_vectors.empty()) {
+  SPTK_PROFILE_SCOPE("NonrecursiveMaximumLikelihoodParameterGeneration::Run");
+  // Check inputs.
+  if (!is_valid_ || mean_vectors.empty() ||
+      mean_vectors.size() != variance_vectors.size() ||
+      NULL == smoothed_static_parameters) {
     return false;
   }
 
-  const int sequence_length(static_cast<int>(variance_vectors.size()));
-  std::vector<SymmetricMatrix> covariance_matrices(
-      sequence_length,
-      SymmetricMatrix(static_cast<int>(variance_vectors[0].size())));
-  for (int t(0); t < sequence_length; ++t) {
-    if (!covariance_matrices[t].SetDiagonal(variance_vectors[t])) {
-      return false;
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int length(static_size * num_window);
+  if (!CheckSize(mean_vectors, length) ||
+      !CheckSize(variance_vectors, length)) {
+    return false;
+  }
+
+  // Store positions that contain a magic number.
+  const int sequence_length(static_cast<int>(mean_vectors.size()));
+  SPTK_PROFILE_FRAME(sequence_length);
+  std::vector<bool> is_continuous(sequence_length, true);
+  if (use_magic_number_) {
+    for (int absolute_t(0); absolute_t < sequence_length; ++absolute_t) {
+      if (magic_number_ == mean_vectors[absolute_t][0]) {
+        is_continuous[absolute_t] = false;
+      }
+    }
+  }
+  const int continuous_length(static_cast<int>(
+      std::count(is_continuous.begin(), is_continuous.end(), true)));
+
+  // Prepare memories. Since the static dimensions are independent of each
+  // other, they share the same band structure of WUW. The dimension index is
+  // therefore placed innermost so that all dimensions are solved at once.
+  const int max_window_width(2 * max_half_window_width_ + 1);
+  std::vector<double> wum(continuous_length * static_size);
+  std::vector<double> wuw(continuous_length * max_window_width * static_size);
+  std::vector<double> precision(static_size);
+  std::vector<double> weighted_mean(static_size);
+  {
+    if (smoothed_static_parameters->size() !=
+        static_cast<std::size_t>(sequence_length)) {
+      smoothed_static_parameters->resize(sequence_length);
+    }
+    for (int t(0); t < sequence_length; ++t) {
+      if ((*smoothed_static_parameters)[t].size() !=
+          static_cast<std::size_t>(static_size)) {
+        (*smoothed_static_parameters)[t].resize(static_size);
+      }
+    }
+  }
+
+  // Calculate WUM and WUW.
+  for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
+    if (!is_continuous[absolute_t]) continue;
+
+    for (int d(0); d < num_window; ++d) {
+      const int half_window_width(
+          (static_cast<int>(window_coefficients_[d].size()) - 1) / 2);
+      const double* window_coefficients(
+          &(window_coefficients_[d][half_window_width]));
+
+      // Check boundary.
+      bool is_boundary(false);
+      for (int j(-half_window_width); j <= half_window_width; ++j) {
+        const int biased_t(t + j);
+        const int biased_absolute_t(absolute_t + j);
+        if (biased_t < 0 || continuous_length <= biased_t ||
+            (0.0 != window_coefficients[j] && 0 <= biased_absolute_t &&
+             biased_absolute_t < sequence_length &&
+             !is_continuous[biased_absolute_t])) {
+          is_boundary = true;
+          break;
+        }
+      }
+      if (is_boundary) continue;
+
+      const double* mean(&(mean_vectors[absolute_t][static_size * d]));
+      const double* variance(&(variance_vectors[absolute_t][static_size * d]));
+      for (int m(0); m < static_size; ++m) {
+        precision[m] = 1.0 / variance[m];
+        weighted_mean[m] = precision[m] * mean[m];
+      }
+
+      for (int i(-half_window_width); i <= half_window_width; ++i) {
+        const double w1(window_coefficients[i]);
+        if (0.0 == w1) continue;
+
+        // Accumulate W'U^{-1}M.
+        double* r(&(wum[static_size * (t + i)]));
+        for (int m(0); m < static_size; ++m) {
+          r[m] += w1 * weighted_mean[m];
+        }
+
+        // Accumulate W'U^{-1}W.
+        for (int j(i); j <= half_window_width; ++j) {
+          const double w2(window_coefficients[j]);
+          if (0.0 == w2) continue;
+          const double w12(w1 * w2);
+          double* a(&(wuw[static_size * (max_window_width * (t + i) + j - i)]));
+          for (int m(0); m < static_size; ++m) {
+            a[m] += w12 * precision[m];
+          }
+        }
+      }
+    }
+
+    // Update counter.
+    ++t;
+  }
+
+  // Compute Cholesky factor.
+  for (int t(0); t < continuous_length; ++t) {
+    double* a(&(wuw[static_size * max_window_width * t]));
+    for (int i(1); i < max_window_width && i <= t; ++i) {
+      const double* b(&(wuw[static_size * max_window_width * (t - i)]));
+      for (int m(0); m < static_size; ++m) {
+        a[m] -= b[static_size * i + m] * b[static_size * i + m] * b[m];
+      }
+    }
+
+    // Reuse the memory of precision.
+    double* z(&(precision[0]));
+    for (int m(0); m < static_size; ++m) {
+      z[m] = 1.0 / a[m];
+    }
+    for (int i(1); i < max_window_width; ++i) {
+      double* ai(&(a[static_size * i]));
+      for (int j(1); i + j < max_window_width && j <= t; ++j) {
+        const double* b(&(wuw[static_size * max_window_width * (t - j)]));
+        for (int m(0); m < static_size; ++m) {
+          ai[m] -= b[static_size * j + m] * b[static_size * (i + j) + m] * b[m];
+        }
+      }
+      for (int m(0); m < static_size; ++m) {
+        ai[m] *= z[m];
+      }
+    }
+  }
+
+  // Forward substitution to solve a set of linear equations.
+  for (int t(0); t < continuous_length; ++t) {
+    double* g(&(wum[static_size * t]));
+    for (int i(1); i < max_window_width && i <= t; ++i) {
+      const double* b(&(wuw[static_size * (max_window_width * (t - i) + i)]));
+      const double* h(&(wum[static_size * (t - i)]));
+      for (int m(0); m < static_size; ++m) {
+        g[m] -= b[m] * h[m];
+      }
+    }
+  }
+
+  // Backward substitution to solve a set of linear equations.
+  for (int t(continuous_length - 1); 0 <= t; --t) {
+    double* c(&(wum[static_size * t]));
+    const double* a(&(wuw[static_size * max_window_width * t]));
+    for (int m(0); m < static_size; ++m) {
+      c[m] /= a[m];
+    }
+    for (int i(1); i < max_window_width && t + i < continuous_length; ++i) {
+      const double* ai(&(a[static_size * i]));
+      const double* h(&(wum[static_size * (t + i)]));
+      for (int m(0); m < static_size; ++m) {
+        c[m] -= ai[m] * h[m];
+      }
+    }
+  }
+
+  // Store generated parameters.
+  for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
+    double* C(&((*smoothed_static_parameters)[absolute_t][0]));
+    if (is_continuous[absolute_t]) {
+      const double* c(&(wum[static_size * t]));
+      for (int m(0); m < static_size; ++m) {
+        C[m] = c[m];
+      }
+      ++t;
+    } else {
+      for (int m(0); m < static_size; ++m) {
+        C[m] = magic_number_;
+      }
     }
   }
-  return Run(mean_vectors, covariance_matrices, smoothed_static_parameters);
+
+  return true;
 }
 
 bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     const std::vector<std::vector<double> >& mean_vectors,
     const std::vector<SymmetricMatrix>& covariance_matrices,
     std::vector<std::vector<double> >* smoothed_static_parameters) const {
+  SPTK_PROFILE_SCOPE("NonrecursiveMaximumLikelihoodParameterGeneration::Run");
   // Check inputs.
   if (!is_valid_ || mean_vectors.empty() ||
       mean_vectors.size() != covariance_matrices.size() ||
@@ -154,8 +350,22 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     return false;
   }
 
+  // Use the dimension-wise solver if all covariances are diagonal.
+  if (CheckDiagonal(covariance_matrices)) {
+    std::vector<std::vector<double> > variance_vectors(
+        covariance_matrices.size());
+    const int sequence_length(static_cast<int>(covariance_matrices.size()));
+    for (int t(0); t < sequence_length; ++t) {
+      if (!covariance_matrices[t].GetDiagonal(&(variance_vectors[t]))) {
+        return false;
+      }
+    }
+    return Run(mean_vectors, variance_vectors, smoothed_static_parameters);
+  }
+
   // Store positions that contain a magic number.
   const int sequence_length(static_cast<int>(mean_vectors.size()));
+  SPTK_PROFILE_FRAME(sequence_length);
   std::vector<bool> is_continuous(sequence_length, true);
   if (use_magic_number_) {
     for (int absolute_t(0); absolute_t < sequence_length; ++absolute_t) {
@@ -171,9 +381,8 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
   const int max_window_width(2 * max_half_window_width_ + 1);
   const int wuw_height(static_size * continuous_length);
   const int wuw_width(static_size * max_window_width);
-  std::vector<std::vector<double> > mseq(continuous_length,
-                                         std::vector<double>(length));
-  std::vector<SymmetricMatrix> vseq(continuous_length, SymmetricMatrix(length));
+  std::vector<double> mseq(length);
+  std::vector<double> vseq(length * length);
   std::vector<double> wum(wuw_height);
   std::vector<std::vector<double> > wuw(wuw_height,
                                         std::vector<double>(wuw_width));
@@ -192,16 +401,27 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
     }
   }
 
-  // Set mseq and vseq.
-  for (int absolute_t(0), t(0); absolute_t < sequence_length; ++absolute_t) {
+  // Calculate WUM and WUW frame by frame.
+  SymmetricMatrix precision;
+  for (int absolute_t(0), t(0), previous_absolute_t(-1);
+       absolute_t < sequence_length; ++absolute_t) {
     if (!is_continuous[absolute_t]) continue;
 
-    SymmetricMatrix precision;
-    if (!covariance_matrices[absolute_t].Invert(&precision)) {
-      return false;
+    // Reuse the precision matrix if the covariance matrix is unchanged, e.g.,
+    // the same mixture component is selected in GMM-based conversion.
+    if (previous_absolute_t < 0 ||
+        !IsEqual(covariance_matrices[absolute_t],
+                 covariance_matrices[previous_absolute_t])) {
+      if (!covariance_matrices[absolute_t].Invert(&precision)) {
+        return false;
+      }
     }
+    previous_absolute_t = absolute_t;
     const double* mean(&(mean_vectors[absolute_t][0]));
 
+    // Set mseq and vseq of the current frame.
+    std::fill(mseq.begin(), mseq.end(), 0.0);
+    std::fill(vseq.begin(), vseq.end(), 0.0);
     for (int k(0); k < length; ++k) {
       // Check boundary.
       bool is_boundary(false);
@@ -225,89 +445,84 @@ bool NonrecursiveMaximumLikelihoodParameterGeneration::Run(
 
       if (!is_boundary) {
         const double p(precision[k][k]);
-        mseq[t][k] = p * mean[k];
-        vseq[t][k][k] = p;
+        mseq[k] = p * mean[k];
+        vseq[length * k + k] = p;
         for (int l(0); l < k; ++l) {
           const double p(precision[k][l]);
           if (0.0 != p) {
-            mseq[t][k] += p * mean[l];
-            mseq[t][l] += p * mean[k];
-            vseq[t][k][l] = p;
+            mseq[k] += p * mean[l];
+            mseq[l] += p * mean[k];
+            vseq[length * k + l] = p;
+            vseq[length * l + k] = p;
           }
         }
       }
     }
 
-    // Update counter.
-    ++t;
-  }
+    // Accumulate W'U^{-1}M and W'U^{-1}W. The (c, i) and (d, j) pairs select
+    // the row and the column frames, t + i and t + j, respectively.
+    for (int c(0); c < num_window; ++c) {
+      const int half_window_width1(
+          (static_cast<int>(window_coefficients_[c].size()) - 1) / 2);
+      const double* window_coefficients1(
+          &(window_coefficients_[c][half_window_width1]));
+      for (int i(-half_window_width1); i <= half_window_width1; ++i) {
+        const double w1(window_coefficients1[i]);
+        const int biased_t1(t + i);
+        if (0.0 == w1 || biased_t1 < 0 || continuous_length <= biased_t1) {
+          continue;
+        }
+
+        double* r(&(wum[static_size * biased_t1]));
+        for (int m(0); m < static_size; ++m) {
+          r[m] += w1 * mseq[static_size * c + m];
+        }
 
-  // Calculate WUM and WUW.
-  for (int t(0); t < continuous_length; ++t) {
-    for (int m(0); m < static_size; ++m) {
-      const int tau(static_size * t + m);
-      for (int n(0); n < static_size; ++n) {
         for (int d(0); d < num_window; ++d) {
-          const int half_window_width(
+          const int half_window_width2(
               (static_cast<int>(window_coefficients_[d].size()) - 1) / 2);
-          const double* window_coefficients(
-              &(window_coefficients_[d][half_window_width]));
-          for (int j(-max_half_window_width_); j <= max_half_window_width_;
+          const double* window_coefficients2(
+              &(window_coefficients_[d][half_window_width2]));
+          for (int j(std::max(i, -half_window_width2)); j <= half_window_width2;
                ++j) {
-            const int biased_t(t + j);
-            if (biased_t < 0 || continuous_length <= biased_t) continue;
-
-            // Accumulate W'U^{-1}M.
-            if (0 == n &&
-                CheckRange(j, half_window_width, window_coefficients, true)) {
-              wum[tau] += (window_coefficients[-j] *
-                           mseq[biased_t][d * static_size + m]);
-            }
-
-            // Accumulate W'U^{-1}W.
-            double wu(0.0);
-            for (int c(0); c < num_window; ++c) {
-              const double u(
-                  vseq[biased_t][static_size * c + m][static_size * d + n]);
-              const int half_window_width2(
-                  (static_cast<int>(window_coefficients_[c].size()) - 1) / 2);
-              const double* window_coefficients2(
-                  &(window_coefficients_[c][half_window_width2]));
-              if (CheckRange(j, half_window_width2, window_coefficients2,
-                             true) &&
-                  0.0 != u) {
-                wu += window_coefficients2[-j] * u;
-              }
-            }
-            if (0.0 != wu) {
-              for (int k(0); k < max_window_width && t + k < continuous_length;
-                   ++k) {
-                const int index(static_size * k + n - m);
-                if (CheckRange(k - j, half_window_width, window_coefficients,
-                               false) &&
-                    0 <= index) {
-                  wuw[tau][index] += wu * window_coefficients[k - j];
-                }
+            const double w2(window_coefficients2[j]);
+            const int k(j - i);
+            if (0.0 == w2 || continuous_length <= t + j) continue;
+
+            const double w12(w1 * w2);
+            for (int m(0); m < static_size; ++m) {
+              const double* u(
+                  &(vseq[length * (static_size * c + m) + static_size * d]));
+              double* a(&(wuw[static_size * biased_t1 + m][static_size * k]));
+              for (int n(0 == k ? m : 0); n < static_size; ++n) {
+                a[n - m] += w12 * u[n];
               }
             }
           }
         }
       }
     }
+
+    // Update counter.
+    ++t;
   }
 
-  // Compute Cholesky factor.
+  // Compute Cholesky factor. The loops are arranged so that the innermost
+  // one runs along a row of the band.
   for (int t(0); t < wuw_height; ++t) {
-    for (int i(1); i < wuw_width && i <= t; ++i) {
-      wuw[t][0] -= wuw[t - i][i] * wuw[t - i][i] * wuw[t - i][0];
+    double* a(&(wuw[t][0]));
+    for (int j(1); j < wuw_width && j <= t; ++j) {
+      const double* b(&(wuw[t - j][0]));
+      const double bj(b[j] * b[0]);
+      a[0] -= bj * b[j];
+      for (int i(1); i + j < wuw_width; ++i) {
+        a[i] -= bj * b[i + j];
+      }
     }
 
-    const double z(1.0 / wuw[t][0]);
+    const double z(1.0 / a[0]);
     for (int i(1); i < wuw_width; ++i) {
-      for (int j(1); i + j < wuw_width && j <= t; ++j) {
-        wuw[t][i] -= wuw[t - j][j] * wuw[t - j][i + j] * wuw[t - j][0];
-      }
-      wuw[t][i] *= z;
+      a[i] *= z;
     }
   }
 
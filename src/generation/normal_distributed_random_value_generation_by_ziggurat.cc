@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/generation/normal_distributed_random_value_generation_by_ziggurat.h"
+
+#include <cmath>  // std::exp, std::fabs, std::log, std::sqrt
+
+namespace {
+
+// Number of layers of ziggurat.
+const int kNumLayer(128);
+
+// Start point of tail of normal distribution.
+const double kTailStart(3.442619855899);
+
+// Area of each layer.
+const double kLayerArea(9.91256303526217e-3);
+
+// Scale to convert 53-bit integer into [0, 1).
+const double kScale(1.0 / 9007199254740992.0);
+
+// Increment of Weyl sequence.
+const std::uint64_t kGoldenGamma(0x9E3779B97F4A7C15ULL);
+
+// Finalizer of SplitMix64.
+std::uint64_t Mix(std::uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// Convert 64-bit integer into uniform random number in (0, 1].
+double ConvertToUniform(std::uint64_t x) {
+  return ((x >> 11) + 1) * kScale;
+}
+
+}  // namespace
+
+namespace sptk {
+
+NormalDistributedRandomValueGenerationByZiggurat::
+    NormalDistributedRandomValueGenerationByZiggurat(int seed)
+    : seed_(seed),
+      key_(static_cast<std::uint64_t>(static_cast<std::int64_t>(seed))),
+      position_(0),
+      x_(kNumLayer + 1),
+      f_(kNumLayer + 1),
+      r_(kNumLayer) {
+  // Make table of ziggurat. The 0-th layer includes the tail.
+  x_[0] = kLayerArea / std::exp(-0.5 * kTailStart * kTailStart);
+  x_[1] = kTailStart;
+  x_[kNumLayer] = 0.0;
+  for (int i(2); i < kNumLayer; ++i) {
+    x_[i] = std::sqrt(-2.0 * std::log(kLayerArea / x_[i - 1] +
+                                      std::exp(-0.5 * x_[i - 1] * x_[i - 1])));
+  }
+  for (int i(0); i <= kNumLayer; ++i) {
+    f_[i] = std::exp(-0.5 * x_[i] * x_[i]);
+  }
+  for (int i(0); i < kNumLayer; ++i) {
+    r_[i] = x_[i + 1] / x_[i];
+  }
+}
+
+void NormalDistributedRandomValueGenerationByZiggurat::Reset() {
+  position_ = 0;
+}
+
+bool NormalDistributedRandomValueGenerationByZiggurat::Get(double* output) {
+  if (NULL == output) {
+    return false;
+  }
+
+  *output = Calculate(position_++);
+
+  return true;
+}
+
+bool NormalDistributedRandomValueGenerationByZiggurat::Generate(
+    int length, double* outputs) {
+  if (length < 0 || (0 < length && NULL == outputs)) {
+    return false;
+  }
+
+  for (int i(0); i < length; ++i) {
+    outputs[i] = Calculate(position_++);
+  }
+
+  return true;
+}
+
+double NormalDistributedRandomValueGenerationByZiggurat::Calculate(
+    std::uint64_t position) const {
+  // The first draw is the SplitMix64 sequence indexed by the position. The
+  // additional draws, which are rarely required, follow another SplitMix64
+  // sequence starting from the first draw.
+  std::uint64_t state(key_ + (position + 1) * kGoldenGamma);
+  std::uint64_t random(Mix(state));
+  state = random;
+  for (;;) {
+    const int i(static_cast<int>(random & (kNumLayer - 1)));
+    const double u(2.0 * ((random >> 11) * kScale) - 1.0);
+
+    // Inside of rectangle.
+    if (std::fabs(u) < r_[i]) {
+      return u * x_[i];
+    }
+
+    // Tail.
+    if (0 == i) {
+      double x, y;
+      do {
+        state += kGoldenGamma;
+        x = std::log(ConvertToUniform(Mix(state))) / kTailStart;
+        state += kGoldenGamma;
+        y = std::log(ConvertToUniform(Mix(state)));
+      } while (-2.0 * y < x * x);
+      return (u < 0.0) ? x - kTailStart : kTailStart - x;
+    }
+
+    // Wedge.
+    const double x(u * x_[i]);
+    state += kGoldenGamma;
+    const double y(f_[i] + ConvertToUniform(Mix(state)) * (f_[i + 1] - f_[i]));
+    if (y < std::exp(-0.5 * x * x)) {
+      return x;
+    }
+
+    // Retry.
+    state += kGoldenGamma;
+    random = Mix(state);
+  }
+}
+
+}  // namespace sptk
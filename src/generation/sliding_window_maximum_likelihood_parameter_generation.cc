@@ -0,0 +1,300 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/generation/sliding_window_maximum_likelihood_parameter_generation.h"
+
+#include <algorithm>  // std::fill, std::max
+#include <cstddef>    // std::size_t
+
+namespace sptk {
+
+SlidingWindowMaximumLikelihoodParameterGeneration::
+    SlidingWindowMaximumLikelihoodParameterGeneration(
+        int num_order, int num_future_frame,
+        const std::vector<std::vector<double> >& window_coefficients,
+        InputSourceInterface* input_source)
+    : num_order_(num_order),
+      num_future_frame_(num_future_frame),
+      window_coefficients_(window_coefficients),
+      input_source_(input_source),
+      is_valid_(true),
+      max_half_window_width_(0),
+      num_input_frame_(0),
+      num_factorized_frame_(0),
+      num_output_frame_(0),
+      is_end_of_input_(false) {
+  if (num_order_ < 0 || num_future_frame_ < 0 || NULL == input_source_ ||
+      !input_source_->IsValid()) {
+    is_valid_ = false;
+    return;
+  }
+
+  // Insert window coeffients for static components.
+  window_coefficients_.insert(window_coefficients_.begin(), {1.0});
+
+  for (std::vector<std::vector<double> >::iterator itr(
+           window_coefficients_.begin());
+       itr != window_coefficients_.end(); ++itr) {
+    const int window_width(static_cast<int>(itr->size()));
+    if (0 == window_width % 2) {
+      itr->push_back(0.0);
+    }
+    const int half_window_width(window_width / 2);
+    if (max_half_window_width_ < half_window_width) {
+      max_half_window_width_ = half_window_width;
+    }
+  }
+
+  // The ring buffer must hold the frames used in the backward substitution
+  // and those referred to by the latest factorization.
+  band_width_ = 2 * max_half_window_width_ + 1;
+  ring_size_ = std::max(num_future_frame_, 4 * max_half_window_width_) + 1;
+
+  // Prepare memories.
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int length(static_size * num_window);
+  buffer_.precision.resize(ring_size_ * length);
+  buffer_.weighted_mean.resize(ring_size_ * length);
+  buffer_.wum.resize(ring_size_ * static_size);
+  buffer_.wuw.resize(ring_size_ * band_width_ * static_size);
+  buffer_.g.resize(ring_size_ * static_size);
+  buffer_.l.resize(ring_size_ * band_width_ * static_size);
+  buffer_.c.resize(ring_size_ * static_size);
+}
+
+bool SlidingWindowMaximumLikelihoodParameterGeneration::Get(
+    std::vector<double>* smoothed_static_parameters) {
+  if (!is_valid_ || NULL == smoothed_static_parameters) {
+    return false;
+  }
+
+  // Read inputs until the number of future frames is satisfied.
+  while (!is_end_of_input_ &&
+         num_input_frame_ <= num_output_frame_ + num_future_frame_) {
+    if (input_source_->Get(&buffer_.static_and_dynamic_parameters)) {
+      if (!Push()) {
+        return false;
+      }
+    } else {
+      // Solve the remaining frames at once.
+      is_end_of_input_ = true;
+      Factorize(num_factorized_frame_, num_input_frame_);
+      num_factorized_frame_ = num_input_frame_;
+      Solve(num_output_frame_, num_input_frame_);
+    }
+  }
+
+  if (num_input_frame_ <= num_output_frame_) {
+    return false;
+  }
+
+  // Regard the latest frame as the end of sequence. The factorization of the
+  // last rows is temporary since they will be modified by future inputs.
+  if (!is_end_of_input_) {
+    Factorize(num_factorized_frame_, num_input_frame_);
+    Solve(num_output_frame_, num_input_frame_);
+  }
+
+  const int static_size(num_order_ + 1);
+  if (smoothed_static_parameters->size() !=
+      static_cast<std::size_t>(static_size)) {
+    smoothed_static_parameters->resize(static_size);
+  }
+
+  const double* c(
+      &(buffer_.c[static_size * (num_output_frame_ % ring_size_)]));
+  std::copy(c, c + static_size, smoothed_static_parameters->begin());
+  ++num_output_frame_;
+
+  return true;
+}
+
+bool SlidingWindowMaximumLikelihoodParameterGeneration::Push() {
+  const int num_window(static_cast<int>(window_coefficients_.size()));
+  const int static_size(num_order_ + 1);
+  const int length(static_size * num_window);
+  if (buffer_.static_and_dynamic_parameters.size() !=
+      static_cast<std::size_t>(2 * length)) {
+    return false;
+  }
+
+  // Store inputs.
+  const int n(num_input_frame_);
+  {
+    const double* mean(&(buffer_.static_and_dynamic_parameters[0]));
+    const double* variance(&(buffer_.static_and_dynamic_parameters[length]));
+    double* precision(&(buffer_.precision[length * (n % ring_size_)]));
+    double* weighted_mean(&(buffer_.weighted_mean[length * (n % ring_size_)]));
+    for (int k(0); k < length; ++k) {
+      precision[k] = 1.0 / variance[k];
+      weighted_mean[k] = precision[k] * mean[k];
+    }
+
+    double* r(&(buffer_.wum[static_size * (n % ring_size_)]));
+    std::fill(r, r + static_size, 0.0);
+    double* a(&(buffer_.wuw[static_size * band_width_ * (n % ring_size_)]));
+    std::fill(a, a + static_size * band_width_, 0.0);
+  }
+
+  // Accumulate WUM and WUW of the windows whose support has just been
+  // observed.
+  for (int d(0); d < num_window; ++d) {
+    const int half_window_width(
+        (static_cast<int>(window_coefficients_[d].size()) - 1) / 2);
+    const int s(n - half_window_width);
+    if (s - half_window_width < 0) continue;
+
+    const double* window_coefficients(
+        &(window_coefficients_[d][half_window_width]));
+    const double* precision(&(
+        buffer_.precision[length * (s % ring_size_) + static_size * d]));
+    const double* weighted_mean(&(
+        buffer_.weighted_mean[length * (s % ring_size_) + static_size * d]));
+
+    for (int i(-half_window_width); i <= half_window_width; ++i) {
+      const double w1(window_coefficients[i]);
+      if (0.0 == w1) continue;
+      const int slot((s + i) % ring_size_);
+
+      double* r(&(buffer_.wum[static_size * slot]));
+      for (int m(0); m < static_size; ++m) {
+        r[m] += w1 * weighted_mean[m];
+      }
+
+      for (int j(i); j <= half_window_width; ++j) {
+        const double w2(window_coefficients[j]);
+        if (0.0 == w2) continue;
+        const double w12(w1 * w2);
+        double* a(&(buffer_.wuw[static_size * (band_width_ * slot + j - i)]));
+        for (int m(0); m < static_size; ++m) {
+          a[m] += w12 * precision[m];
+        }
+      }
+    }
+  }
+  ++num_input_frame_;
+
+  // Factorize the rows which are never modified by future inputs.
+  const int end(num_input_frame_ - 2 * max_half_window_width_);
+  if (num_factorized_frame_ < end) {
+    Factorize(num_factorized_frame_, end);
+    num_factorized_frame_ = end;
+  }
+
+  return true;
+}
+
+void SlidingWindowMaximumLikelihoodParameterGeneration::Factorize(int begin,
+                                                                   int end) {
+  const int static_size(num_order_ + 1);
+  const int row_size(static_size * band_width_);
+
+  for (int t(begin); t < end; ++t) {
+    // Compute Cholesky factor.
+    double* a(&(buffer_.l[row_size * (t % ring_size_)]));
+    {
+      const double* u(&(buffer_.wuw[row_size * (t % ring_size_)]));
+      std::copy(u, u + row_size, a);
+    }
+    for (int i(1); i < band_width_ && i <= t; ++i) {
+      const double* b(&(buffer_.l[row_size * ((t - i) % ring_size_)]));
+      for (int m(0); m < static_size; ++m) {
+        a[m] -= b[static_size * i + m] * b[static_size * i + m] * b[m];
+      }
+    }
+    for (int i(1); i < band_width_; ++i) {
+      double* ai(&(a[static_size * i]));
+      for (int j(1); i + j < band_width_ && j <= t; ++j) {
+        const double* b(&(buffer_.l[row_size * ((t - j) % ring_size_)]));
+        for (int m(0); m < static_size; ++m) {
+          ai[m] -= b[static_size * j + m] * b[static_size * (i + j) + m] * b[m];
+        }
+      }
+      for (int m(0); m < static_size; ++m) {
+        ai[m] /= a[m];
+      }
+    }
+
+    // Forward substitution.
+    double* g(&(buffer_.g[static_size * (t % ring_size_)]));
+    {
+      const double* r(&(buffer_.wum[static_size * (t % ring_size_)]));
+      std::copy(r, r + static_size, g);
+    }
+    for (int i(1); i < band_width_ && i <= t; ++i) {
+      const double* b(
+          &(buffer_.l[row_size * ((t - i) % ring_size_) + static_size * i]));
+      const double* h(&(buffer_.g[static_size * ((t - i) % ring_size_)]));
+      for (int m(0); m < static_size; ++m) {
+        g[m] -= b[m] * h[m];
+      }
+    }
+  }
+}
+
+void SlidingWindowMaximumLikelihoodParameterGeneration::Solve(int begin,
+                                                               int end) {
+  const int static_size(num_order_ + 1);
+  const int row_size(static_size * band_width_);
+
+  // Backward substitution.
+  for (int t(end - 1); begin <= t; --t) {
+    double* c(&(buffer_.c[static_size * (t % ring_size_)]));
+    const double* g(&(buffer_.g[static_size * (t % ring_size_)]));
+    const double* a(&(buffer_.l[row_size * (t % ring_size_)]));
+    for (int m(0); m < static_size; ++m) {
+      c[m] = g[m] / a[m];
+    }
+    for (int i(1); i < band_width_ && t + i < end; ++i) {
+      const double* ai(&(a[static_size * i]));
+      const double* h(&(buffer_.c[static_size * ((t + i) % ring_size_)]));
+      for (int m(0); m < static_size; ++m) {
+        c[m] -= ai[m] * h[m];
+      }
+    }
+  }
+}
+
+}  // namespace sptk
@@ -0,0 +1,247 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/input/input_source_from_stream_with_prefetch.h"
+
+#include <algorithm>  // std::fill_n, std::min
+#include <chrono>     // std::chrono::milliseconds
+#include <cmath>      // std::ceil
+#include <cstring>    // std::memcpy
+
+#include "SPTK/utils/profiler.h"
+
+namespace {
+
+const int kDefaultBufferSize(1 << 20);
+const int kDefaultNumBuffer(2);
+const int kChunkSize(1 << 16);
+const std::chrono::milliseconds kMaxWaitTimeForStop(100);
+
+}  // namespace
+
+namespace sptk {
+
+InputSourceFromStreamWithPrefetch::InputSourceFromStreamWithPrefetch(
+    bool zero_padding, int read_size, std::istream* input_stream)
+    : InputSourceFromStreamWithPrefetch(zero_padding, read_size,
+                                        kDefaultBufferSize, kDefaultNumBuffer,
+                                        input_stream) {
+}
+
+InputSourceFromStreamWithPrefetch::InputSourceFromStreamWithPrefetch(
+    bool zero_padding, int read_size, int buffer_size, int num_buffer,
+    std::istream* input_stream)
+    : zero_padding_(zero_padding),
+      read_size_(read_size),
+      buffer_size_(buffer_size),
+      num_buffer_(num_buffer),
+      input_stream_(input_stream),
+      tied_stream_(NULL),
+      is_valid_(true),
+      current_buffer_index_(0),
+      current_position_(0) {
+  if (read_size_ <= 0 || buffer_size_ <= 0 || num_buffer_ <= 0 ||
+      NULL == input_stream_) {
+    is_valid_ = false;
+    return;
+  }
+
+  // A feature container is read in the same way as by sptk::ReadStream.
+  if (!sptk::PrepareInputStream(sizeof(double), input_stream_)) {
+    sptk::ExitOnInputError(input_stream_);
+    is_valid_ = false;
+    return;
+  }
+
+  state_.reset(new State(buffer_size_, num_buffer_));
+
+  // Reading a tied stream flushes the output stream, which must not be done
+  // in the background thread.
+  tied_stream_ = input_stream_->tie(NULL);
+  thread_ = std::thread(&InputSourceFromStreamWithPrefetch::Prefetch, state_,
+                        input_stream_);
+}
+
+InputSourceFromStreamWithPrefetch::~InputSourceFromStreamWithPrefetch() {
+  if (!thread_.joinable()) {
+    return;
+  }
+
+  bool is_finished;
+  {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->is_stopping = true;
+    state_->condition.notify_all();
+    // A read from an idle pipe cannot be interrupted.
+    is_finished = state_->condition.wait_for(
+        lock, kMaxWaitTimeForStop, [this] { return state_->is_finished; });
+  }
+
+  if (is_finished) {
+    thread_.join();
+    input_stream_->tie(tied_stream_);
+  } else {
+    thread_.detach();
+  }
+}
+
+bool InputSourceFromStreamWithPrefetch::Get(std::vector<double>* buffer) {
+  SPTK_PROFILE_SCOPE("InputSourceFromStreamWithPrefetch::Get");
+  if (NULL == buffer || !is_valid_) {
+    return false;
+  }
+
+  if (buffer->size() < static_cast<std::size_t>(read_size_)) {
+    buffer->resize(read_size_);
+  }
+
+  const int type_byte(sizeof((*buffer)[0]));
+  const int num_read_bytes(type_byte * read_size_);
+  char* destination(reinterpret_cast<char*>(&((*buffer)[0])));
+  int gcount(0);
+  while (gcount < num_read_bytes) {
+    int filled_size;
+    bool is_filled;
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      state_->condition.wait(lock, [this] {
+        return 0 == state_->num_used_buffer
+                   ? state_->is_end_of_stream
+                   : (current_position_ <
+                          state_->filled_sizes[current_buffer_index_] ||
+                      state_->is_filled[current_buffer_index_]);
+      });
+      if (0 == state_->num_used_buffer) break;
+      filled_size = state_->filled_sizes[current_buffer_index_];
+      is_filled = state_->is_filled[current_buffer_index_];
+    }
+
+    // The filled part is not touched by the background thread.
+    const int size(
+        std::min(num_read_bytes - gcount, filled_size - current_position_));
+    std::memcpy(destination + gcount,
+                &(state_->buffers[current_buffer_index_][current_position_]),
+                size);
+    gcount += size;
+    current_position_ += size;
+
+    if (is_filled && filled_size == current_position_) {
+      {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        --state_->num_used_buffer;
+      }
+      state_->condition.notify_all();
+      current_buffer_index_ = (current_buffer_index_ + 1) % num_buffer_;
+      current_position_ = 0;
+    }
+  }
+
+  SPTK_PROFILE_BYTE_READ(gcount);
+  SPTK_PROFILE_FRAME(1);
+
+  if (num_read_bytes == gcount) {
+    return true;
+  } else if (zero_padding_ && 0 < gcount) {
+    // Zero incomplete data in the same way as sptk::ReadStream.
+    const int num_zeros(static_cast<int>(
+        std::ceil(static_cast<double>(num_read_bytes - gcount) / type_byte)));
+    std::fill_n(buffer->begin() + read_size_ - num_zeros, num_zeros, 0.0);
+    return true;
+  }
+
+  // The background thread has finished reading the stream.
+  sptk::ExitOnInputError(input_stream_);
+  return false;
+}
+
+void InputSourceFromStreamWithPrefetch::Prefetch(std::shared_ptr<State> state,
+                                                 std::istream* input_stream) {
+  const int buffer_size(static_cast<int>(state->buffers[0].size()));
+  const int num_buffer(static_cast<int>(state->buffers.size()));
+  bool is_running(true);
+  for (int buffer_index(0); is_running;
+       buffer_index = (buffer_index + 1) % num_buffer) {
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->condition.wait(lock, [&state, num_buffer] {
+        return state->num_used_buffer < num_buffer || state->is_stopping;
+      });
+      if (state->is_stopping) break;
+      state->filled_sizes[buffer_index] = 0;
+      state->is_filled[buffer_index] = false;
+      ++state->num_used_buffer;
+    }
+
+    // Publish each chunk so that the caller does not wait for a whole buffer.
+    for (int position(0); is_running && position < buffer_size;) {
+      const int chunk_size(std::min(kChunkSize, buffer_size - position));
+      input_stream->read(&(state->buffers[buffer_index][position]),
+                         chunk_size);
+      const int gcount(static_cast<int>(input_stream->gcount()));
+      position += gcount;
+
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->filled_sizes[buffer_index] = position;
+        if (gcount < chunk_size) {
+          state->is_end_of_stream = true;
+          state->is_filled[buffer_index] = true;
+        } else if (buffer_size == position) {
+          state->is_filled[buffer_index] = true;
+        }
+        is_running = gcount == chunk_size && !state->is_stopping;
+      }
+      state->condition.notify_all();
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->is_finished = true;
+  }
+  state->condition.notify_all();
+}
+
+}  // namespace sptk
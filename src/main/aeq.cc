@@ -135,6 +135,8 @@ void PrintUsage(std::ostream* stream) {
  * @retval 1 Failed to run this command.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   double tolerance(kDefaultTolerance);
   ErrorTypes error_type(kDefaultErrorType);
   bool enable_check_length(kDefaultEnableCheckLengthFlag);
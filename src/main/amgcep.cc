@@ -44,11 +44,12 @@
 
 #include <getopt.h>  // getopt_long
 
-#include <fstream>   // std::ifstream, std::ofstream
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
+#include <algorithm>  // std::min
+#include <fstream>    // std::ifstream, std::ofstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "SPTK/analysis/adaptive_mel_generalized_cepstral_analysis.h"
 #include "SPTK/utils/sptk_utils.h"
@@ -64,6 +65,7 @@ const double kDefaultForgettingFactor(0.98);
 const double kDefaultStepSizeFactor(0.1);
 const int kDefaultOutputPeriod(1);
 const int kDefaultNumPadeOrder(4);
+const int kBufferSize(4096);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -151,6 +153,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   double alpha(kDefaultAlpha);
   int num_stage(kDefaultNumStage);
@@ -337,12 +341,26 @@ int main(int argc, char* argv[]) {
 
   const int length(num_order + 1);
   std::vector<double> mel_generalized_cepstrum(length);
-  double input_signal;
+  std::vector<double> input_signals(kBufferSize);
+  std::vector<double> prediction_errors(kBufferSize);
+
+  // Analyze signals block by block. Each block ends at the output period.
+  for (int num_remaining_sample(output_period);;) {
+    const int block_size(std::min(kBufferSize, num_remaining_sample));
+    int num_read_sample(0);
+    while (num_read_sample < block_size &&
+           sptk::ReadStream(&(input_signals[num_read_sample]),
+                            &input_stream)) {
+      ++num_read_sample;
+    }
+    if (0 == num_read_sample) break;
+    num_remaining_sample -= num_read_sample;
 
-  for (int i(1); sptk::ReadStream(&input_signal, &input_stream); ++i) {
-    double prediction_error;
-    if (!analysis.Run(input_signal, &prediction_error,
-                      &mel_generalized_cepstrum, &buffer)) {
+    if (!analysis.Run(&(input_signals[0]), num_read_sample,
+                      &(prediction_errors[0]),
+                      0 == num_remaining_sample ? &mel_generalized_cepstrum
+                                                : NULL,
+                      &buffer)) {
       std::ostringstream error_message;
       error_message
           << "Failed to run adaptive mel-generalized cepstral analysis";
@@ -351,7 +369,8 @@ int main(int argc, char* argv[]) {
     }
 
     if (NULL != prediction_error_file) {
-      if (!sptk::WriteStream(prediction_error, &output_stream)) {
+      if (!sptk::WriteStream(0, num_read_sample, prediction_errors,
+                             &output_stream, NULL)) {
         std::ostringstream error_message;
         error_message << "Failed to write prediction error";
         sptk::PrintErrorMessage("amgcep", error_message);
@@ -359,7 +378,7 @@ int main(int argc, char* argv[]) {
       }
     }
 
-    if (0 == i % output_period) {
+    if (0 == num_remaining_sample) {
       if (!sptk::WriteStream(0, length, mel_generalized_cepstrum, &std::cout,
                              NULL)) {
         std::ostringstream error_message;
@@ -367,7 +386,7 @@ int main(int argc, char* argv[]) {
         sptk::PrintErrorMessage("amgcep", error_message);
         return 1;
       }
-      i = 0;
+      num_remaining_sample = output_period;
     }
   }
 
@@ -111,6 +111,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   double alpha(kDefaultAlpha);
 
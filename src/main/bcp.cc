@@ -358,6 +358,8 @@ class BlockCopyWrapper {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int input_start_number(kDefaultInputStartNumber);
   int input_end_number(kDefaultInputBlockLength - 1);
   int input_block_length(kDefaultInputBlockLength);
@@ -119,12 +119,26 @@ class BinaryCut : public BinaryCutInterface {
   virtual bool Run(std::istream* input_stream) const {
     std::vector<T> data(block_length_);
 
-    // Skip data.
-    for (int block_index(0); block_index < start_number_; ++block_index) {
-      if (!sptk::ReadStream(false, 0, 0, block_length_, &data, input_stream,
-                            NULL)) {
+    // Skip data. If the input is a regular file, jump to the start block
+    // directly instead of reading the preceding blocks.
+    std::streamoff remaining_size;
+    if (sptk::GetRemainingStreamSize(input_stream, &remaining_size)) {
+      const std::streamoff skip_size(static_cast<std::streamoff>(sizeof(T)) *
+                                     block_length_ * start_number_);
+      if (remaining_size < skip_size) {
         return false;
       }
+      input_stream->seekg(skip_size, std::ios::cur);
+      if (input_stream->fail()) {
+        return false;
+      }
+    } else {
+      for (int block_index(0); block_index < start_number_; ++block_index) {
+        if (!sptk::ReadStream(false, 0, 0, block_length_, &data, input_stream,
+                              NULL)) {
+          return false;
+        }
+      }
     }
 
     // Write data.
@@ -275,6 +289,8 @@ class BinaryCutWrapper {
  * @endcode
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int start_number(kDefaultStartNumber);
   int end_number(kDefaultEndNumber);
   int block_length(kDefaultBlockLength);
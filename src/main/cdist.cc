@@ -204,6 +204,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   OutputFormats output_format(kDefaultOutputFormat);
   bool output_frame_by_frame(kDefaultOutputFrameByFrameFlag);
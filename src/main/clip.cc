@@ -113,6 +113,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   double lower_bound(kDefaultLowerBound);
   double upper_bound(kDefaultUpperBound);
 
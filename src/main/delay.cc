@@ -138,6 +138,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int start_index(kDefaultStartIndex);
   bool keep_sequence_length_flag(kDefaultKeepSequenceLengthFlag);
 
@@ -158,6 +158,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   std::vector<std::vector<double> > window_coefficients({{1.0}});
   bool is_regression_specified(false);
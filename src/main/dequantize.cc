@@ -125,6 +125,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   double absolute_maximum_value(kDefaultAbsoluteMaximumValue);
   int num_bit(kDefaultNumBit);
   sptk::UniformQuantization::QuantizationType quantization_type(
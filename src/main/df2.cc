@@ -104,6 +104,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   double sampling_rate(kDefaultSamplingRate);
   std::vector<double> pole_frequencies;
   std::vector<double> pole_bandwidths;
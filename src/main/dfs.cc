@@ -116,6 +116,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   std::vector<double> denominator_coefficients;
   std::vector<double> numerator_coefficients;
   const char* denominator_coefficients_file(NULL);
@@ -287,6 +287,8 @@ class DataDumpWrapper {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int minimum_index(0);
   int maximum_index(kMagicNumberForEndOfFile);
   std::string print_format("");
@@ -54,6 +54,7 @@
 #include "SPTK/math/distance_calculation.h"
 #include "SPTK/math/dynamic_time_warping.h"
 #include "SPTK/utils/sptk_utils.h"
+#include "SPTK/utils/thread_pool.h"
 
 namespace {
 
@@ -84,6 +85,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "               Viterbi path" << std::endl;
   *stream << "       -S S  : output filename of double type (string)[" << std::setw(5) << std::right << "N/A"                       << "]" << std::endl;  // NOLINT
   *stream << "               total score" << std::endl;
+  *stream << "       -T T  : number of threads              (   int)[" << std::setw(5) << std::right << sptk::ThreadPool::GetDefaultNumThread() << "][ 1 <= T <=   ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  file1:" << std::endl;
   *stream << "       reference vector sequence              (double)" << std::endl;  // NOLINT
@@ -118,6 +120,8 @@ void PrintUsage(std::ostream* stream) {
  *   - int-type Viterbi path
  * - @b -S @e str
  *   - double-type DTW score
+ * - @b -T @e int
+ *   - number of threads to fill the cost matrix @f$(1 \le T)@f$
  * - @b file1 @e str
  *   - double-type reference vector sequence
  * - @b infile @e str
@@ -130,6 +134,15 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+  if (!sptk::ThreadPool::ParseCommandLine(&argc, argv)) {
+    std::ostringstream error_message;
+    error_message << "The argument for the -T option must be a positive "
+                  << "integer";
+    sptk::PrintErrorMessage("dtw", error_message);
+    return 1;
+  }
+
   int num_order(kDefaultNumOrder);
   sptk::DynamicTimeWarping::LocalPathConstraints local_path_constraint(
       kDefaultLocalPathConstraint);
@@ -289,7 +302,8 @@ int main(int argc, char* argv[]) {
   std::vector<std::pair<int, int> > viterbi_path;
   double total_score;
   if (!dynamic_time_warping.Run(query_vectors, reference_vectors, &viterbi_path,
-                                &total_score)) {
+                                &total_score,
+                                &sptk::ThreadPool::GetDefault())) {
     std::ostringstream error_message;
     error_message << "Failed to perform dynamic time warping";
     sptk::PrintErrorMessage("dtw", error_message);
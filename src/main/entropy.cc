@@ -150,6 +150,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_element(kDefaultNumElement);
   sptk::EntropyCalculation::EntropyUnits entropy_unit(kDefaultEntropyUnit);
   bool output_frame_by_frame(kDefaultOutputFrameByFrameFlag);
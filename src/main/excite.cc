@@ -49,20 +49,31 @@
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
 #include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "SPTK/generation/excitation_generation.h"
 #include "SPTK/generation/m_sequence_generation.h"
 #include "SPTK/generation/normal_distributed_random_value_generation.h"
+#include "SPTK/generation/normal_distributed_random_value_generation_by_ziggurat.h"
 #include "SPTK/input/input_source_from_stream.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
 
+enum RandomGenerationMethods {
+  kLinearCongruentialAndPolar = 0,
+  kCounterBasedAndZiggurat,
+  kNumRandomGenerationMethods
+};
+
 const int kDefaultFramePeriod(100);
 const int kDefaultInterpolationPeriod(1);
 const bool kDefaultFlagToUseNormalDistributedRandomValue(false);
 const int kDefaultSeed(1);
+const RandomGenerationMethods kDefaultRandomGenerationMethod(
+    kLinearCongruentialAndPolar);
 const double kMagicNumberForUnvoicedFrame(0.0);
+const int kBufferSize(4096);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -77,6 +88,9 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -n    : use gauss noise for unvoiced frame (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultFlagToUseNormalDistributedRandomValue) << "]" << std::endl;  // NOLINT
   *stream << "               default is M-sequence" << std::endl;
   *stream << "       -s s  : seed for random generation         (   int)[" << std::setw(5) << std::right << kDefaultSeed                << "][   <= s <=     ]" << std::endl;  // NOLINT
+  *stream << "       -g g  : gauss noise generation method      (   int)[" << std::setw(5) << std::right << kDefaultRandomGenerationMethod << "][ 0 <= g <= 1   ]" << std::endl;  // NOLINT
+  *stream << "                 0 (linear congruential and polar method)" << std::endl;  // NOLINT
+  *stream << "                 1 (counter-based and ziggurat method)" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       pitch period                               (double)[stdin]" << std::endl;  // NOLINT
@@ -84,6 +98,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       excitation                                 (double)" << std::endl;  // NOLINT
   *stream << "  notice:" << std::endl;
   *stream << "       if i = 0, don't interpolate pitch" << std::endl;
+  *stream << "       -g option is valid only if -n option is specified" << std::endl;  // NOLINT
   *stream << "       magic number for unvoiced frame is " << kMagicNumberForUnvoicedFrame << std::endl;  // NOLINT
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
@@ -104,6 +119,10 @@ void PrintUsage(std::ostream* stream) {
  *   - use gaussian noise instead of M-sequence for unvoiced frame
  * - @b -s @e double
  *   - seed for random number generation
+ * - @b -g @e int
+ *   - gaussian noise generation method
+ *     \arg @c 0 linear congruential and polar method
+ *     \arg @c 1 counter-based and ziggurat method
  * - @b infile @e str
  *   - pitch period
  * - @b stdout
@@ -128,14 +147,18 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int frame_period(kDefaultFramePeriod);
   int interpolation_period(kDefaultInterpolationPeriod);
   bool use_normal_distributed_random_value(
       kDefaultFlagToUseNormalDistributedRandomValue);
   int seed(kDefaultSeed);
+  RandomGenerationMethods random_generation_method(
+      kDefaultRandomGenerationMethod);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "p:i:ns:h", NULL, NULL));
+    const int option_char(getopt_long(argc, argv, "p:i:ns:g:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -174,6 +197,21 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'g': {
+        const int min(0);
+        const int max(static_cast<int>(kNumRandomGenerationMethods) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -g option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("excite", error_message);
+          return 1;
+        }
+        random_generation_method = static_cast<RandomGenerationMethods>(tmp);
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -230,7 +268,11 @@ int main(int argc, char* argv[]) {
   // Run excitation generation.
   sptk::RandomGenerationInterface* random_generation(NULL);
   try {
-    if (use_normal_distributed_random_value) {
+    if (use_normal_distributed_random_value &&
+        kCounterBasedAndZiggurat == random_generation_method) {
+      random_generation =
+          new sptk::NormalDistributedRandomValueGenerationByZiggurat(seed);
+    } else if (use_normal_distributed_random_value) {
       random_generation =
           new sptk::NormalDistributedRandomValueGeneration(seed);
     } else {
@@ -247,9 +289,11 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
-    double excitation;
-    while (excitation_generation.Get(&excitation, NULL, NULL, NULL)) {
-      if (!sptk::WriteStream(excitation, &std::cout)) {
+    std::vector<double> excitation(kBufferSize);
+    int num_samples;
+    while (excitation_generation.Get(kBufferSize, &(excitation[0]), NULL, NULL,
+                                     NULL, &num_samples)) {
+      if (!sptk::WriteStream(0, num_samples, excitation, &std::cout, NULL)) {
         std::ostringstream error_message;
         error_message << "Failed to write excitation";
         sptk::PrintErrorMessage("excite", error_message);
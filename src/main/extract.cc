@@ -129,6 +129,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int vector_length(kDefaultVectorLength);
   int codebook_index(kDefaultCodebookIndex);
 
@@ -224,6 +226,38 @@ int main(int argc, char* argv[]) {
   int index;
   std::vector<double> input_vector(vector_length);
 
+  std::streamoff remaining_size;
+  if (sptk::GetRemainingStreamSize(&stream_for_input, &remaining_size)) {
+    // Seek to the vectors to be extracted and skip the others without reading.
+    const std::streamoff vector_size(
+        static_cast<std::streamoff>(sizeof(input_vector[0])) * vector_length);
+    const std::streamoff num_vector(remaining_size / vector_size);
+    const std::streamoff start_position(stream_for_input.tellg());
+    std::streamoff next_vector_index(0);
+    for (std::streamoff vector_index(0);
+         vector_index < num_vector &&
+         sptk::ReadStream(&index, &stream_for_index);
+         ++vector_index) {
+      if (index != codebook_index) continue;
+      if (next_vector_index != vector_index) {
+        stream_for_input.seekg(start_position + vector_index * vector_size);
+      }
+      if (!sptk::ReadStream(false, 0, 0, vector_length, &input_vector,
+                            &stream_for_input, NULL)) {
+        break;
+      }
+      next_vector_index = vector_index + 1;
+      if (!sptk::WriteStream(0, vector_length, input_vector, &std::cout,
+                             NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write extracted vector";
+        sptk::PrintErrorMessage("extract", error_message);
+        return 1;
+      }
+    }
+    return 0;
+  }
+
   while (sptk::ReadStream(&index, &stream_for_index) &&
          sptk::ReadStream(false, 0, 0, vector_length, &input_vector,
                           &stream_for_input, NULL)) {
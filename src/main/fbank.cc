@@ -159,6 +159,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_channel(kDefaultNumChannel);
   int fft_length(kDefaultFftLength);
   double sampling_rate(kDefaultSamplingRate);
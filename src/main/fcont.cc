@@ -0,0 +1,453 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include <getopt.h>  // getopt_long
+
+#include <algorithm>  // std::min
+#include <cstdint>    // int64_t
+#include <cstring>    // std::strncmp
+#include <fstream>    // std::ifstream
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include "SPTK/utils/feature_container.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+enum ModeType { kPack = 0, kUnpack, kPrintHeader, kNumModeTypes };
+
+const ModeType kDefaultModeType(kPack);
+const int kDefaultVectorLength(1);
+const double kDefaultFramePeriod(0.0);
+const double kDefaultSamplingRate(0.0);
+const int kMagicNumberForAllChunks(-1);
+const char* kDefaultDataType("d");
+
+const int kNumFrameInBlock(256);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " fcont - feature container" << std::endl;
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       fcont [ options ] [ infile ] > stdout" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -o o  : mode                 (   int)[" << std::setw(5) << std::right << kDefaultModeType      << "][ 0 <= o <= 2 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (raw stream to container)" << std::endl;
+  *stream << "                 1 (container to raw stream)" << std::endl;
+  *stream << "                 2 (print header of container)" << std::endl;
+  *stream << "       -l l  : length of vector     (   int)[" << std::setw(5) << std::right << kDefaultVectorLength  << "][ 1 <= l <=   ]" << std::endl;  // NOLINT
+  *stream << "       -m m  : order of vector      (   int)[" << std::setw(5) << std::right << "l-1"                 << "][ 0 <= m <=   ]" << std::endl;  // NOLINT
+  *stream << "       -p p  : frame period         (double)[" << std::setw(5) << std::right << kDefaultFramePeriod   << "][ 0 <= p <=   ]" << std::endl;  // NOLINT
+  *stream << "       -s s  : sampling rate [kHz]  (double)[" << std::setw(5) << std::right << kDefaultSamplingRate  << "][ 0 <= s <=   ]" << std::endl;  // NOLINT
+  *stream << "       -c c  : chunk length file    (string)[" << std::setw(5) << std::right << "N/A"                 << "]" << std::endl;  // NOLINT
+  *stream << "       -u u  : chunk index          (   int)[" << std::setw(5) << std::right << "N/A"                 << "][ 0 <= u <=   ]" << std::endl;  // NOLINT
+  *stream << "       +type : data type                    [" << std::setw(5) << std::right << kDefaultDataType      << "]" << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("c", stream); sptk::PrintDataType("C", stream); *stream << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("s", stream); sptk::PrintDataType("S", stream); *stream << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("h", stream); sptk::PrintDataType("H", stream); *stream << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("i", stream); sptk::PrintDataType("I", stream); *stream << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("l", stream); sptk::PrintDataType("L", stream); *stream << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("f", stream); sptk::PrintDataType("d", stream); *stream << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("e", stream);                                   *stream << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       raw stream or container      (  type)[stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       container or raw stream      (  type)" << std::endl;
+  *stream << "  notice:" << std::endl;
+  *stream << "       chunk length file is int-type sequence of the number of frames in each chunk" << std::endl;  // NOLINT
+  *stream << "       in mode 1 and 2, infile must be a regular file" << std::endl;  // NOLINT
+  *stream << "       in mode 1, -l, -m and +type are checked against the header if given" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+/**
+ * @a fcont [ @e option ] [ @e infile ]
+ *
+ * - @b -o @e int
+ *   - mode
+ *     \arg @c 0 raw stream to container
+ *     \arg @c 1 container to raw stream
+ *     \arg @c 2 print header of container
+ * - @b -l @e int
+ *   - length of vector @f$(1 \le L)@f$
+ * - @b -m @e int
+ *   - order of vector @f$(0 \le L - 1)@f$
+ * - @b -p @e double
+ *   - frame period @f$(0 \le P)@f$
+ * - @b -s @e double
+ *   - sampling rate in kHz @f$(0 \le F_s)@f$
+ * - @b -c @e str
+ *   - int-type number of frames in each chunk
+ * - @b -u @e int
+ *   - chunk index to be extracted @f$(0 \le U)@f$
+ * - @b +type @e char
+ *   - data type
+ * - @b infile @e str
+ *   - raw stream or container
+ * - @b stdout
+ *   - container or raw stream
+ *
+ * A feature container is a raw stream with a small header describing the data
+ * type, the vector length, the frame period, and the sampling rate, followed by
+ * an index of chunks, e.g., utterances. Since the shape is stored in the file,
+ * it can be checked when the stream is unpacked. Any chunk is read directly
+ * from the memory-mapped file without scanning the preceding frames.
+ *
+ * Other commands also accept a container as their input and read its frames
+ * as a raw stream. No frame is read if the size of the data type in the
+ * header differs from that of their input.
+ *
+ * @code{.sh}
+ *   # Pack two utterances of 25-dimensional features.
+ *   echo 120 80 | x2x +ai > len.i
+ *   cat utt1.mcep utt2.mcep | fcont -l 25 -p 80 -s 16 -c len.i > feats.fc
+ *   # Extract the second utterance.
+ *   fcont -o 1 -u 1 -l 25 feats.fc > utt2.mcep
+ *   # Read all frames.
+ *   mgc2sp -m 24 -l 512 feats.fc > feats.sp
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
+  ModeType mode(kDefaultModeType);
+  int vector_length(kDefaultVectorLength);
+  double frame_period(kDefaultFramePeriod);
+  double sampling_rate(kDefaultSamplingRate);
+  const char* chunk_file(NULL);
+  int chunk_index(kMagicNumberForAllChunks);
+  std::string data_type(kDefaultDataType);
+  bool is_vector_length_specified(false);
+  bool is_data_type_specified(false);
+
+  for (;;) {
+    const int option_char(
+        getopt_long(argc, argv, "o:l:m:p:s:c:u:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'o': {
+        const int min(0);
+        const int max(static_cast<int>(kNumModeTypes) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -o option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("fcont", error_message);
+          return 1;
+        }
+        mode = static_cast<ModeType>(tmp);
+        break;
+      }
+      case 'l': {
+        if (!sptk::ConvertStringToInteger(optarg, &vector_length) ||
+            vector_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -l option must be a positive integer";
+          sptk::PrintErrorMessage("fcont", error_message);
+          return 1;
+        }
+        is_vector_length_specified = true;
+        break;
+      }
+      case 'm': {
+        if (!sptk::ConvertStringToInteger(optarg, &vector_length) ||
+            vector_length < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -m option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("fcont", error_message);
+          return 1;
+        }
+        ++vector_length;
+        is_vector_length_specified = true;
+        break;
+      }
+      case 'p': {
+        if (!sptk::ConvertStringToDouble(optarg, &frame_period) ||
+            frame_period < 0.0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -p option must be a "
+                        << "non-negative number";
+          sptk::PrintErrorMessage("fcont", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 's': {
+        if (!sptk::ConvertStringToDouble(optarg, &sampling_rate) ||
+            sampling_rate < 0.0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -s option must be a "
+                        << "non-negative number";
+          sptk::PrintErrorMessage("fcont", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'c': {
+        chunk_file = optarg;
+        break;
+      }
+      case 'u': {
+        if (!sptk::ConvertStringToInteger(optarg, &chunk_index) ||
+            chunk_index < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -u option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("fcont", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  // Get input file.
+  const char* input_file(NULL);
+  for (int i(argc - optind); 1 <= i; --i) {
+    const char* arg(argv[argc - i]);
+    if (0 == std::strncmp(arg, "+", 1)) {
+      const std::string str(arg);
+      data_type = str.substr(1, std::string::npos);
+      is_data_type_specified = true;
+    } else if (NULL == input_file) {
+      input_file = arg;
+    } else {
+      std::ostringstream error_message;
+      error_message << "Too many input files";
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+  }
+
+  if (kPack != mode) {
+    if (NULL == input_file) {
+      std::ostringstream error_message;
+      error_message << "Container must be given as a file";
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+
+    sptk::FeatureContainerReader reader(input_file);
+    if (!reader.IsValid()) {
+      std::ostringstream error_message;
+      error_message << "Failed to read feature container " << input_file;
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+    const sptk::FeatureContainerHeader& header(reader.GetHeader());
+
+    if (kPrintHeader == mode) {
+      std::cout << "data type      : " << header.data_type << std::endl;
+      std::cout << "vector length  : " << header.vector_length << std::endl;
+      std::cout << "frame period   : " << header.frame_period << std::endl;
+      std::cout << "sampling rate  : " << header.sampling_rate << std::endl;
+      std::cout << "num frames     : " << reader.GetNumFrame() << std::endl;
+      std::cout << "num chunks     : " << reader.GetNumChunk() << std::endl;
+      return 0;
+    }
+
+    if (is_vector_length_specified && vector_length != header.vector_length) {
+      std::ostringstream error_message;
+      error_message << "Vector length " << vector_length
+                    << " does not match that in header "
+                    << header.vector_length;
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+    if (is_data_type_specified && data_type != header.data_type) {
+      std::ostringstream error_message;
+      error_message << "Data type " << data_type
+                    << " does not match that in header " << header.data_type;
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+
+    sptk::FeatureContainerChunk chunk = {0, reader.GetNumFrame()};
+    if (kMagicNumberForAllChunks != chunk_index &&
+        !reader.GetChunk(chunk_index, &chunk)) {
+      std::ostringstream error_message;
+      error_message << "Chunk " << chunk_index << " does not exist";
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+
+    if (0 < chunk.num_frame) {
+      std::cout.write(reader.GetFrame(chunk.first_frame),
+                      static_cast<std::streamsize>(reader.GetFrameSize()) *
+                          chunk.num_frame);
+      if (std::cout.fail()) {
+        std::ostringstream error_message;
+        error_message << "Failed to write frames";
+        sptk::PrintErrorMessage("fcont", error_message);
+        return 1;
+      }
+    }
+
+    return 0;
+  }
+
+  // Open stream.
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("fcont", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  std::ifstream ifs_for_chunk;
+  if (NULL != chunk_file) {
+    ifs_for_chunk.open(chunk_file, std::ios::in | std::ios::binary);
+    if (ifs_for_chunk.fail()) {
+      std::ostringstream error_message;
+      error_message << "Cannot open file " << chunk_file;
+      sptk::PrintErrorMessage("fcont", error_message);
+      return 1;
+    }
+  }
+
+  sptk::FeatureContainerHeader header;
+  header.data_type = data_type;
+  header.vector_length = vector_length;
+  header.frame_period = frame_period;
+  header.sampling_rate = sampling_rate;
+  sptk::FeatureContainerWriter writer(header, &std::cout);
+  if (!writer.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Unexpected argument for the +type option";
+    sptk::PrintErrorMessage("fcont", error_message);
+    return 1;
+  }
+
+  // Copy frames splitting them into chunks.
+  const int frame_size(writer.GetFrameSize());
+  std::vector<char> frames(frame_size * kNumFrameInBlock);
+  bool has_chunk_length(NULL != chunk_file);
+  int num_remaining_frame_in_chunk(0);
+  for (;;) {
+    input_stream.read(&frames[0], frames.size());
+    const int num_frame(static_cast<int>(input_stream.gcount() / frame_size));
+
+    for (int offset(0); offset < num_frame;) {
+      int num_frame_to_write(num_frame - offset);
+      if (has_chunk_length) {
+        while (0 == num_remaining_frame_in_chunk) {
+          if (!sptk::ReadStream(&num_remaining_frame_in_chunk,
+                                &ifs_for_chunk)) {
+            // The rest of frames forms the last chunk.
+            has_chunk_length = false;
+            num_remaining_frame_in_chunk = 0;
+            break;
+          }
+          if (num_remaining_frame_in_chunk < 0) {
+            std::ostringstream error_message;
+            error_message << "Chunk length must be non-negative";
+            sptk::PrintErrorMessage("fcont", error_message);
+            return 1;
+          }
+          writer.StartChunk();
+        }
+        if (has_chunk_length) {
+          num_frame_to_write =
+              std::min(num_frame_to_write, num_remaining_frame_in_chunk);
+          num_remaining_frame_in_chunk -= num_frame_to_write;
+        } else if (0 < writer.GetNumFrame()) {
+          writer.StartChunk();
+        }
+      }
+
+      if (!writer.Write(&frames[offset * frame_size], num_frame_to_write)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write frames";
+        sptk::PrintErrorMessage("fcont", error_message);
+        return 1;
+      }
+      offset += num_frame_to_write;
+    }
+
+    if (input_stream.gcount() < static_cast<std::streamsize>(frames.size())) {
+      break;
+    }
+  }
+
+  if (!writer.Close()) {
+    std::ostringstream error_message;
+    error_message << "Failed to write chunk index";
+    sptk::PrintErrorMessage("fcont", error_message);
+    return 1;
+  }
+
+  return 0;
+}
@@ -132,6 +132,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int start_index(kDefaultStartIndex);
   int num_column(kDefaultNumColumn);
   AddressFormats address_format(kDefaultAddressFormat);
@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+#include <getopt.h>  // getopt_long
+
+#include <fstream>   // std::ifstream
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
+#include <vector>    // std::vector
+
+#include "SPTK/compression/lossless_feature_decoding.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+const int kMagicNumberForEndOfFile(-1);
+const int kDefaultStartNumber(0);
+const int kDefaultEndNumber(kMagicNumberForEndOfFile);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " feature_decode - lossless decoding of vector sequence" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       feature_decode [ options ] [ infile ] > stdout" << std::endl;  // NOLINT
+  *stream << "  options:" << std::endl;
+  *stream << "       -s s  : start chunk number (   int)[" << std::setw(5) << std::right << kDefaultStartNumber << "][ 0 <= s <= e ]" << std::endl;  // NOLINT
+  *stream << "       -e e  : end chunk number   (   int)[" << std::setw(5) << std::right << "EOF"               << "][ s <= e <=   ]" << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       encoded sequence           (  char)[stdin]" << std::endl;
+  *stream << "  stdout:" << std::endl;
+  *stream << "       vector sequence            (  type)" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+/**
+ * @a feature_decode [ @e option ] [ @e infile ]
+ *
+ * - @b -s @e int
+ *   - start chunk number @f$(0 \le S)@f$
+ * - @b -e @e int
+ *   - end chunk number @f$(S \le E)@f$
+ * - @b infile @e str
+ *   - encoded sequence
+ * - @b stdout
+ *   - vector sequence
+ *
+ * The vector length and the data type are read from the header of the encoded
+ * sequence. The chunks before @f$S@f$ are skipped without decoding.
+ *
+ * @code{.sh}
+ *   feature_encode -l 25 -c 100 < data.mcep > data.mcep.enc
+ *   # Decode 200th to 299th frames.
+ *   feature_decode -s 2 -e 2 data.mcep.enc > data.mcep.part
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
+  int start_number(kDefaultStartNumber);
+  int end_number(kDefaultEndNumber);
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "s:e:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 's': {
+        if (!sptk::ConvertStringToInteger(optarg, &start_number) ||
+            start_number < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -s option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("feature_decode", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'e': {
+        if (!sptk::ConvertStringToInteger(optarg, &end_number) ||
+            end_number < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -e option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("feature_decode", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  if (kMagicNumberForEndOfFile != end_number && end_number < start_number) {
+    std::ostringstream error_message;
+    error_message << "End number must be equal to or greater than start number";
+    sptk::PrintErrorMessage("feature_decode", error_message);
+    return 1;
+  }
+
+  const int num_input_files(argc - optind);
+  if (1 < num_input_files) {
+    std::ostringstream error_message;
+    error_message << "Too many input files";
+    sptk::PrintErrorMessage("feature_decode", error_message);
+    return 1;
+  }
+  const char* input_file(0 == num_input_files ? NULL : argv[optind]);
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("feature_decode", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  sptk::LosslessFeatureDecoding decoding(&input_stream);
+  sptk::LosslessFeatureDecoding::Buffer buffer;
+  if (!decoding.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Failed to read header of encoded sequence";
+    sptk::PrintErrorMessage("feature_decode", error_message);
+    return 1;
+  }
+
+  for (int chunk_index(0); chunk_index < start_number; ++chunk_index) {
+    int num_frame;
+    if (!decoding.Skip(&input_stream, &num_frame)) {
+      return 0;
+    }
+  }
+
+  std::vector<char> frames;
+  int num_frame;
+  for (int chunk_index(start_number);
+       kMagicNumberForEndOfFile == end_number || chunk_index <= end_number;
+       ++chunk_index) {
+    if (!decoding.Run(&input_stream, &frames, &num_frame, &buffer)) {
+      // Reaching the end of stream at a chunk boundary is not an error.
+      if (input_stream.eof() && 0 == input_stream.gcount()) break;
+      std::ostringstream error_message;
+      error_message << "Failed to decode " << chunk_index << "th chunk";
+      sptk::PrintErrorMessage("feature_decode", error_message);
+      return 1;
+    }
+
+    std::cout.write(&frames[0], static_cast<std::streamsize>(num_frame) *
+                                    decoding.GetFrameSize());
+    if (std::cout.fail()) {
+      std::ostringstream error_message;
+      error_message << "Failed to write decoded sequence";
+      sptk::PrintErrorMessage("feature_decode", error_message);
+      return 1;
+    }
+  }
+
+  return 0;
+}
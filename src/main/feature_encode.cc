@@ -0,0 +1,246 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+#include <getopt.h>  // getopt_long
+
+#include <climits>   // INT_MAX
+#include <cstring>   // std::strncmp
+#include <fstream>   // std::ifstream
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include "SPTK/compression/lossless_feature_encoding.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+const int kDefaultVectorLength(1);
+const int kDefaultChunkLength(4096);
+const char* kDefaultDataType("d");
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " feature_encode - lossless encoding of vector sequence" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       feature_encode [ options ] [ infile ] > stdout" << std::endl;  // NOLINT
+  *stream << "  options:" << std::endl;
+  *stream << "       -l l  : length of vector   (   int)[" << std::setw(5) << std::right << kDefaultVectorLength << "][ 1 <= l <=   ]" << std::endl;  // NOLINT
+  *stream << "       -m m  : order of vector    (   int)[" << std::setw(5) << std::right << "l-1"                << "][ 0 <= m <=   ]" << std::endl;  // NOLINT
+  *stream << "       -c c  : frames in a chunk  (   int)[" << std::setw(5) << std::right << kDefaultChunkLength  << "][ 1 <= c <=   ]" << std::endl;  // NOLINT
+  *stream << "       +type : data type                  [" << std::setw(5) << std::right << kDefaultDataType     << "]" << std::endl;  // NOLINT
+  *stream << "                 "; sptk::PrintDataType("f", stream); sptk::PrintDataType("d", stream); *stream << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       vector sequence            (  type)[stdin]" << std::endl;
+  *stream << "  stdout:" << std::endl;
+  *stream << "       encoded sequence           (  char)" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+/**
+ * @a feature_encode [ @e option ] [ @e infile ]
+ *
+ * - @b -l @e int
+ *   - length of vector @f$(1 \le L)@f$
+ * - @b -m @e int
+ *   - order of vector @f$(0 \le L - 1)@f$
+ * - @b -c @e int
+ *   - number of frames in a chunk @f$(1 \le C)@f$
+ * - @b +type @e char
+ *   - data type, f (float) or d (double)
+ * - @b infile @e str
+ *   - vector sequence
+ * - @b stdout
+ *   - encoded sequence
+ *
+ * Each element is predicted by the same element of the previous frame, and
+ * only the significant bytes of the XOR residual are stored. The encoding is
+ * lossless, and the stream is split into chunks of @f$C@f$ frames which can be
+ * decoded independently. An incomplete frame at the end of input is dropped.
+ * Other commands decode the encoded stream given as their input by themselves.
+ *
+ * @code{.sh}
+ *   feature_encode -l 25 < data.mcep > data.mcep.enc
+ *   feature_decode < data.mcep.enc > data.mcep2
+ *   # data.mcep and data.mcep2 are identical
+ *   mgc2sp -m 24 -l 512 data.mcep.enc > data.sp
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
+  int vector_length(kDefaultVectorLength);
+  int chunk_length(kDefaultChunkLength);
+  std::string data_type(kDefaultDataType);
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "l:m:c:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'l': {
+        if (!sptk::ConvertStringToInteger(optarg, &vector_length) ||
+            vector_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -l option must be a positive integer";
+          sptk::PrintErrorMessage("feature_encode", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'm': {
+        if (!sptk::ConvertStringToInteger(optarg, &vector_length) ||
+            vector_length < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -m option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("feature_encode", error_message);
+          return 1;
+        }
+        ++vector_length;
+        break;
+      }
+      case 'c': {
+        if (!sptk::ConvertStringToInteger(optarg, &chunk_length) ||
+            chunk_length <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -c option must be a positive integer";
+          sptk::PrintErrorMessage("feature_encode", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  const char* input_file(NULL);
+  for (int i(argc - optind); 1 <= i; --i) {
+    const char* arg(argv[argc - i]);
+    if (0 == std::strncmp(arg, "+", 1)) {
+      const std::string str(arg);
+      data_type = str.substr(1, std::string::npos);
+    } else if (NULL == input_file) {
+      input_file = arg;
+    } else {
+      std::ostringstream error_message;
+      error_message << "Too many input files";
+      sptk::PrintErrorMessage("feature_encode", error_message);
+      return 1;
+    }
+  }
+
+  std::ifstream ifs;
+  ifs.open(input_file, std::ios::in | std::ios::binary);
+  if (ifs.fail() && NULL != input_file) {
+    std::ostringstream error_message;
+    error_message << "Cannot open file " << input_file;
+    sptk::PrintErrorMessage("feature_encode", error_message);
+    return 1;
+  }
+  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
+
+  sptk::LosslessFeatureEncoding encoding(vector_length, data_type);
+  sptk::LosslessFeatureEncoding::Buffer buffer;
+  if (!encoding.IsValid()) {
+    std::ostringstream error_message;
+    error_message << "Failed to initialize LosslessFeatureEncoding";
+    sptk::PrintErrorMessage("feature_encode", error_message);
+    return 1;
+  }
+
+  const int frame_size(encoding.GetFrameSize());
+  if (INT_MAX / frame_size < chunk_length) {
+    std::ostringstream error_message;
+    error_message << "Chunk is too large";
+    sptk::PrintErrorMessage("feature_encode", error_message);
+    return 1;
+  }
+
+  if (!encoding.WriteHeader(&std::cout)) {
+    std::ostringstream error_message;
+    error_message << "Failed to write header";
+    sptk::PrintErrorMessage("feature_encode", error_message);
+    return 1;
+  }
+
+  std::vector<char> frames(static_cast<std::size_t>(frame_size) *
+                           chunk_length);
+  for (;;) {
+    input_stream.read(&frames[0], frames.size());
+    const int num_frame(static_cast<int>(input_stream.gcount() / frame_size));
+    if (0 < num_frame &&
+        !encoding.Run(&frames[0], num_frame, &std::cout, &buffer)) {
+      std::ostringstream error_message;
+      error_message << "Failed to encode";
+      sptk::PrintErrorMessage("feature_encode", error_message);
+      return 1;
+    }
+    if (num_frame < chunk_length) break;
+  }
+
+  return 0;
+}
@@ -133,6 +133,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int fft_length(kDefaultFftLength);
   int num_order(kDefaultFftLength - 1);
   bool is_num_order_specified(false);
@@ -146,6 +146,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int fft_length(kDefaultFftLength);
   int num_row(kDefaultFftLength);
   int num_column(kDefaultFftLength);
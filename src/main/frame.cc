@@ -42,29 +42,19 @@
 // POSSIBILITY OF SUCH DAMAGE.                                       //
 // ----------------------------------------------------------------- //
 
-#include <getopt.h>  // getopt_long
-
-#include <algorithm>  // std::copy, std::fill, std::transform
-#include <fstream>    // std::ifstream
-#include <iomanip>    // std::setw
-#include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
-#include <numeric>    // std::accumulate
-#include <sstream>    // std::ostringstream
-#include <vector>     // std::vector
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
 
+#include "SPTK/command/frame_command.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
 
-enum FramingTypes {
-  kBegginingOfDataIsCenterOfFirstFrame,
-  kBegginingOfDataIsStartOfFirstFrame,
-  kNumFramingTypes,
-};
-
-const int kDefaultFrameLength(256);
-const int kDefaultFramePeriod(100);
-const FramingTypes kDefaultFramingType(kBegginingOfDataIsCenterOfFirstFrame);
+const int kDefaultFrameLength(sptk::FrameCommand::kDefaultFrameLength);
+const int kDefaultFramePeriod(sptk::FrameCommand::kDefaultFramePeriod);
+const sptk::FrameCommand::FramingTypes kDefaultFramingType(
+    sptk::FrameCommand::kDefaultFramingType);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -91,30 +81,6 @@ void PrintUsage(std::ostream* stream) {
   // clang-format on
 }
 
-bool WriteData(const std::vector<double>& data, bool zero_mean) {
-  if (zero_mean) {
-    std::vector<double> processed_data(data.size());
-    const double mean(std::accumulate(data.begin(), data.end(), 0.0) /
-                      data.size());
-    std::transform(data.begin(), data.end(), processed_data.begin(),
-                   [mean](double x) { return x - mean; });
-    if (!sptk::WriteStream(0, data.size(), processed_data, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write data";
-      sptk::PrintErrorMessage("frame", error_message);
-      return false;
-    }
-  } else {
-    if (!sptk::WriteStream(0, data.size(), data, &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write data";
-      sptk::PrintErrorMessage("frame", error_message);
-      return false;
-    }
-  }
-  return true;
-}
-
 }  // namespace
 
 /**
@@ -173,172 +139,8 @@ bool WriteData(const std::vector<double>& data, bool zero_mean) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
-  int frame_length(kDefaultFrameLength);
-  int frame_period(kDefaultFramePeriod);
-  FramingTypes framing_type(kDefaultFramingType);
-  bool zero_mean(false);
-
-  for (;;) {
-    const int option_char(getopt_long(argc, argv, "l:p:n:zh", NULL, NULL));
-    if (-1 == option_char) break;
-
-    switch (option_char) {
-      case 'l': {
-        if (!sptk::ConvertStringToInteger(optarg, &frame_length) ||
-            frame_length <= 0) {
-          std::ostringstream error_message;
-          error_message
-              << "The argument for the -l option must be a positive integer";
-          sptk::PrintErrorMessage("frame", error_message);
-          return 1;
-        }
-        break;
-      }
-      case 'p': {
-        if (!sptk::ConvertStringToInteger(optarg, &frame_period) ||
-            frame_period <= 0) {
-          std::ostringstream error_message;
-          error_message
-              << "The argument for the -p option must be a positive integer";
-          sptk::PrintErrorMessage("frame", error_message);
-          return 1;
-        }
-        break;
-      }
-      case 'n': {
-        const int min(0);
-        const int max(static_cast<int>(kNumFramingTypes) - 1);
-        int tmp;
-        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
-            !sptk::IsInRange(tmp, min, max)) {
-          std::ostringstream error_message;
-          error_message << "The argument for the -n option must be an integer "
-                        << "in the range of " << min << " to " << max;
-          sptk::PrintErrorMessage("frame", error_message);
-          return 1;
-        }
-        framing_type = static_cast<FramingTypes>(tmp);
-        break;
-      }
-      case 'z': {
-        zero_mean = true;
-        break;
-      }
-      case 'h': {
-        PrintUsage(&std::cout);
-        return 0;
-      }
-      default: {
-        PrintUsage(&std::cerr);
-        return 1;
-      }
-    }
-  }
-
-  const int num_rest_args(argc - optind);
-  if (1 < num_rest_args) {
-    std::ostringstream error_message;
-    error_message << "Too many input files";
-    sptk::PrintErrorMessage("frame", error_message);
-    return 1;
-  }
-  const char* input_file(0 == num_rest_args ? NULL : argv[optind]);
-
-  std::ifstream ifs;
-  ifs.open(input_file, std::ios::in | std::ios::binary);
-  if (ifs.fail() && NULL != input_file) {
-    std::ostringstream error_message;
-    error_message << "Cannot open file " << input_file;
-    sptk::PrintErrorMessage("frame", error_message);
-    return 1;
-  }
-  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
-
-  std::vector<double> data(frame_length);
-  int actual_read_size;
-
-  // Extract the first frame.
-  {
-    int read_point;
-    int read_size;
-    if (kBegginingOfDataIsCenterOfFirstFrame == framing_type) {
-      if (0 == frame_length % 2) {
-        read_point = frame_length / 2;
-        read_size = frame_length / 2;
-      } else {
-        read_point = (frame_length - 1) / 2;
-        read_size = (frame_length + 1) / 2;
-      }
-    } else if (kBegginingOfDataIsStartOfFirstFrame == framing_type) {
-      read_point = 0;
-      read_size = frame_length;
-    } else {
-      return 0;
-    }
-
-    if (!sptk::ReadStream(true, 0, read_point, read_size, &data, &input_stream,
-                          &actual_read_size)) {
-      return 0;
-    }
-  }
-
-  // Extract the remaining frames.
-  const int overlap(frame_length - frame_period);
-  if (0 < overlap) {
-    bool is_eof(input_stream.peek() == std::ios::traits_type::eof());
-    int center;
-    if (kBegginingOfDataIsCenterOfFirstFrame == framing_type) {
-      center = frame_length / 2;
-    } else if (kBegginingOfDataIsStartOfFirstFrame == framing_type) {
-      center = 0;
-    } else {
-      return 0;
-    }
-    int last_data_position_in_frame(center + actual_read_size - 1);
-    while (center <= last_data_position_in_frame) {
-      if (is_eof) {
-        std::fill(data.begin() + last_data_position_in_frame + 1, data.end(),
-                  0.0);
-      }
-
-      // Write framed data.
-      if (!WriteData(data, zero_mean)) {
-        return 1;
-      }
-
-      // Move overlapped data.
-      std::copy(data.begin() + frame_period, data.end(), data.begin());
-
-      // Read next data.
-      if (is_eof) {
-        last_data_position_in_frame -= frame_period;
-      } else {
-        if (!sptk::ReadStream(true, 0, overlap, frame_period, &data,
-                              &input_stream, &actual_read_size)) {
-          std::ostringstream error_message;
-          error_message << "Failed to read data";
-          sptk::PrintErrorMessage("frame", error_message);
-          return 1;
-        }
-
-        if (input_stream.peek() == std::iostream::traits_type::eof()) {
-          last_data_position_in_frame = overlap + actual_read_size - 1;
-          is_eof = true;
-        }
-      }
-    }
-  } else {
-    if (!WriteData(data, zero_mean)) {
-      return 1;
-    }
-
-    while (sptk::ReadStream(true, -overlap, 0, frame_length, &data,
-                            &input_stream, NULL)) {
-      if (!WriteData(data, zero_mean)) {
-        return 1;
-      }
-    }
-  }
+  sptk::InitializeCommand(&argc, argv);
 
-  return 0;
+  sptk::FrameCommand command;
+  return sptk::RunCommand("frame", argc, argv, PrintUsage, &command);
 }
@@ -50,6 +50,7 @@
 #include <sstream>   // std::ostringstream
 #include <vector>    // std::vector
 
+#include "SPTK/input/input_source_from_stream_with_prefetch.h"
 #include "SPTK/math/gaussian_mixture_modeling.h"
 #include "SPTK/utils/sptk_utils.h"
 
@@ -158,6 +159,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   int num_mixture(kDefaultNumMixture);
   int num_iteration(kDefaultNumIteration);
@@ -333,7 +336,9 @@ int main(int argc, char* argv[]) {
 
     const int length(num_order + 1);
     std::vector<double> tmp(length);
-    while (sptk::ReadStream(false, 0, 0, length, &tmp, &input_stream, NULL)) {
+    sptk::InputSourceFromStreamWithPrefetch input_source(false, length,
+                                                         &input_stream);
+    while (input_source.Get(&tmp)) {
       input_vectors.push_back(tmp);
     }
   }
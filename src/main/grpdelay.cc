@@ -134,6 +134,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int fft_length(kDefaultFftLength);
   int num_numerator_order(kDefaultNumNumeratorOrder);
   int num_denominator_order(kDefaultNumDenominatorOrder);
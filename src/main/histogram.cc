@@ -119,6 +119,8 @@ void PrintUsage(std::ostream* stream) {
  * @endcode
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_interval(kMagicNumberForEndOfFile);
   int num_bin(kDefaultNumBin);
   double lower_bound(kDefaultLowerBound);
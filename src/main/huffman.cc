@@ -99,6 +99,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int start_index(kDefaultStartIndex);
   const char* average_code_length_file(NULL);
 
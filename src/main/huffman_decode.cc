@@ -98,6 +98,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   for (;;) {
     const int option_char(getopt_long(argc, argv, "h", NULL, NULL));
     if (-1 == option_char) break;
@@ -122,6 +122,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_subband(kDefaultNumSubband);
   int num_filter_order(kDefaultNumFilterOrder);
   double attenuation(kDefaultAttenuation);
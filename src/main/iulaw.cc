@@ -104,6 +104,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   double abs_max_value(kDefaultAbsMaxValue);
   double compression_factor(kDefaultCompressionFactor);
 
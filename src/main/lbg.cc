@@ -51,8 +51,10 @@
 #include <vector>    // std::vector
 
 #include "SPTK/compression/linde_buzo_gray_algorithm.h"
+#include "SPTK/input/input_source_from_stream_with_prefetch.h"
 #include "SPTK/math/statistics_accumulation.h"
 #include "SPTK/utils/sptk_utils.h"
+#include "SPTK/utils/thread_pool.h"
 
 namespace {
 
@@ -80,6 +82,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "               initial codebook" << std::endl;
   *stream << "       -I I  : output filename of int type   (string)[" << std::setw(5) << std::right << "N/A"                         << "]" << std::endl;  // NOLINT
   *stream << "               codebook index" << std::endl;
+  *stream << "       -T T  : number of threads             (   int)[" << std::setw(5) << std::right << sptk::ThreadPool::GetDefaultNumThread() << "][   1 <= T <=   ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "     (level 2)" << std::endl;
   *stream << "       -n n  : minimum number of vectors in  (   int)[" << std::setw(5) << std::right << kDefaultMinNumVectorInCluster << "][   1 <= n <=   ]" << std::endl;  // NOLINT
@@ -117,6 +120,8 @@ void PrintUsage(std::ostream* stream) {
  *   - double-type initial codebook
  * - @b -I @e str
  *   - int-type output codebook index
+ * - @b -T @e int
+ *   - number of threads to quantize training vectors @f$(1 \le T)@f$
  * - @b -n @e int
  *   - minimum number of vectors in a cluster @f$(1 \le V)@f$
  * - @b -i @e int
@@ -142,6 +147,15 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+  if (!sptk::ThreadPool::ParseCommandLine(&argc, argv)) {
+    std::ostringstream error_message;
+    error_message << "The argument for the -T option must be a positive "
+                  << "integer";
+    sptk::PrintErrorMessage("lbg", error_message);
+    return 1;
+  }
+
   int num_order(kDefaultNumOrder);
   int seed(kDefaultSeed);
   int target_codebook_size(kDefaultTargetCodebookSize);
@@ -287,7 +301,9 @@ int main(int argc, char* argv[]) {
   std::vector<std::vector<double> > input_vectors;
   {
     std::vector<double> tmp(length);
-    while (sptk::ReadStream(false, 0, 0, length, &tmp, &input_stream, NULL)) {
+    sptk::InputSourceFromStreamWithPrefetch input_source(false, length,
+                                                         &input_stream);
+    while (input_source.Get(&tmp)) {
       input_vectors.push_back(tmp);
     }
   }
@@ -356,7 +372,8 @@ int main(int argc, char* argv[]) {
 
   std::vector<int> codebook_indices(input_vectors.size());
   if (!codebook_design.Run(input_vectors, &codebook_vectors,
-                           &codebook_indices)) {
+                           &codebook_indices,
+                           &sptk::ThreadPool::GetDefault())) {
     std::ostringstream error_message;
     error_message << "Failed to design codebook";
     sptk::PrintErrorMessage("lbg", error_message);
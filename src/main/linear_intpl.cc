@@ -137,6 +137,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_length(kDefaultOutputLength);
   double minimum_x(-DBL_MAX);
   double maximum_x(DBL_MAX);
@@ -62,6 +62,8 @@ const int kDefaultFrameLength(256);
 const int kDefaultNumOrder(25);
 const WarningType kDefaultWarningType(kIgnore);
 
+const int kNumFrameInBlock(64);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -124,6 +126,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int frame_length(kDefaultFrameLength);
   int num_order(kDefaultNumOrder);
   WarningType warning_type(kDefaultWarningType);
@@ -219,43 +223,70 @@ int main(int argc, char* argv[]) {
   }
 
   const int output_length(num_order + 1);
-  std::vector<double> windowed_sequence(frame_length);
-  std::vector<double> autocorrelation(output_length);
-  std::vector<double> linear_predictive_coefficients(output_length);
+  std::vector<std::vector<double> > windowed_sequences(
+      kNumFrameInBlock, std::vector<double>(frame_length));
+  std::vector<std::vector<double> > autocorrelations;
+  std::vector<std::vector<double> > linear_predictive_coefficients;
+  std::vector<bool> is_stable;
 
-  for (int frame_index(0); sptk::ReadStream(
-           false, 0, 0, frame_length, &windowed_sequence, &input_stream, NULL);
-       ++frame_index) {
-    if (!waveform_to_autocorrelation.Run(windowed_sequence, &autocorrelation)) {
-      std::ostringstream error_message;
-      error_message << "Failed to obtain autocorrelation";
-      sptk::PrintErrorMessage("lpc", error_message);
-      return 1;
+  for (int frame_index(0);;) {
+    // Read a block of frames without waiting for input to fill it, so that
+    // output is not delayed when the input stalls.
+    windowed_sequences.resize(kNumFrameInBlock,
+                              std::vector<double>(frame_length));
+    int num_frame(0);
+    while (num_frame < kNumFrameInBlock &&
+           (0 == num_frame || sptk::IsInputPending(&input_stream)) &&
+           sptk::ReadStream(false, 0, 0, frame_length,
+                            &windowed_sequences[num_frame], &input_stream,
+                            NULL)) {
+      ++num_frame;
     }
+    if (0 == num_frame) break;
+    windowed_sequences.resize(num_frame);
 
-    bool is_stable(false);
-    if (!levinson_durbin_recursion.Run(autocorrelation,
-                                       &linear_predictive_coefficients,
-                                       &is_stable, &buffer)) {
+    if (!waveform_to_autocorrelation.Run(windowed_sequences,
+                                         &autocorrelations)) {
       std::ostringstream error_message;
-      error_message << "Failed to solve autocorrelation normal equations";
+      error_message << "Failed to obtain autocorrelation";
       sptk::PrintErrorMessage("lpc", error_message);
       return 1;
     }
 
-    if (!is_stable && kIgnore != warning_type) {
-      std::ostringstream error_message;
-      error_message << frame_index << "th frame is unstable";
-      sptk::PrintErrorMessage("lpc", error_message);
-      if (kExit == warning_type) return 1;
-    }
+    // If any frame fails, solve the frames one by one below to find it.
+    const bool is_block_successful(levinson_durbin_recursion.Run(
+        autocorrelations, &linear_predictive_coefficients, &is_stable,
+        &buffer));
 
-    if (!sptk::WriteStream(0, output_length, linear_predictive_coefficients,
-                           &std::cout, NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write linear predictive coefficients";
-      sptk::PrintErrorMessage("lpc", error_message);
-      return 1;
+    for (int n(0); n < num_frame; ++n, ++frame_index) {
+      if (!is_block_successful) {
+        bool is_stable_in_frame(false);
+        if (!levinson_durbin_recursion.Run(autocorrelations[n],
+                                           &linear_predictive_coefficients[n],
+                                           &is_stable_in_frame, &buffer)) {
+          std::ostringstream error_message;
+          error_message << "Failed to solve autocorrelation normal equations";
+          sptk::PrintErrorMessage("lpc", error_message);
+          return 1;
+        }
+        is_stable[n] = is_stable_in_frame;
+      }
+
+      if (!is_stable[n] && kIgnore != warning_type) {
+        std::ostringstream error_message;
+        error_message << frame_index << "th frame is unstable";
+        sptk::PrintErrorMessage("lpc", error_message);
+        if (kExit == warning_type) return 1;
+      }
+
+      if (!sptk::WriteStream(0, output_length,
+                             linear_predictive_coefficients[n], &std::cout,
+                             NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write linear predictive coefficients";
+        sptk::PrintErrorMessage("lpc", error_message);
+        return 1;
+      }
     }
   }
 
@@ -79,6 +79,7 @@ const OutputFormats kDefaultOutputFormat(kFrequencyInRadians);
 const int kDefaultNumSplit(256);
 const int kDefaultNumIteration(4);
 const double kDefaultConvergenceThreshold(1e-6);
+const bool kDefaultUsePreviousFrame(false);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -104,6 +105,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -n n  : number of splits of unit circle         (   int)[" << std::setw(5) << std::right << kDefaultNumSplit             << "][   1 <= n <=   ]" << std::endl;  // NOLINT
   *stream << "       -i i  : maximum number of iterations            (   int)[" << std::setw(5) << std::right << kDefaultNumIteration         << "][   1 <= i <=   ]" << std::endl;  // NOLINT
   *stream << "       -d d  : convergence threshold                   (double)[" << std::setw(5) << std::right << kDefaultConvergenceThreshold << "][ 0.0 <= d <=   ]" << std::endl;  // NOLINT
+  *stream << "       -c    : search around LSP of previous frame     (  bool)[" << std::setw(5) << std::right << sptk::ConvertBooleanToString(kDefaultUsePreviousFrame) << "]" << std::endl;  // NOLINT
   *stream << "  infile:" << std::endl;
   *stream << "       linear predictive coefficients                  (double)[stdin]" << std::endl;  // NOLINT
   *stream << "  stdout:" << std::endl;
@@ -140,6 +142,8 @@ void PrintUsage(std::ostream* stream) {
  *   - maximum number of iterations @f$(1 \le N)@f$
  * - @b -d @e double
  *   - convergence threshold @f$(0 \le \epsilon)@f$
+ * - @b -c @e bool
+ *   - search roots around LSP of previous frame first
  * - @b infile @e str
  *   - double-type LPC coefficients
  * - @b stdout
@@ -151,11 +155,19 @@ void PrintUsage(std::ostream* stream) {
  *   frame < data.d | window | lpc -m 10 | lpc2lsp -m 10 > data.lsp
  * @endcode
  *
+ * Since LSP coefficients change slowly between frames, @b -c option reduces
+ * the computation by searching each root near the root of the previous frame.
+ * If the root is not found there, the whole unit circle is searched as usual.
+ * The result can slightly differ from that without @b -c option within the
+ * accuracy of the root finding.
+ *
  * @param[in] argc Number of arguments.
  * @param[in] argv Argument vector.
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   double sampling_frequency(kDefaultSamplingFrequency);
   OutputGainType output_gain_type(kDefaultOutputGainType);
@@ -163,10 +175,11 @@ int main(int argc, char* argv[]) {
   int num_split(kDefaultNumSplit);
   int num_iteration(kDefaultNumIteration);
   double convergence_threshold(kDefaultConvergenceThreshold);
+  bool use_previous_frame(kDefaultUsePreviousFrame);
 
   for (;;) {
     const int option_char(
-        getopt_long(argc, argv, "m:s:k:o:n:i:d:h", NULL, NULL));
+        getopt_long(argc, argv, "m:s:k:o:n:i:d:ch", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -255,6 +268,10 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'c': {
+        use_previous_frame = true;
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -287,7 +304,8 @@ int main(int argc, char* argv[]) {
 
   sptk::LinearPredictiveCoefficientsToLineSpectralPairs
       linear_predictive_coefficients_to_line_spectral_pairs(
-          num_order, num_split, num_iteration, convergence_threshold);
+          num_order, num_split, num_iteration, convergence_threshold,
+          use_previous_frame);
   sptk::LinearPredictiveCoefficientsToLineSpectralPairs::Buffer buffer;
   if (!linear_predictive_coefficients_to_line_spectral_pairs.IsValid()) {
     std::ostringstream error_message;
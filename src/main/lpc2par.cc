@@ -120,6 +120,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   double gamma(kDefaultGamma);
   WarningType warning_type(kDefaultWarningType);
@@ -139,6 +139,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   double sampling_frequency(kDefaultSamplingFrequency);
   InputGainType input_gain_type(kDefaultInputGainType);
@@ -197,6 +197,8 @@ double GetScale(InputOutputFormats format, double sampling_frequency) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   double sampling_frequency(kDefaultSamplingFrequency);
   GainType gain_type(kDefaultGainType);
@@ -163,6 +163,8 @@ bool OutputMedian(const std::vector<std::vector<double> >& input_vectors) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int vector_length(kDefaultVectorLength);
   int output_interval(kMagicNumberForEndOfFile);
 
@@ -304,6 +304,8 @@ class VectorMergeWrapper {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int insert_point(kDefaultInsertPoint);
   int input_length(kDefaultFrameLengthOfInputData);
   int insert_length(kDefaultFrameLengthOfInsertData);
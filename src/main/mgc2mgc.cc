@@ -151,6 +151,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int input_num_order(kDefaultInputNumOrder);
   double input_alpha(kDefaultInputAlpha);
   double input_gamma(kDefaultInputGamma);
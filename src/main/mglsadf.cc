@@ -235,6 +235,8 @@ class InputSourcePreprocessingForMelCepstrum
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_filter_order(kDefaultNumFilterOrder);
   double alpha(kDefaultAlpha);
   int num_stage(kDefaultNumStage);
@@ -197,6 +197,8 @@ bool WriteMinMaxValues(
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   int num_best(kDefaultNumBest);
   OutputFormats output_format(kDefaultOutputFormat);
@@ -52,6 +52,7 @@
 
 #include "SPTK/generation/nonrecursive_maximum_likelihood_parameter_generation.h"
 #include "SPTK/generation/recursive_maximum_likelihood_parameter_generation.h"
+#include "SPTK/generation/sliding_window_maximum_likelihood_parameter_generation.h"
 #include "SPTK/input/input_source_from_stream.h"
 #include "SPTK/input/input_source_interface.h"
 #include "SPTK/utils/sptk_utils.h"
@@ -69,10 +70,11 @@ enum InputFormats {
   kNumInputFormats
 };
 
-enum Modes { kRecursive = 0, kNonrecursive, kNumModes };
+enum Modes { kRecursive = 0, kNonrecursive, kSlidingWindow, kNumModes };
 
 const int kDefaultNumOrder(25);
 const int kDefaultNumPastFrame(30);
+const int kDefaultNumFutureFrame(30);
 const InputFormats kDefaultInputFormat(kMeanAndVariance);
 const Modes kDefaultMode(kRecursive);
 
@@ -87,6 +89,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -l l          : length of vector        (   int)[" << std::setw(5) << std::right << kDefaultNumOrder + 1 << "][ 1 <= l <=   ]" << std::endl;  // NOLINT
   *stream << "       -m m          : order of vector         (   int)[" << std::setw(5) << std::right << "l-1"                << "][ 0 <= m <=   ]" << std::endl;  // NOLINT
   *stream << "       -s s          : number of past frames   (   int)[" << std::setw(5) << std::right << kDefaultNumPastFrame << "][ r <= s <=   ]" << std::endl;  // NOLINT
+  *stream << "       -f f          : number of future frames (   int)[" << std::setw(5) << std::right << kDefaultNumFutureFrame << "][ 0 <= f <=   ]" << std::endl;  // NOLINT
   *stream << "       -q q          : input format            (   int)[" << std::setw(5) << std::right << kDefaultInputFormat  << "][ 0 <= q <= 2 ]" << std::endl;  // NOLINT
   *stream << "                         0 (mean and variance)" << std::endl;
   *stream << "                         1 (mean and precision)" << std::endl;
@@ -97,9 +100,10 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -r r1 (r2)    : width of regression     (   int)[" << std::setw(5) << std::right << "N/A"                << "]" << std::endl;  // NOLINT
   *stream << "                       coefficients" << std::endl;
   *stream << "       -magic magic  : magic number            (double)[" << std::setw(5) << std::right << "N/A"                << "]" << std::endl;  // NOLINT
-  *stream << "       -R            : mode                    (   int)[" << std::setw(5) << std::right << kDefaultMode         << "][ 0 <= R <= 1 ]" << std::endl;  // NOLINT
+  *stream << "       -R            : mode                    (   int)[" << std::setw(5) << std::right << kDefaultMode         << "][ 0 <= R <= 2 ]" << std::endl;  // NOLINT
   *stream << "                         0 (recursive)" << std::endl;
   *stream << "                         1 (non-recursive)" << std::endl;
+  *stream << "                         2 (sliding window)" << std::endl;
   *stream << "       -h            : print this message" << std::endl;
   *stream << "  infile:" << std::endl;
   *stream << "       mean and variance parameter sequence    (double)[stdin]" << std::endl;  // NOLINT
@@ -108,7 +112,8 @@ void PrintUsage(std::ostream* stream) {
   *stream << "  notice:" << std::endl;
   *stream << "       -d and -D options can be given multiple times" << std::endl;  // NOLINT
   *stream << "       -s option is valid with R=0" << std::endl;
-  *stream << "       -magic option is not supported with R=0" << std::endl;
+  *stream << "       -f option is valid with R=2" << std::endl;
+  *stream << "       -magic option is valid with R=1" << std::endl;
   *stream << std::endl;
   *stream << " SPTK: version " << sptk::kVersion << std::endl;
   *stream << std::endl;
@@ -196,6 +201,8 @@ class InputSourcePreprocessing : public sptk::InputSourceInterface {
  *   - order of vector @f$(0 \le M)@f$
  * - @b -s @e int
  *   - number of past frames @f$(0 \le S)@f$
+ * - @b -f @e int
+ *   - number of future frames @f$(0 \le L)@f$
  * - @b -q @e int
  *   - input format
  *     \arg @c 0 @f$\boldsymbol{\mu}@f$, @f$\boldsymbol{\varSigma}@f$
@@ -214,14 +221,18 @@ class InputSourcePreprocessing : public sptk::InputSourceInterface {
  *   - mode
  *     \arg @c 0 recursive (Kalman filter)
  *     \arg @c 1 non-recursive (Cholesky decomposition)
+ *     \arg @c 2 sliding window (incremental Cholesky decomposition)
  * - @b infile @e str
  *   - double-type mean and variance parameter sequence
  * - @b stdout
  *   - double-type static parameter sequence
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_order(kDefaultNumOrder);
   int num_past_frame(kDefaultNumPastFrame);
+  int num_future_frame(kDefaultNumFutureFrame);
   InputFormats input_format(kDefaultInputFormat);
   std::vector<std::vector<double> > window_coefficients;
   bool is_regression_specified(false);
@@ -235,7 +246,7 @@ int main(int argc, char* argv[]) {
 
   for (;;) {
     const int option_char(
-        getopt_long_only(argc, argv, "l:m:s:q:d:D:r:R:h", long_options, NULL));
+        getopt_long_only(argc, argv, "l:m:s:f:q:d:D:r:R:h", long_options, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -273,6 +284,17 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'f': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_future_frame) ||
+            num_future_frame < 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -f option must be a "
+                        << "non-negative integer";
+          sptk::PrintErrorMessage("mlpg", error_message);
+          return 1;
+        }
+        break;
+      }
       case 'q': {
         const int min(0);
         const int max(static_cast<int>(kNumInputFormats) - 1);
@@ -449,20 +471,41 @@ int main(int argc, char* argv[]) {
   sptk::InputSourceFromStream input_source(false, read_size, &input_stream);
   InputSourcePreprocessing preprocessed_source(input_format, &input_source);
 
+  if (kNonrecursive != mode && is_magic_number_specified) {
+    std::ostringstream error_message;
+    error_message << "Magic number is supported only on non-recursive mode";
+    sptk::PrintErrorMessage("mlpg", error_message);
+    return 1;
+  }
+
   if (kRecursive == mode) {
-    if (is_magic_number_specified) {
+    sptk::RecursiveMaximumLikelihoodParameterGeneration generation(
+        num_order, num_past_frame, window_coefficients, &preprocessed_source);
+    if (!generation.IsValid()) {
       std::ostringstream error_message;
-      error_message << "Magic number is not supported on recursive mode";
+      error_message << "Failed to initialize "
+                       "RecursiveMaximumLikelihoodParameterGeneration";
       sptk::PrintErrorMessage("mlpg", error_message);
       return 1;
     }
 
-    sptk::RecursiveMaximumLikelihoodParameterGeneration generation(
-        num_order, num_past_frame, window_coefficients, &preprocessed_source);
+    std::vector<double> smoothed_static_parameters(static_size);
+    while (generation.Get(&smoothed_static_parameters)) {
+      if (!sptk::WriteStream(0, static_size, smoothed_static_parameters,
+                             &std::cout, NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write static parameters";
+        sptk::PrintErrorMessage("mlpg", error_message);
+        return 1;
+      }
+    }
+  } else if (kSlidingWindow == mode) {
+    sptk::SlidingWindowMaximumLikelihoodParameterGeneration generation(
+        num_order, num_future_frame, window_coefficients, &preprocessed_source);
     if (!generation.IsValid()) {
       std::ostringstream error_message;
       error_message << "Failed to initialize "
-                       "RecursiveMaximumLikelihoodParameterGeneration";
+                       "SlidingWindowMaximumLikelihoodParameterGeneration";
       sptk::PrintErrorMessage("mlpg", error_message);
       return 1;
     }
@@ -183,6 +183,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_filter_order(kDefaultNumFilterOrder);
   int fft_length(kDefaultFftLength);
   double alpha(kDefaultAlpha);
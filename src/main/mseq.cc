@@ -44,9 +44,11 @@
 
 #include <getopt.h>  // getopt_long
 
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
+#include <algorithm>  // std::min
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "SPTK/generation/m_sequence_generation.h"
 #include "SPTK/utils/sptk_utils.h"
@@ -54,6 +56,7 @@
 namespace {
 
 const int kMagicNumberForInfinity(-1);
+const int kBufferSize(4096);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -100,6 +103,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_length(kMagicNumberForInfinity);
 
   for (;;) {
@@ -150,16 +155,20 @@ int main(int argc, char* argv[]) {
 
   sptk::MSequenceGeneration generator;
 
-  for (int i(0); kMagicNumberForInfinity == output_length || i < output_length;
-       ++i) {
-    double output;
-    if (!generator.Get(&output)) {
+  // Generate and write m-sequence block by block.
+  std::vector<double> outputs(kBufferSize);
+  const bool is_infinite(kMagicNumberForInfinity == output_length);
+  for (int i(0); is_infinite || i < output_length;) {
+    const int block_size(is_infinite ? kBufferSize
+                                     : std::min(kBufferSize, output_length - i));
+    if (!is_infinite) i += block_size;
+    if (!generator.Generate(block_size, &(outputs[0]))) {
       std::ostringstream error_message;
       error_message << "Failed to generate m-sequence";
       sptk::PrintErrorMessage("mseq", error_message);
       return 1;
     }
-    if (!sptk::WriteStream(output, &std::cout)) {
+    if (!sptk::WriteStream(0, block_size, outputs, &std::cout, NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write m-sequence";
       sptk::PrintErrorMessage("mseq", error_message);
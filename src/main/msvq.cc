@@ -52,11 +52,16 @@
 
 #include "SPTK/compression/multistage_vector_quantization.h"
 #include "SPTK/utils/sptk_utils.h"
+#include "SPTK/utils/thread_pool.h"
 
 namespace {
 
 const int kDefaultNumOrder(25);
 
+// Number of vectors read at a time per thread when running on more than one
+// thread.
+const int kNumVectorPerThread(64);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -68,6 +73,7 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -l l  : length of vector   (   int)[" << std::setw(5) << std::right << kDefaultNumOrder + 1 << "][ 1 <= l <=   ]" << std::endl;  // NOLINT
   *stream << "       -m m  : order of vector    (   int)[" << std::setw(5) << std::right << "l-1"                << "][ 0 <= m <=   ]" << std::endl;  // NOLINT
   *stream << "       -s s  : codebook file      (string)[" << std::setw(5) << std::right << "N/A"                << "]" << std::endl;  // NOLINT
+  *stream << "       -T T  : number of threads  (   int)[" << std::setw(5) << std::right << sptk::ThreadPool::GetDefaultNumThread() << "][ 1 <= T <=   ]" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  cbfile:" << std::endl;
   *stream << "       codebook                   (double)" << std::endl;
@@ -92,6 +98,8 @@ void PrintUsage(std::ostream* stream) {
  *   - order of vector @f$(0 \le M)@f$
  * - @b -s @e str
  *   - codebook file
+ * - @b -T @e int
+ *   - number of threads @f$(1 \le T)@f$
  * - @b infile @e str
  *   - double-type vector to be quantized
  * - @b stdout
@@ -108,6 +116,15 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+  if (!sptk::ThreadPool::ParseCommandLine(&argc, argv)) {
+    std::ostringstream error_message;
+    error_message << "The argument for the -T option must be a positive "
+                  << "integer";
+    sptk::PrintErrorMessage("msvq", error_message);
+    return 1;
+  }
+
   int num_order(kDefaultNumOrder);
   std::vector<char*> codebook_vectors_file;
 
@@ -206,7 +223,6 @@ int main(int argc, char* argv[]) {
 
   sptk::MultistageVectorQuantization multistage_vector_quantization(num_order,
                                                                     num_stage);
-  sptk::MultistageVectorQuantization::Buffer buffer;
   if (!multistage_vector_quantization.IsValid()) {
     std::ostringstream error_message;
     error_message << "Failed to initialize MultistageVectorQuantization";
@@ -214,24 +230,37 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  std::vector<double> input_vector(length);
-  std::vector<int> codebook_indices(num_stage);
-
-  while (sptk::ReadStream(false, 0, 0, length, &input_vector,
-                          &stream_for_input_vectors, NULL)) {
-    if (!multistage_vector_quantization.Run(input_vector, codebook_vectors,
-                                            &codebook_indices, &buffer)) {
-      std::ostringstream error_message;
-      error_message << "Failed to quantize vector";
-      sptk::PrintErrorMessage("msvq", error_message);
-      return 1;
-    }
-    if (!sptk::WriteStream(0, num_stage, codebook_indices, &std::cout, NULL)) {
-      std::ostringstream error_message;
+  // Vectors are quantized in parallel and written in the input order.
+  sptk::ThreadPool& thread_pool(sptk::ThreadPool::GetDefault());
+  const int num_thread(thread_pool.GetNumThread());
+  const int block_size(1 == num_thread ? 1 : kNumVectorPerThread * num_thread);
+  bool is_write_failed(false);
+  if (!thread_pool.ParallelMap<std::vector<double>, std::vector<int> >(
+          block_size,
+          [&](std::vector<double>* input_vector) {
+            input_vector->resize(length);
+            return sptk::ReadStream(false, 0, 0, length, input_vector,
+                                    &stream_for_input_vectors, NULL);
+          },
+          [&](const std::vector<double>& input_vector,
+              std::vector<int>* codebook_indices) {
+            sptk::MultistageVectorQuantization::Buffer buffer;
+            return multistage_vector_quantization.Run(
+                input_vector, codebook_vectors, codebook_indices, &buffer);
+          },
+          [&](const std::vector<int>& codebook_indices) {
+            is_write_failed = !sptk::WriteStream(0, num_stage, codebook_indices,
+                                                 &std::cout, NULL);
+            return !is_write_failed;
+          })) {
+    std::ostringstream error_message;
+    if (is_write_failed) {
       error_message << "Failed to write codebook index";
-      sptk::PrintErrorMessage("msvq", error_message);
-      return 1;
+    } else {
+      error_message << "Failed to quantize vector";
     }
+    sptk::PrintErrorMessage("msvq", error_message);
+    return 1;
   }
 
   return 0;
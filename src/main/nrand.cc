@@ -44,20 +44,33 @@
 
 #include <getopt.h>  // getopt_long
 
-#include <cmath>     // std::pow, std::sqrt
-#include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cout, std::endl, etc.
-#include <sstream>   // std::ostringstream
+#include <algorithm>  // std::min
+#include <cmath>      // std::pow, std::sqrt
+#include <iomanip>    // std::setw
+#include <iostream>   // std::cerr, std::cout, std::endl, etc.
+#include <sstream>    // std::ostringstream
+#include <vector>     // std::vector
 
 #include "SPTK/generation/normal_distributed_random_value_generation.h"
+#include "SPTK/generation/normal_distributed_random_value_generation_by_ziggurat.h"
+#include "SPTK/generation/random_generation_interface.h"
 #include "SPTK/utils/sptk_utils.h"
 
 namespace {
 
+enum RandomGenerationMethods {
+  kLinearCongruentialAndPolar = 0,
+  kCounterBasedAndZiggurat,
+  kNumRandomGenerationMethods
+};
+
 const int kMagicNumberForInfinity(-1);
+const int kBufferSize(4096);
 const int kDefaultSeed(1);
 const double kDefaultMean(0.0);
 const double kDefaultStandardDeviation(1.0);
+const RandomGenerationMethods kDefaultRandomGenerationMethod(
+    kLinearCongruentialAndPolar);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -73,6 +86,9 @@ void PrintUsage(std::ostream* stream) {
   *stream << "       -u u  : mean               (double)[" << std::setw(5) << std::right << kDefaultMean                             << "][     <= u <=   ]" << std::endl;  // NOLINT
   *stream << "       -v v  : variance           (double)[" << std::setw(5) << std::right << std::pow(kDefaultStandardDeviation, 2.0) << "][ 0.0 <= v <=   ]" << std::endl;  // NOLINT
   *stream << "       -d d  : standard deviation (double)[" << std::setw(5) << std::right << kDefaultStandardDeviation                << "][ 0.0 <= d <=   ]" << std::endl;  // NOLINT
+  *stream << "       -g g  : generation method  (   int)[" << std::setw(5) << std::right << kDefaultRandomGenerationMethod           << "][   0 <= g <= 1 ]" << std::endl;  // NOLINT
+  *stream << "                 0 (linear congruential and polar method)" << std::endl;  // NOLINT
+  *stream << "                 1 (counter-based and ziggurat method)" << std::endl;  // NOLINT
   *stream << "       -h    : print this message" << std::endl;
   *stream << "  stdout:" << std::endl;
   *stream << "       random values              (double)" << std::endl;
@@ -99,6 +115,10 @@ void PrintUsage(std::ostream* stream) {
  *   - variance @f$(0 \le \sigma^2)@f$
  * - @b -d @e double
  *   - standard deviation @f$(0 \le \sigma)@f$
+ * - @b -g @e int
+ *   - random generation method
+ *     \arg @c 0 linear congruential and polar method
+ *     \arg @c 1 counter-based and ziggurat method
  * - @b stdout
  *   - double-type random values
  *
@@ -127,13 +147,17 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_length(kMagicNumberForInfinity);
   int seed(kDefaultSeed);
   double mean(kDefaultMean);
   double standard_deviation(kDefaultStandardDeviation);
+  RandomGenerationMethods random_generation_method(
+      kDefaultRandomGenerationMethod);
 
   for (;;) {
-    const int option_char(getopt_long(argc, argv, "l:m:s:u:v:d:h", NULL, NULL));
+    const int option_char(getopt_long(argc, argv, "l:m:s:u:v:d:g:h", NULL, NULL));
     if (-1 == option_char) break;
 
     switch (option_char) {
@@ -201,6 +225,21 @@ int main(int argc, char* argv[]) {
         }
         break;
       }
+      case 'g': {
+        const int min(0);
+        const int max(static_cast<int>(kNumRandomGenerationMethods) - 1);
+        int tmp;
+        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
+            !sptk::IsInRange(tmp, min, max)) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -g option must be an integer "
+                        << "in the range of " << min << " to " << max;
+          sptk::PrintErrorMessage("nrand", error_message);
+          return 1;
+        }
+        random_generation_method = static_cast<RandomGenerationMethods>(tmp);
+        break;
+      }
       case 'h': {
         PrintUsage(&std::cout);
         return 0;
@@ -219,19 +258,34 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  sptk::NormalDistributedRandomValueGeneration generator(seed);
+  sptk::NormalDistributedRandomValueGeneration
+      linear_congruential_generator(seed);
+  sptk::NormalDistributedRandomValueGenerationByZiggurat
+      counter_based_generator(seed);
+  sptk::RandomGenerationInterface* generator(
+      kCounterBasedAndZiggurat == random_generation_method
+          ? static_cast<sptk::RandomGenerationInterface*>(
+                &counter_based_generator)
+          : static_cast<sptk::RandomGenerationInterface*>(
+                &linear_congruential_generator));
 
-  for (int i(0); kMagicNumberForInfinity == output_length || i < output_length;
-       ++i) {
-    double random;
-    if (!generator.Get(&random)) {
+  // Generate and write random values block by block.
+  std::vector<double> outputs(kBufferSize);
+  const bool is_infinite(kMagicNumberForInfinity == output_length);
+  for (int i(0); is_infinite || i < output_length;) {
+    const int block_size(is_infinite ? kBufferSize
+                                     : std::min(kBufferSize, output_length - i));
+    if (!is_infinite) i += block_size;
+    if (!generator->Generate(block_size, &(outputs[0]))) {
       std::ostringstream error_message;
       error_message << "Failed to generate random values";
       sptk::PrintErrorMessage("nrand", error_message);
       return 1;
     }
-    const double output(mean + random * standard_deviation);
-    if (!sptk::WriteStream(output, &std::cout)) {
+    for (int j(0); j < block_size; ++j) {
+      outputs[j] = mean + outputs[j] * standard_deviation;
+    }
+    if (!sptk::WriteStream(0, block_size, outputs, &std::cout, NULL)) {
       std::ostringstream error_message;
       error_message << "Failed to write random values";
       sptk::PrintErrorMessage("nrand", error_message);
@@ -126,6 +126,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int vector_length(kDefaultVectorLength);
   int num_principal_component(kDefaultNumPrincipalComponent);
   int num_iteration(kDefaultNumIteration);
@@ -170,6 +170,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   sptk::PitchExtraction::Algorithms algorithm(kDefaultAlgorithm);
   int frame_shift(kDefaultFrameShift);
   double sampling_rate(kDefaultSamplingRate);
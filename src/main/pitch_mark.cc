@@ -138,6 +138,8 @@ void PrintUsage(std::ostream* stream) {
  * @sa sptk::PitchExtraction
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   double sampling_rate(kDefaultSamplingRate);
   double lower_f0(kDefaultLowerF0);
   double upper_f0(kDefaultUpperF0);
@@ -132,6 +132,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_length(kMagicNumberForInfinity);
   double start_value(kDefaultStartValue);
   double end_value(static_cast<double>(kMagicNumberForInfinity));
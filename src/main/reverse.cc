@@ -44,7 +44,7 @@
 
 #include <getopt.h>  // getopt_long
 
-#include <algorithm>  // std::reverse
+#include <algorithm>  // std::min, std::reverse
 #include <fstream>    // std::ifstream
 #include <iomanip>    // std::setw
 #include <iostream>   // std::cerr, std::cin, std::cout, std::endl, etc.
@@ -55,6 +55,8 @@
 
 namespace {
 
+const int kBufferSize(4096);
+
 void PrintUsage(std::ostream* stream) {
   // clang-format off
   *stream << std::endl;
@@ -124,6 +126,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int block_length(0);
 
   for (;;) {
@@ -184,7 +188,36 @@ int main(int argc, char* argv[]) {
   }
   std::istream& input_stream(ifs.fail() ? std::cin : ifs);
 
-  if (0 == block_length) {
+  std::streamoff remaining_size;
+  if (0 == block_length &&
+      sptk::GetRemainingStreamSize(&input_stream, &remaining_size)) {
+    // Reverse whole sequence by walking the file backwards chunk by chunk.
+    const std::streamoff type_byte(sizeof(double));
+    const std::streamoff start_position(input_stream.tellg());
+    std::streamoff num_remaining_data(remaining_size / type_byte);
+    std::vector<double> data(kBufferSize);
+    while (0 < num_remaining_data) {
+      const int chunk_size(static_cast<int>(
+          std::min(static_cast<std::streamoff>(kBufferSize),
+                   num_remaining_data)));
+      num_remaining_data -= chunk_size;
+      input_stream.seekg(start_position + num_remaining_data * type_byte);
+      if (!sptk::ReadStream(false, 0, 0, chunk_size, &data, &input_stream,
+                            NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to read data sequence";
+        sptk::PrintErrorMessage("reverse", error_message);
+        return 1;
+      }
+      std::reverse(data.begin(), data.begin() + chunk_size);
+      if (!sptk::WriteStream(0, chunk_size, data, &std::cout, NULL)) {
+        std::ostringstream error_message;
+        error_message << "Failed to write reversed data sequence";
+        sptk::PrintErrorMessage("reverse", error_message);
+        return 1;
+      }
+    }
+  } else if (0 == block_length) {
     // Reverse whole sequence.
     std::vector<double> data;
     double tmp;
@@ -149,6 +149,8 @@ void PrintUsage(std::ostream* stream) {
  * @endcode
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int vector_length(kMagicNumberForEndOfFile);
   double magic_number(0.0);
   bool use_magic_number(kDefaultUseMagicNumber);
@@ -115,6 +115,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_length(kMagicNumberForInfinity);
   double period(kDefaultPeriod);
   double amplitude(kDefaultAmplitude);
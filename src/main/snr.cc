@@ -145,6 +145,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int frame_length(kDefaultFrameLength);
   OutputType output_type(kDefaultOutputType);
 
@@ -249,6 +249,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   sptk::ScalarOperation scalar_operation;
 
   const struct option long_options[] = {
@@ -0,0 +1,249 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include <fcntl.h>     // fcntl, open
+#include <getopt.h>    // getopt_long
+#include <sys/mman.h>  // memfd_create
+#include <unistd.h>    // dup2, execl, lseek, read, write
+
+#include <cerrno>    // errno
+#include <iostream>  // std::cerr, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+
+#include "SPTK/utils/pipeline_daemon.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+const bool kDefaultSharedMemoryFlag(false);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " sptkc - client of SPTK daemon" << std::endl;
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       sptkc [ options ] pipeline [ infile ] > stdout" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -s s  : socket path            (string)[" << sptk::PipelineDaemon::GetDefaultSocketPath() << "]" << std::endl;  // NOLINT
+  *stream << "       -m    : pass input through     (  bool)[" << sptk::ConvertBooleanToString(kDefaultSharedMemoryFlag) << "]" << std::endl;  // NOLINT
+  *stream << "               shared memory" << std::endl;
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  pipeline:" << std::endl;
+  *stream << "       pipeline of SPTK commands      (string)" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       input of pipeline                      [stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       output of pipeline" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+// Create an anonymous file in memory which can be sealed. Return -1 if it is
+// not available.
+int CreateSealableMemoryFile() {
+#if defined(MFD_ALLOW_SEALING) && defined(F_SEAL_SHRINK)
+  return memfd_create("sptkc", MFD_ALLOW_SEALING);
+#else
+  return -1;
+#endif
+}
+
+// Copy the input to the memory file and seal it so that the daemon can map it
+// safely.
+bool CopyInput(int fd, int memory_fd, off_t* input_size) {
+  *input_size = 0;
+  char buffer[65536];
+  for (;;) {
+    const ssize_t read_size(read(fd, buffer, sizeof(buffer)));
+    if (read_size < 0 && EINTR == errno) continue;
+    if (read_size < 0) return false;
+    if (0 == read_size) break;
+    for (ssize_t written(0); written < read_size;) {
+      const ssize_t size(write(memory_fd, buffer + written,
+                               read_size - written));
+      if (size < 0 && EINTR == errno) continue;
+      if (size <= 0) return false;
+      written += size;
+    }
+    *input_size += read_size;
+  }
+#if defined(F_SEAL_SHRINK)
+  if (fcntl(memory_fd, F_ADD_SEALS, F_SEAL_SHRINK) < 0) return false;
+#endif
+  return 0 == lseek(memory_fd, 0, SEEK_SET);
+}
+
+}  // namespace
+
+/**
+ * @a sptkc [ @e option ] @e pipeline [ @e infile ]
+ *
+ * - @b -s @e str
+ *   - socket path
+ * - @b -m @e bool
+ *   - pass input through shared memory
+ * - @b pipeline @e str
+ *   - pipeline of SPTK commands
+ * - @b infile @e str
+ *   - input of pipeline
+ * - @b stdout
+ *   - output of pipeline
+ *
+ * The pipeline is run by the daemon @a sptkd. If no daemon is running or the
+ * daemon does not support the pipeline, it is run by the shell as usual. See
+ * sptk::Pipeline for the supported commands.
+ *
+ * @code{.sh}
+ *   sptkc 'x2x +sd | frame -l 400 -p 80 | window -l 400 -L 512 | mgcep -l 512 -q 4' \
+ *     < data.short > data.mcep
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  std::string socket_path(sptk::PipelineDaemon::GetDefaultSocketPath());
+  bool is_shared_memory_used(kDefaultSharedMemoryFlag);
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "s:mh", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 's': {
+        socket_path = optarg;
+        break;
+      }
+      case 'm': {
+        is_shared_memory_used = true;
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  const int num_rest_args(argc - optind);
+  if (num_rest_args < 1) {
+    std::ostringstream error_message;
+    error_message << "Pipeline is not given";
+    sptk::PrintErrorMessage("sptkc", error_message);
+    return 1;
+  } else if (2 < num_rest_args) {
+    std::ostringstream error_message;
+    error_message << "Too many input files";
+    sptk::PrintErrorMessage("sptkc", error_message);
+    return 1;
+  }
+  const std::string command_line(argv[optind]);
+  const char* input_file(1 == num_rest_args ? NULL : argv[optind + 1]);
+
+  int fd(0);
+  if (NULL != input_file) {
+    fd = open(input_file, O_RDONLY);
+    if (fd < 0) {
+      std::ostringstream error_message;
+      error_message << "Cannot open file " << input_file;
+      sptk::PrintErrorMessage("sptkc", error_message);
+      return 1;
+    }
+  }
+
+  // Without shared memory, the input is streamed to the daemon.
+  int input_fd(fd);
+  off_t input_size(0);
+  if (is_shared_memory_used) {
+    input_fd = CreateSealableMemoryFile();
+    if (input_fd < 0) {
+      input_fd = fd;
+      is_shared_memory_used = false;
+    } else if (!CopyInput(fd, input_fd, &input_size)) {
+      std::ostringstream error_message;
+      error_message << "Failed to read input";
+      sptk::PrintErrorMessage("sptkc", error_message);
+      return 1;
+    }
+  }
+
+  std::string message;
+  const sptk::PipelineDaemon::Status status(sptk::PipelineDaemon::Request(
+      socket_path, command_line, input_fd, input_size, is_shared_memory_used,
+      1, &message));
+  if (sptk::PipelineDaemon::kSuccess == status) {
+    return 0;
+  } else if (sptk::PipelineDaemon::kFailure == status) {
+    std::ostringstream error_message;
+    error_message << message;
+    sptk::PrintErrorMessage("sptkc", error_message);
+    return 1;
+  }
+
+  // Run the pipeline by the shell instead. The input has not been read yet
+  // unless it has been copied to shared memory.
+  if ((is_shared_memory_used && 0 != lseek(input_fd, 0, SEEK_SET)) ||
+      (0 != input_fd && dup2(input_fd, 0) < 0)) {
+    std::ostringstream error_message;
+    error_message << "Failed to prepare input";
+    sptk::PrintErrorMessage("sptkc", error_message);
+    return 1;
+  }
+  execl("/bin/sh", "sh", "-c", command_line.c_str(), static_cast<char*>(NULL));
+
+  std::ostringstream error_message;
+  error_message << "Failed to run pipeline";
+  sptk::PrintErrorMessage("sptkc", error_message);
+  return 1;
+}
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include <getopt.h>  // getopt_long
+
+#include <iostream>  // std::cerr, std::cout, std::endl, etc.
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+
+#include "SPTK/utils/pipeline_daemon.h"
+#include "SPTK/utils/profiler.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " sptkd - daemon serving pipelines of SPTK commands" << std::endl;
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       sptkd [ options ]" << std::endl;
+  *stream << "  options:" << std::endl;
+  *stream << "       -s s  : socket path            (string)[" << sptk::PipelineDaemon::GetDefaultSocketPath() << "]" << std::endl;  // NOLINT
+  *stream << "       -T T  : number of workers      (   int)[" << sptk::PipelineDaemon::GetDefaultNumWorker() << "][ 1 <= T <=   ]" << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+}  // namespace
+
+/**
+ * @a sptkd [ @e option ]
+ *
+ * - @b -s @e str
+ *   - socket path
+ * - @b -T @e int
+ *   - number of worker threads, each of which serves one request at a time
+ *
+ * The daemon serves requests sent by @a sptkc until it receives SIGINT or
+ * SIGTERM. The default socket path is given by the environment variable
+ * @c SPTK_DAEMON_SOCKET.
+ *
+ * @code{.sh}
+ *   sptkd -T 4 &
+ *   sptkc 'x2x +sd | frame -l 400 -p 80 | window -l 400 -L 512 | mgcep -l 512 -q 4' \
+ *     < data.short > data.mcep
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char* argv[]) {
+  sptk::Profiler::ParseCommandLine(&argc, argv);
+
+  std::string socket_path(sptk::PipelineDaemon::GetDefaultSocketPath());
+  int num_worker(sptk::PipelineDaemon::GetDefaultNumWorker());
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "s:T:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 's': {
+        socket_path = optarg;
+        break;
+      }
+      case 'T': {
+        if (!sptk::ConvertStringToInteger(optarg, &num_worker) ||
+            num_worker <= 0) {
+          std::ostringstream error_message;
+          error_message << "The argument for the -T option must be a "
+                        << "positive integer";
+          sptk::PrintErrorMessage("sptkd", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  if (optind != argc) {
+    std::ostringstream error_message;
+    error_message << "Too many arguments";
+    sptk::PrintErrorMessage("sptkd", error_message);
+    return 1;
+  }
+
+  sptk::PipelineDaemon daemon(socket_path, num_worker);
+  std::string message;
+  if (!daemon.Run(&message)) {
+    std::ostringstream error_message;
+    error_message << message;
+    sptk::PrintErrorMessage("sptkd", error_message);
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,361 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include <fcntl.h>     // O_CLOEXEC, open
+#include <getopt.h>    // getopt_long
+#include <sys/wait.h>  // waitpid, WEXITSTATUS, WIFEXITED, etc.
+#include <unistd.h>    // access, close, dup2, execv, fork, readlink, etc.
+
+#include <cctype>    // std::isspace
+#include <climits>   // PATH_MAX
+#include <cstdlib>   // setenv, unsetenv
+#include <iomanip>   // std::setw
+#include <iostream>  // std::cerr, std::cout, std::endl, etc.
+#include <memory>    // std::unique_ptr
+#include <sstream>   // std::ostringstream
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include "SPTK/utils/shared_memory_ring_buffer.h"
+#include "SPTK/utils/sptk_utils.h"
+
+namespace {
+
+const int kDefaultBufferSize(1024);
+
+void PrintUsage(std::ostream* stream) {
+  // clang-format off
+  *stream << std::endl;
+  *stream << " sptkpipe - run pipeline of SPTK commands through shared memory" << std::endl;  // NOLINT
+  *stream << std::endl;
+  *stream << "  usage:" << std::endl;
+  *stream << "       sptkpipe [ options ] pipeline [ infile ] > stdout" << std::endl;  // NOLINT
+  *stream << "  options:" << std::endl;
+  *stream << "       -b b  : buffer size in KiB     (   int)[" << std::setw(5) << std::right << kDefaultBufferSize << "][ 1 <= b <=   ]" << std::endl;  // NOLINT
+  *stream << "       -h    : print this message" << std::endl;
+  *stream << "  pipeline:" << std::endl;
+  *stream << "       pipeline of commands           (string)" << std::endl;
+  *stream << "  infile:" << std::endl;
+  *stream << "       input of pipeline                      [stdin]" << std::endl;  // NOLINT
+  *stream << "  stdout:" << std::endl;
+  *stream << "       output of pipeline" << std::endl;
+  *stream << std::endl;
+  *stream << " SPTK: version " << sptk::kVersion << std::endl;
+  *stream << std::endl;
+  // clang-format on
+}
+
+struct Stage {
+  std::vector<std::string> arguments;
+  std::string path;
+  pid_t pid;
+};
+
+// Split a pipeline into commands and their arguments. Quotes are removed as
+// the shell does.
+bool ParsePipeline(const std::string& command_line,
+                   std::vector<Stage>* stages) {
+  stages->assign(1, Stage());
+  std::string word;
+  bool is_word_started(false);
+  char quote('\0');
+  for (std::string::const_iterator itr(command_line.begin());
+       itr != command_line.end(); ++itr) {
+    const char c(*itr);
+    if ('\0' != quote) {
+      if (quote == c) {
+        quote = '\0';
+      } else {
+        word += c;
+      }
+    } else if ('\'' == c || '"' == c) {
+      quote = c;
+      is_word_started = true;
+    } else if (std::isspace(static_cast<unsigned char>(c)) || '|' == c) {
+      if (is_word_started) {
+        stages->back().arguments.push_back(word);
+        word.clear();
+        is_word_started = false;
+      }
+      if ('|' == c) {
+        if (stages->back().arguments.empty()) return false;
+        stages->push_back(Stage());
+      }
+    } else {
+      word += c;
+      is_word_started = true;
+    }
+  }
+  if ('\0' != quote) return false;
+  if (is_word_started) {
+    stages->back().arguments.push_back(word);
+  }
+  return !stages->back().arguments.empty();
+}
+
+// Find the directory containing SPTK commands, i.e., that of this command.
+std::string GetCommandDirectory(const char* argv0) {
+  char path[PATH_MAX];
+  const ssize_t length(readlink("/proc/self/exe", path, sizeof(path) - 1));
+  std::string command_path(0 < length ? std::string(path, length) : argv0);
+  const std::string::size_type position(command_path.rfind('/'));
+  return std::string::npos == position ? "" : command_path.substr(0, position);
+}
+
+void RunStage(const Stage& stage, int input_fd, int output_fd,
+              const std::string& shared_memory_streams) {
+  if ((0 != input_fd && dup2(input_fd, 0) < 0) ||
+      (1 != output_fd && dup2(output_fd, 1) < 0)) {
+    _exit(127);
+  }
+  if (shared_memory_streams.empty()) {
+    unsetenv("SPTK_SHARED_MEMORY_STREAM");
+  } else {
+    setenv("SPTK_SHARED_MEMORY_STREAM", shared_memory_streams.c_str(), 1);
+  }
+
+  std::vector<char*> arguments;
+  for (std::vector<std::string>::const_iterator itr(stage.arguments.begin());
+       itr != stage.arguments.end(); ++itr) {
+    arguments.push_back(const_cast<char*>(itr->c_str()));
+  }
+  arguments.push_back(NULL);
+  if (stage.path.empty()) {
+    execvp(arguments[0], &(arguments[0]));
+  } else {
+    execv(stage.path.c_str(), &(arguments[0]));
+  }
+
+  std::ostringstream error_message;
+  error_message << "Cannot run " << stage.arguments[0];
+  sptk::PrintErrorMessage("sptkpipe", error_message);
+  _exit(127);
+}
+
+}  // namespace
+
+/**
+ * @a sptkpipe [ @e option ] @e pipeline [ @e infile ]
+ *
+ * - @b -b @e int
+ *   - buffer size in KiB
+ * - @b pipeline @e str
+ *   - pipeline of commands
+ * - @b infile @e str
+ *   - input of pipeline
+ * - @b stdout
+ *   - output of pipeline
+ *
+ * The commands of the pipeline are run as separate processes. Two adjacent
+ * SPTK commands are connected by a ring buffer in shared memory instead of a
+ * pipe, so that data are passed without system calls. The other commands are
+ * connected by pipes as usual. The exit status is that of the last command.
+ * The pipeline is split at @c | and white spaces; quotes are removed, but the
+ * other shell syntax is not supported.
+ *
+ * @code{.sh}
+ *   sptkpipe 'x2x +sd | frame -l 400 -p 80 | window -l 400 -L 512 | mgcep -l 512 -q 4' \
+ *     < data.short > data.mcep
+ * @endcode
+ *
+ * @param[in] argc Number of arguments.
+ * @param[in] argv Argument vector.
+ * @return Exit status of the last command.
+ */
+int main(int argc, char* argv[]) {
+  int buffer_size(kDefaultBufferSize);
+
+  for (;;) {
+    const int option_char(getopt_long(argc, argv, "b:h", NULL, NULL));
+    if (-1 == option_char) break;
+
+    switch (option_char) {
+      case 'b': {
+        if (!sptk::ConvertStringToInteger(optarg, &buffer_size) ||
+            buffer_size <= 0) {
+          std::ostringstream error_message;
+          error_message
+              << "The argument for the -b option must be a positive integer";
+          sptk::PrintErrorMessage("sptkpipe", error_message);
+          return 1;
+        }
+        break;
+      }
+      case 'h': {
+        PrintUsage(&std::cout);
+        return 0;
+      }
+      default: {
+        PrintUsage(&std::cerr);
+        return 1;
+      }
+    }
+  }
+
+  const int num_rest_args(argc - optind);
+  if (num_rest_args < 1) {
+    std::ostringstream error_message;
+    error_message << "Pipeline is not given";
+    sptk::PrintErrorMessage("sptkpipe", error_message);
+    return 1;
+  } else if (2 < num_rest_args) {
+    std::ostringstream error_message;
+    error_message << "Too many input files";
+    sptk::PrintErrorMessage("sptkpipe", error_message);
+    return 1;
+  }
+  const std::string command_line(argv[optind]);
+  const char* input_file(1 == num_rest_args ? NULL : argv[optind + 1]);
+
+  std::vector<Stage> stages;
+  if (!ParsePipeline(command_line, &stages)) {
+    std::ostringstream error_message;
+    error_message << "Failed to parse pipeline";
+    sptk::PrintErrorMessage("sptkpipe", error_message);
+    return 1;
+  }
+  const int num_stage(static_cast<int>(stages.size()));
+
+  // Commands found next to this command are regarded as SPTK commands.
+  const std::string command_directory(GetCommandDirectory(argv[0]));
+  for (int i(0); i < num_stage; ++i) {
+    const std::string& name(stages[i].arguments[0]);
+    if (std::string::npos == name.find('/') && !command_directory.empty()) {
+      const std::string path(command_directory + "/" + name);
+      if (0 == access(path.c_str(), X_OK)) {
+        stages[i].path = path;
+      }
+    }
+  }
+
+  int input_fd(0);
+  if (NULL != input_file) {
+    input_fd = open(input_file, O_RDONLY | O_CLOEXEC);
+    if (input_fd < 0) {
+      std::ostringstream error_message;
+      error_message << "Cannot open file " << input_file;
+      sptk::PrintErrorMessage("sptkpipe", error_message);
+      return 1;
+    }
+  }
+
+  // Connect the commands. The i-th link is between the i-th and (i+1)-th
+  // commands. Ring buffers are kept mapped so that they can be closed when a
+  // command exits without closing them.
+  const std::size_t capacity(static_cast<std::size_t>(buffer_size) * 1024);
+  std::vector<int> reader_fds(num_stage - 1), writer_fds(num_stage - 1);
+  std::vector<std::unique_ptr<sptk::SharedMemoryRingBuffer> > ring_buffers(
+      num_stage - 1);
+  for (int i(0); i + 1 < num_stage; ++i) {
+    int fd;
+    if (!stages[i].path.empty() && !stages[i + 1].path.empty() &&
+        sptk::SharedMemoryRingBuffer::Create(capacity, &fd)) {
+      ring_buffers[i].reset(new sptk::SharedMemoryRingBuffer(fd));
+      if (ring_buffers[i]->IsValid()) {
+        reader_fds[i] = fd;
+        writer_fds[i] = fd;
+        continue;
+      }
+      ring_buffers[i].reset();
+      close(fd);
+    }
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) < 0) {
+      std::ostringstream error_message;
+      error_message << "Failed to create pipe";
+      sptk::PrintErrorMessage("sptkpipe", error_message);
+      return 1;
+    }
+    reader_fds[i] = fds[0];
+    writer_fds[i] = fds[1];
+  }
+
+  for (int i(0); i < num_stage; ++i) {
+    const bool is_input_shared(0 < i && ring_buffers[i - 1]);
+    const bool is_output_shared(i + 1 < num_stage && ring_buffers[i]);
+    const std::string shared_memory_streams(
+        is_input_shared && is_output_shared
+            ? "stdin,stdout"
+            : is_input_shared ? "stdin" : is_output_shared ? "stdout" : "");
+    stages[i].pid = fork();
+    if (stages[i].pid < 0) {
+      std::ostringstream error_message;
+      error_message << "Failed to run " << stages[i].arguments[0];
+      sptk::PrintErrorMessage("sptkpipe", error_message);
+      return 1;
+    }
+    if (0 == stages[i].pid) {
+      RunStage(stages[i], 0 == i ? input_fd : reader_fds[i - 1],
+               i + 1 == num_stage ? 1 : writer_fds[i], shared_memory_streams);
+    }
+  }
+
+  if (0 != input_fd) close(input_fd);
+  for (int i(0); i + 1 < num_stage; ++i) {
+    close(reader_fds[i]);
+    if (writer_fds[i] != reader_fds[i]) close(writer_fds[i]);
+  }
+
+  int exit_status(0);
+  for (int num_running_stage(num_stage); 0 < num_running_stage;) {
+    int status;
+    const pid_t pid(waitpid(-1, &status, 0));
+    if (pid < 0) break;
+    for (int i(0); i < num_stage; ++i) {
+      if (pid != stages[i].pid) continue;
+      // Behave as if the pipes of the command were closed.
+      if (0 < i && ring_buffers[i - 1]) ring_buffers[i - 1]->CloseReader();
+      if (i + 1 < num_stage && ring_buffers[i]) ring_buffers[i]->CloseWriter();
+      if (i + 1 == num_stage) {
+        exit_status = WIFEXITED(status) ? WEXITSTATUS(status)
+                                        : 128 + WTERMSIG(status);
+      }
+      --num_running_stage;
+      break;
+    }
+  }
+
+  return exit_status;
+}
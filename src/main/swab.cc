@@ -276,6 +276,8 @@ class ByteSwapWrapper {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int start_address(kDefaultStartAddress);
   int start_offset(kDefaultStartOffset);
   int end_address(kDefaultEndAddress);
@@ -125,6 +125,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int fft_length(kDefaultFftLength);
   sptk::DataSymmetrizing::InputOutputFormats input_format(kDefaultInputFormat);
   sptk::DataSymmetrizing::InputOutputFormats output_format(
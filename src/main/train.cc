@@ -129,6 +129,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int output_length(kMagicNumberForInfinity);
   double period(kDefaultPeriod);
   NormalizationType normalization_type(kDefaultNormalizationType);
@@ -127,6 +127,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_row(kDefaultNumRow);
   int num_column(kDefaultNumColumn);
 
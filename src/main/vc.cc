@@ -142,6 +142,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int num_source_order(kDefaultNumOrder);
   int num_target_order(kDefaultNumOrder);
   bool is_num_target_order_specified(false);
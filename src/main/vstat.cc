@@ -48,9 +48,12 @@
 #include <fstream>   // std::ifstream
 #include <iomanip>   // std::setw
 #include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <memory>    // std::unique_ptr
 #include <sstream>   // std::ostringstream
 #include <vector>    // std::vector
 
+#include "SPTK/input/input_source_from_stream.h"
+#include "SPTK/input/input_source_from_stream_with_prefetch.h"
 #include "SPTK/math/statistics_accumulation.h"
 #include "SPTK/math/symmetric_matrix.h"
 #include "SPTK/utils/misc_utils.h"
@@ -374,6 +377,8 @@ bool OutputStatistics(const sptk::StatisticsAccumulation& accumulation,
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
+  sptk::InitializeCommand(&argc, argv);
+
   int vector_length(kDefaultVectorLength);
   int output_interval(kMagicNumberForEndOfFile);
   double confidence_level(kDefaultConfidenceLevel);
@@ -490,9 +495,16 @@ int main(int argc, char* argv[]) {
   }
 
   std::vector<double> data(vector_length);
-  for (int vector_index(1);
-       sptk::ReadStream(false, 0, 0, vector_length, &data, &input_stream, NULL);
-       ++vector_index) {
+  // Read ahead only if nothing is written until the end of input.
+  std::unique_ptr<sptk::InputSourceInterface> input_source;
+  if (kMagicNumberForEndOfFile == output_interval) {
+    input_source.reset(new sptk::InputSourceFromStreamWithPrefetch(
+        false, vector_length, &input_stream));
+  } else {
+    input_source.reset(
+        new sptk::InputSourceFromStream(false, vector_length, &input_stream));
+  }
+  for (int vector_index(1); input_source->Get(&data); ++vector_index) {
     if (!accumulation.Run(data, &buffer)) {
       std::ostringstream error_message;
       error_message << "Failed to accumulate statistics";
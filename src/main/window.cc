@@ -42,25 +42,20 @@
 // POSSIBILITY OF SUCH DAMAGE.                                       //
 // ----------------------------------------------------------------- //
 
-#include <getopt.h>  // getopt_long
-
-#include <fstream>   // std::ifstream
 #include <iomanip>   // std::setw
-#include <iostream>  // std::cerr, std::cin, std::cout, std::endl, etc.
+#include <iostream>  // std::cerr, std::cout, std::endl, etc.
 #include <sstream>   // std::ostringstream
-#include <vector>    // std::vector
 
+#include "SPTK/command/window_command.h"
 #include "SPTK/utils/sptk_utils.h"
-#include "SPTK/window/data_windowing.h"
-#include "SPTK/window/standard_window.h"
 
 namespace {
 
-const int kDefaultFrameLength(256);
+const int kDefaultFrameLength(sptk::WindowCommand::kDefaultFrameLength);
 const sptk::DataWindowing::NormalizationType kDefaultNormalizationType(
-    sptk::DataWindowing::NormalizationType::kPower);
+    sptk::WindowCommand::kDefaultNormalizationType);
 const sptk::StandardWindow::WindowType kDefaultWindowType(
-    sptk::StandardWindow::WindowType::kBlackman);
+    sptk::WindowCommand::kDefaultWindowType);
 
 void PrintUsage(std::ostream* stream) {
   // clang-format off
@@ -132,157 +127,8 @@ void PrintUsage(std::ostream* stream) {
  * @return 0 on success, 1 on failure.
  */
 int main(int argc, char* argv[]) {
-  int input_length(kDefaultFrameLength);
-  int output_length(kDefaultFrameLength);
-  bool is_output_length_specified(false);
-  sptk::DataWindowing::NormalizationType normalization_type(
-      kDefaultNormalizationType);
-  sptk::StandardWindow::WindowType window_type(kDefaultWindowType);
-
-  for (;;) {
-    const int option_char(getopt_long(argc, argv, "l:L:n:w:h", NULL, NULL));
-    if (-1 == option_char) break;
-
-    switch (option_char) {
-      case 'l': {
-        if (!sptk::ConvertStringToInteger(optarg, &input_length) ||
-            input_length <= 0) {
-          std::ostringstream error_message;
-          error_message
-              << "The argument for the -l option must be a positive integer";
-          sptk::PrintErrorMessage("window", error_message);
-          return 1;
-        }
-        break;
-      }
-      case 'L': {
-        if (!sptk::ConvertStringToInteger(optarg, &output_length) ||
-            output_length <= 0) {
-          std::ostringstream error_message;
-          error_message
-              << "The argument for the -L option must be a positive integer";
-          sptk::PrintErrorMessage("window", error_message);
-          return 1;
-        }
-        is_output_length_specified = true;
-        break;
-      }
-      case 'n': {
-        const int min(0);
-        const int max(static_cast<int>(sptk::DataWindowing::NormalizationType::
-                                           kNumNormalizationTypes) -
-                      1);
-        int tmp;
-        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
-            !sptk::IsInRange(tmp, min, max)) {
-          std::ostringstream error_message;
-          error_message << "The argument for the -n option must be an integer "
-                        << "in the range of " << min << " to " << max;
-          sptk::PrintErrorMessage("window", error_message);
-          return 1;
-        }
-        normalization_type =
-            static_cast<sptk::DataWindowing::NormalizationType>(tmp);
-        break;
-      }
-      case 'w': {
-        const int min(0);
-        const int max(5);
-        int tmp;
-        if (!sptk::ConvertStringToInteger(optarg, &tmp) ||
-            !sptk::IsInRange(tmp, min, max)) {
-          std::ostringstream error_message;
-          error_message << "The argument for the -w option must be an integer "
-                        << "in the range of " << min << " to " << max;
-          sptk::PrintErrorMessage("window", error_message);
-          return 1;
-        }
-        if (0 == tmp) {
-          window_type = sptk::StandardWindow::kBlackman;
-        } else if (1 == tmp) {
-          window_type = sptk::StandardWindow::kHamming;
-        } else if (2 == tmp) {
-          window_type = sptk::StandardWindow::kHanning;
-        } else if (3 == tmp) {
-          window_type = sptk::StandardWindow::kBartlett;
-        } else if (4 == tmp) {
-          window_type = sptk::StandardWindow::kTrapezoidal;
-        } else if (5 == tmp) {
-          window_type = sptk::StandardWindow::kRectangular;
-        }
-        break;
-      }
-      case 'h': {
-        PrintUsage(&std::cout);
-        return 0;
-      }
-      default: {
-        PrintUsage(&std::cerr);
-        return 1;
-      }
-    }
-  }
-
-  if (!is_output_length_specified) {
-    output_length = input_length;
-  } else if (output_length < input_length) {
-    std::ostringstream error_message;
-    error_message << "The length of data sequence " << input_length
-                  << " must be equal to or less than that of windowed one "
-                  << output_length;
-    sptk::PrintErrorMessage("window", error_message);
-    return 1;
-  }
-
-  const int num_input_files(argc - optind);
-  if (1 < num_input_files) {
-    std::ostringstream error_message;
-    error_message << "Too many input files";
-    sptk::PrintErrorMessage("window", error_message);
-    return 1;
-  }
-  const char* input_file(0 == num_input_files ? NULL : argv[optind]);
-
-  std::ifstream ifs;
-  ifs.open(input_file, std::ios::in | std::ios::binary);
-  if (ifs.fail() && NULL != input_file) {
-    std::ostringstream error_message;
-    error_message << "Cannot open file " << input_file;
-    sptk::PrintErrorMessage("window", error_message);
-    return 1;
-  }
-  std::istream& input_stream(ifs.fail() ? std::cin : ifs);
-
-  sptk::StandardWindow standard_window(input_length, window_type, false);
-  sptk::DataWindowing data_windowing(&standard_window, output_length,
-                                     normalization_type);
-  if (!data_windowing.IsValid()) {
-    std::ostringstream error_message;
-    error_message << "Failed to initialize DataWindowing";
-    sptk::PrintErrorMessage("window", error_message);
-    return 1;
-  }
-
-  std::vector<double> data_sequence(input_length);
-  std::vector<double> windowed_data_sequence(output_length);
-
-  while (sptk::ReadStream(false, 0, 0, input_length, &data_sequence,
-                          &input_stream, NULL)) {
-    if (!data_windowing.Run(data_sequence, &windowed_data_sequence)) {
-      std::ostringstream error_message;
-      error_message << "Failed to apply a window function";
-      sptk::PrintErrorMessage("window", error_message);
-      return 1;
-    }
-
-    if (!sptk::WriteStream(0, output_length, windowed_data_sequence, &std::cout,
-                           NULL)) {
-      std::ostringstream error_message;
-      error_message << "Failed to write windowed data sequence";
-      sptk::PrintErrorMessage("window", error_message);
-      return 1;
-    }
-  }
+  sptk::InitializeCommand(&argc, argv);
 
-  return 0;
+  sptk::WindowCommand command;
+  return sptk::RunCommand("window", argc, argv, PrintUsage, &command);
 }
@@ -48,6 +48,8 @@
 #include <cmath>      // std::cos, std::sin, std::sqrt
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/shared_table_cache.h"
+
 namespace sptk {
 
 DiscreteCosineTransform::DiscreteCosineTransform(int dct_length)
@@ -56,17 +58,23 @@ DiscreteCosineTransform::DiscreteCosineTransform(int dct_length)
     return;
   }
 
+  // The cosines are followed by the sines.
   const int dft_length(fourier_transform_.GetLength());
-  const double argument(sptk::kPi / dft_length);
-  const double c(1.0 / std::sqrt(dft_length));
-  cosine_table_.resize(dct_length_);
-  sine_table_.resize(dct_length_);
-  cosine_table_[0] = c / std::sqrt(2.0);
-  sine_table_[0] = 0.0;
-  for (int i(1); i < dct_length_; ++i) {
-    cosine_table_[i] = std::cos(argument * i) * c;
-    sine_table_[i] = -std::sin(argument * i) * c;
-  }
+  table_ = SharedTableCache::Get<std::vector<double> >(
+      SharedTableCache::MakeKey("DiscreteCosineTransform", dct_length_),
+      [dct_length, dft_length](std::vector<double>* table) {
+        const double argument(sptk::kPi / dft_length);
+        const double c(1.0 / std::sqrt(dft_length));
+        table->resize(2 * dct_length);
+        double* cosine_table(&((*table)[0]));
+        double* sine_table(&((*table)[dct_length]));
+        cosine_table[0] = c / std::sqrt(2.0);
+        sine_table[0] = 0.0;
+        for (int i(1); i < dct_length; ++i) {
+          cosine_table[i] = std::cos(argument * i) * c;
+          sine_table[i] = -std::sin(argument * i) * c;
+        }
+      });
 }
 
 bool DiscreteCosineTransform::Run(
@@ -115,8 +123,8 @@ bool DiscreteCosineTransform::Run(
     return false;
   }
 
-  const double* cosine_table(&(cosine_table_[0]));
-  const double* sine_table(&(sine_table_[0]));
+  const double* cosine_table(&((*table_)[0]));
+  const double* sine_table(&((*table_)[dct_length_]));
   double* discrete_cosine_transform_real_part_output(&((*real_part_output)[0]));
   double* discrete_cosine_transform_imag_part_output(&((*imag_part_output)[0]));
   double* fourier_transform_real_part(&buffer->fourier_transform_real_part_[0]);
@@ -53,6 +53,7 @@ DistanceCalculation::DistanceCalculation(int num_order,
                                          DistanceMetrics distance_metric)
     : num_order_(num_order),
       distance_metric_(distance_metric),
+      simd_kernels_(SimdKernels::Get()),
       is_valid_(true) {
   if (num_order_ < 0 || kNumMetrics == distance_metric_) {
     is_valid_ = false;
@@ -71,32 +72,50 @@ bool DistanceCalculation::Run(const std::vector<double>& vector1,
     return false;
   }
 
+  return Calculate(&(vector1[0]), &(vector2[0]), distance);
+}
+
+bool DistanceCalculation::Run(
+    const std::vector<double>& vector1,
+    const std::vector<std::vector<double> >& vector_sequence2, int begin,
+    int end, double* distances) const {
+  // Check inputs.
+  if (!is_valid_ ||
+      vector1.size() != static_cast<std::size_t>(num_order_ + 1) ||
+      begin < 0 || end < begin ||
+      vector_sequence2.size() < static_cast<std::size_t>(end) ||
+      NULL == distances) {
+    return false;
+  }
+
   const double* x(&(vector1[0]));
-  const double* y(&(vector2[0]));
+  for (int i(begin); i < end; ++i) {
+    if (vector_sequence2[i].size() !=
+            static_cast<std::size_t>(num_order_ + 1) ||
+        !Calculate(x, &(vector_sequence2[i][0]), distances + (i - begin))) {
+      return false;
+    }
+  }
+
+  return true;
+}
 
+bool DistanceCalculation::Calculate(const double* x, const double* y,
+                                    double* distance) const {
   double sum(0.0);
 
   switch (distance_metric_) {
     case kManhattan: {
-      for (int m(0); m <= num_order_; ++m) {
-        const double diff(x[m] - y[m]);
-        sum += std::fabs(diff);
-      }
+      sum = simd_kernels_.manhattan_distance(x, y, num_order_ + 1);
       break;
     }
     case kEuclidean: {
-      for (int m(0); m <= num_order_; ++m) {
-        const double diff(x[m] - y[m]);
-        sum += diff * diff;
-      }
-      sum = std::sqrt(sum);
+      sum = std::sqrt(
+          simd_kernels_.squared_euclidean_distance(x, y, num_order_ + 1));
       break;
     }
     case kSquaredEuclidean: {
-      for (int m(0); m <= num_order_; ++m) {
-        const double diff(x[m] - y[m]);
-        sum += diff * diff;
-      }
+      sum = simd_kernels_.squared_euclidean_distance(x, y, num_order_ + 1);
       break;
     }
     case kSymmetricKullbackLeibler: {
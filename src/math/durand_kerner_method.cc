@@ -48,6 +48,8 @@
 #include <complex>  // std::abs, std::complex
 #include <cstddef>  // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
 namespace sptk {
 
 DurandKernerMethod::DurandKernerMethod(int num_order, int num_iteration,
@@ -75,6 +77,7 @@ DurandKernerMethod::DurandKernerMethod(int num_order, int num_iteration,
 bool DurandKernerMethod::Run(const std::vector<double>& coefficients,
                              std::vector<std::complex<double> >* roots,
                              bool* is_converged) const {
+  SPTK_PROFILE_SCOPE("DurandKernerMethod::Run");
   // Check inputs.
   if (!is_valid_ ||
       coefficients.size() != static_cast<std::size_t>(num_order_) ||
@@ -111,6 +114,7 @@ bool DurandKernerMethod::Run(const std::vector<double>& coefficients,
 
   // Find roots using the Durand-Kerner method.
   for (int n(0); n < num_iteration_; ++n) {
+    SPTK_PROFILE_ITERATION(1);
     bool halt(true);
 
     for (int m(0); m < num_order_; ++m) {
@@ -44,18 +44,79 @@
 
 #include "SPTK/math/dynamic_time_warping.h"
 
-#include <algorithm>  // std::reverse
+#include <algorithm>  // std::max, std::min, std::reverse
+#include <atomic>     // std::atomic
 #include <cfloat>     // DBL_MAX
 #include <utility>    // std::make_pair
 
+#include "SPTK/utils/profiler.h"
+
 namespace {
 
+// Tiles must have two or more rows and columns so that local paths reach only
+// adjacent tiles.
+const int kTileSize(64);
+
 struct Cell {
   double score;
   int horizontal_back_pointer;
   int vertical_back_pointer;
 };
 
+void UpdateCell(int i, int j, double local_distance,
+                const std::vector<std::pair<int, int> >& local_path_candidates,
+                const std::vector<double>& local_path_weights,
+                bool includes_skip_transition,
+                std::vector<std::vector<Cell> >* cell,
+                std::vector<std::vector<Cell> >* cell_for_skip_transition) {
+  const int num_candidate(static_cast<int>(local_path_candidates.size()));
+
+  double best_score_of_all_paths((0 == i && 0 == j) ? local_distance
+                                                    : DBL_MAX);
+  int best_i_of_all_paths(-1), best_j_of_all_paths(-1);
+
+  double best_score_of_diagonal_paths(DBL_MAX);
+  int best_i_of_diagonal_paths(-1), best_j_of_diagonal_paths(-1);
+
+  for (int k(0); k < num_candidate; ++k) {
+    const int i_k(i - local_path_candidates[k].first);
+    const int j_k(j - local_path_candidates[k].second);
+    if (0 <= i_k && 0 <= j_k) {
+      double score;
+      if (includes_skip_transition && (i_k == i || j_k == j)) {
+        score = local_path_weights[k] * local_distance +
+                (*cell_for_skip_transition)[i_k][j_k].score;
+      } else {
+        score =
+            local_path_weights[k] * local_distance + (*cell)[i_k][j_k].score;
+      }
+
+      if (includes_skip_transition && (i_k != i && j_k != j) &&
+          score < best_score_of_diagonal_paths) {
+        best_score_of_diagonal_paths = score;
+        best_i_of_diagonal_paths = i_k;
+        best_j_of_diagonal_paths = j_k;
+      }
+      if (score < best_score_of_all_paths) {
+        best_score_of_all_paths = score;
+        best_i_of_all_paths = i_k;
+        best_j_of_all_paths = j_k;
+      }
+    }
+  }
+
+  if (includes_skip_transition) {
+    (*cell_for_skip_transition)[i][j].score = best_score_of_diagonal_paths;
+    (*cell_for_skip_transition)[i][j].horizontal_back_pointer =
+        best_i_of_diagonal_paths;
+    (*cell_for_skip_transition)[i][j].vertical_back_pointer =
+        best_j_of_diagonal_paths;
+  }
+  (*cell)[i][j].score = best_score_of_all_paths;
+  (*cell)[i][j].horizontal_back_pointer = best_i_of_all_paths;
+  (*cell)[i][j].vertical_back_pointer = best_j_of_all_paths;
+}
+
 }  // namespace
 
 namespace sptk {
@@ -134,6 +195,16 @@ bool DynamicTimeWarping::Run(
     const std::vector<std::vector<double> >& reference_vector_sequence,
     std::vector<std::pair<int, int> >* viterbi_path,
     double* total_score) const {
+  return Run(query_vector_sequence, reference_vector_sequence, viterbi_path,
+             total_score, NULL);
+}
+
+bool DynamicTimeWarping::Run(
+    const std::vector<std::vector<double> >& query_vector_sequence,
+    const std::vector<std::vector<double> >& reference_vector_sequence,
+    std::vector<std::pair<int, int> >* viterbi_path, double* total_score,
+    ThreadPool* thread_pool) const {
+  SPTK_PROFILE_SCOPE("DynamicTimeWarping::Run");
   // Check inputs.
   if (!is_valid_ || query_vector_sequence.empty() ||
       reference_vector_sequence.empty() || NULL == viterbi_path ||
@@ -141,69 +212,76 @@ bool DynamicTimeWarping::Run(
     return false;
   }
 
-  const int num_candidate(static_cast<int>(local_path_candidates_.size()));
   const int num_query_vector(static_cast<int>(query_vector_sequence.size()));
   const int num_reference_vector(
       static_cast<int>(reference_vector_sequence.size()));
+  SPTK_PROFILE_FRAME(num_query_vector);
 
   std::vector<std::vector<Cell> > cell(num_query_vector,
                                        std::vector<Cell>(num_reference_vector));
   std::vector<std::vector<Cell> > cell_for_skip_transition(
       num_query_vector, std::vector<Cell>(num_reference_vector));
 
-  for (int i(0); i < num_query_vector; ++i) {
-    for (int j(0); j < num_reference_vector; ++j) {
-      double local_distance;
-      if (!distance_calculation_.Run(query_vector_sequence[i],
-                                     reference_vector_sequence[j],
-                                     &local_distance)) {
-        return false;
-      }
-
-      double best_score_of_all_paths((0 == i && 0 == j) ? local_distance
-                                                        : DBL_MAX);
-      int best_i_of_all_paths(-1), best_j_of_all_paths(-1);
-
-      double best_score_of_diagonal_paths(DBL_MAX);
-      int best_i_of_diagonal_paths(-1), best_j_of_diagonal_paths(-1);
-
-      for (int k(0); k < num_candidate; ++k) {
-        const int i_k(i - local_path_candidates_[k].first);
-        const int j_k(j - local_path_candidates_[k].second);
-        if (0 <= i_k && 0 <= j_k) {
-          double score;
-          if (includes_skip_transition_ && (i_k == i || j_k == j)) {
-            score = local_path_weights_[k] * local_distance +
-                    cell_for_skip_transition[i_k][j_k].score;
-          } else {
-            score =
-                local_path_weights_[k] * local_distance + cell[i_k][j_k].score;
-          }
-
-          if (includes_skip_transition_ && (i_k != i && j_k != j) &&
-              score < best_score_of_diagonal_paths) {
-            best_score_of_diagonal_paths = score;
-            best_i_of_diagonal_paths = i_k;
-            best_j_of_diagonal_paths = j_k;
-          }
-          if (score < best_score_of_all_paths) {
-            best_score_of_all_paths = score;
-            best_i_of_all_paths = i_k;
-            best_j_of_all_paths = j_k;
-          }
+  if (NULL == thread_pool || 1 == thread_pool->GetNumThread()) {
+    for (int i(0); i < num_query_vector; ++i) {
+      for (int j(0); j < num_reference_vector; ++j) {
+        double local_distance;
+        if (!distance_calculation_.Run(query_vector_sequence[i],
+                                       reference_vector_sequence[j],
+                                       &local_distance)) {
+          return false;
         }
+        UpdateCell(i, j, local_distance, local_path_candidates_,
+                   local_path_weights_, includes_skip_transition_, &cell,
+                   &cell_for_skip_transition);
       }
+    }
+  } else {
+    // The cells of a tile depend only on those of the tile itself and of the
+    // left, upper, and upper-left tiles. Thus the tiles on an anti-diagonal
+    // can be processed in parallel, each in the same order as above.
+    const int num_tile_row((num_query_vector + kTileSize - 1) / kTileSize);
+    const int num_tile_column((num_reference_vector + kTileSize - 1) /
+                              kTileSize);
+    std::atomic<bool> is_failed(false);
+    for (int d(0); d < num_tile_row + num_tile_column - 1; ++d) {
+      const int first_tile_row(std::max(0, d - num_tile_column + 1));
+      const int last_tile_row(std::min(d, num_tile_row - 1));
+      thread_pool->ParallelFor(
+          first_tile_row, last_tile_row + 1, 1, [&](int first, int last) {
+            std::vector<double> local_distances(kTileSize * kTileSize);
+            for (int tile_row(first); tile_row < last; ++tile_row) {
+              const int tile_column(d - tile_row);
+              const int begin_i(tile_row * kTileSize);
+              const int end_i(std::min(begin_i + kTileSize, num_query_vector));
+              const int begin_j(tile_column * kTileSize);
+              const int end_j(
+                  std::min(begin_j + kTileSize, num_reference_vector));
+              const int width(end_j - begin_j);
 
-      if (includes_skip_transition_) {
-        cell_for_skip_transition[i][j].score = best_score_of_diagonal_paths;
-        cell_for_skip_transition[i][j].horizontal_back_pointer =
-            best_i_of_diagonal_paths;
-        cell_for_skip_transition[i][j].vertical_back_pointer =
-            best_j_of_diagonal_paths;
-      }
-      cell[i][j].score = best_score_of_all_paths;
-      cell[i][j].horizontal_back_pointer = best_i_of_all_paths;
-      cell[i][j].vertical_back_pointer = best_j_of_all_paths;
+              for (int i(begin_i); i < end_i; ++i) {
+                if (!distance_calculation_.Run(
+                        query_vector_sequence[i], reference_vector_sequence,
+                        begin_j, end_j,
+                        &(local_distances[(i - begin_i) * width]))) {
+                  is_failed = true;
+                  return;
+                }
+              }
+
+              for (int i(begin_i); i < end_i; ++i) {
+                for (int j(begin_j); j < end_j; ++j) {
+                  UpdateCell(
+                      i, j,
+                      local_distances[(i - begin_i) * width + (j - begin_j)],
+                      local_path_candidates_, local_path_weights_,
+                      includes_skip_transition_, &cell,
+                      &cell_for_skip_transition);
+                }
+              }
+            }
+          });
+      if (is_failed) return false;
     }
   }
 
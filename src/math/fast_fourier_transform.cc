@@ -44,10 +44,67 @@
 
 #include "SPTK/math/fast_fourier_transform.h"
 
-#include <algorithm>  // std::copy, std::fill
+#include <algorithm>  // std::copy, std::fill, std::max
 #include <cmath>      // std::sin
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/profiler.h"
+#include "SPTK/utils/shared_table_cache.h"
+
+namespace {
+
+// Two radix-2 stages of one block in a single pass, i.e., radix-2^2.
+// The arithmetic is the same as that of the radix-2 stages.
+void FftButterflyRadix4(const double* cosine1, const double* sine1,
+                        const double* cosine2, const double* sine2,
+                        int quarter_length, double* x, double* y) {
+  const int q(quarter_length);
+  for (int i(0); i < q; ++i) {
+    double x0(x[i]), x1(x[i + q]), x2(x[i + 2 * q]), x3(x[i + 3 * q]);
+    double y0(y[i]), y1(y[i + q]), y2(y[i + 2 * q]), y3(y[i + 3 * q]);
+    {
+      const double t1(x0 - x2);
+      const double t2(y0 - y2);
+      x0 += x2;
+      y0 += y2;
+      x2 = cosine1[i] * t1 + sine1[i] * t2;
+      y2 = cosine1[i] * t2 - sine1[i] * t1;
+    }
+    {
+      const double t1(x1 - x3);
+      const double t2(y1 - y3);
+      x1 += x3;
+      y1 += y3;
+      x3 = cosine1[i + q] * t1 + sine1[i + q] * t2;
+      y3 = cosine1[i + q] * t2 - sine1[i + q] * t1;
+    }
+    {
+      const double t1(x0 - x1);
+      const double t2(y0 - y1);
+      x[i] = x0 + x1;
+      y[i] = y0 + y1;
+      x[i + q] = cosine2[i] * t1 + sine2[i] * t2;
+      y[i + q] = cosine2[i] * t2 - sine2[i] * t1;
+    }
+    {
+      const double t1(x2 - x3);
+      const double t2(y2 - y3);
+      x[i + 2 * q] = x2 + x3;
+      y[i + 2 * q] = y2 + y3;
+      x[i + 3 * q] = cosine2[i] * t1 + sine2[i] * t2;
+      y[i + 3 * q] = cosine2[i] * t2 - sine2[i] * t1;
+    }
+  }
+}
+
+const sptk::SimdKernels& GetSimdKernels(
+    sptk::SimdKernels::InstructionSets instruction_set) {
+  const sptk::SimdKernels* kernels(sptk::SimdKernels::Get(instruction_set));
+  return (NULL == kernels) ? sptk::SimdKernels::Get() : *kernels;
+}
+
+}  // namespace
+
 namespace sptk {
 
 FastFourierTransform::FastFourierTransform(int fft_length)
@@ -55,29 +112,56 @@ FastFourierTransform::FastFourierTransform(int fft_length)
 }
 
 FastFourierTransform::FastFourierTransform(int num_order, int fft_length)
+    : FastFourierTransform(num_order, fft_length,
+                           FastFourierTransformPlanner::GetComplexPlan(
+                               fft_length)) {
+}
+
+FastFourierTransform::FastFourierTransform(
+    int num_order, int fft_length,
+    const FastFourierTransformPlanner::ComplexPlan& plan)
     : num_order_(num_order),
       fft_length_(fft_length),
       half_fft_length_(fft_length_ / 2),
+      simd_kernels_(GetSimdKernels(plan.instruction_set)),
+      radix_(plan.radix),
       is_valid_(true) {
   if (num_order_ < 0 || fft_length_ <= num_order_ ||
-      !IsPowerOfTwo(fft_length_)) {
+      !IsPowerOfTwo(fft_length_) || (2 != radix_ && 4 != radix_)) {
     is_valid_ = false;
     return;
   }
 
-  const int table_size(fft_length_ - fft_length_ / 4 + 1);
-  const double argument(sptk::kPi / fft_length_ * 2);
-  sine_table_.resize(table_size);
-  for (int i(0); i < table_size; ++i) {
-    sine_table_[i] = std::sin(argument * i);
-  }
-  sine_table_[fft_length_ / 2] = 0.0;
+  // The twiddle factors of each stage are gathered so that the butterflies
+  // can be vectorized. The cosines are followed by the sines.
+  twiddle_table_ = SharedTableCache::Get<std::vector<double> >(
+      SharedTableCache::MakeKey("FastFourierTransform", fft_length_),
+      [fft_length](std::vector<double>* twiddle_table) {
+        const int table_size(fft_length - fft_length / 4 + 1);
+        const double argument(sptk::kPi / fft_length * 2);
+        std::vector<double> sine_table(table_size);
+        for (int i(0); i < table_size; ++i) {
+          sine_table[i] = std::sin(argument * i);
+        }
+        sine_table[fft_length / 2] = 0.0;
+
+        const int num_twiddle(std::max(0, fft_length - 2));
+        twiddle_table->resize(2 * num_twiddle);
+        int offset(0);
+        for (int lmx(fft_length / 2), lf(1); 1 < lmx; lmx /= 2, lf *= 2) {
+          for (int i(0); i < lmx; ++i, ++offset) {
+            (*twiddle_table)[offset] = sine_table[i * lf + fft_length / 4];
+            (*twiddle_table)[num_twiddle + offset] = sine_table[i * lf];
+          }
+        }
+      });
 }
 
 bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
                                const std::vector<double>& imag_part_input,
                                std::vector<double>* real_part_output,
                                std::vector<double>* imag_part_output) const {
+  SPTK_PROFILE_SCOPE("FastFourierTransform::Run");
   // Check inputs.
   if (!is_valid_ ||
       real_part_input.size() != static_cast<std::size_t>(num_order_ + 1) ||
@@ -108,31 +192,27 @@ bool FastFourierTransform::Run(const std::vector<double>& real_part_input,
   double* y(&((*imag_part_output)[0]));
 
   {
-    int lix(fft_length_);
+    const int num_twiddle(static_cast<int>(twiddle_table_->size() / 2));
+    int offset(0);
     int lmx(half_fft_length_);
-    int lf(1);
     while (1 < lmx) {
-      const double* sinp(&(sine_table_[0]));
-      const double* cosp(&(sine_table_[0]) + fft_length_ / 4);
-      for (int i(0); i < lmx; ++i) {
-        double* xpi(&(x[i]));
-        double* ypi(&(y[i]));
-        for (int li(lix); li <= fft_length_; li += lix) {
-          const double t1(*(xpi) - *(xpi + lmx));
-          const double t2(*(ypi) - *(ypi + lmx));
-          *(xpi) += *(xpi + lmx);
-          *(ypi) += *(ypi + lmx);
-          *(xpi + lmx) = *cosp * t1 + *sinp * t2;
-          *(ypi + lmx) = *cosp * t2 - *sinp * t1;
-          xpi += lix;
-          ypi += lix;
+      const double* cosp(&((*twiddle_table_)[offset]));
+      const double* sinp(&((*twiddle_table_)[num_twiddle + offset]));
+      if (4 == radix_ && 4 <= lmx) {
+        const int quarter_lmx(lmx / 2);
+        for (int li(0); li < fft_length_; li += 2 * lmx) {
+          FftButterflyRadix4(cosp, sinp, cosp + lmx, sinp + lmx, quarter_lmx,
+                             x + li, y + li);
+        }
+        offset += lmx + quarter_lmx;
+        lmx /= 4;
+      } else {
+        for (int li(0); li < fft_length_; li += 2 * lmx) {
+          simd_kernels_.fft_butterfly(cosp, sinp, lmx, x + li, y + li);
         }
-        sinp += lf;
-        cosp += lf;
+        offset += lmx;
+        lmx /= 2;
       }
-      lix = lmx;
-      lmx /= 2;
-      lf *= 2;
     }
   }
 
@@ -0,0 +1,422 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/math/fast_fourier_transform_planner.h"
+
+#include <unistd.h>  // getpid
+
+#include <chrono>    // std::chrono
+#include <cmath>     // std::sin
+#include <cstdio>    // std::remove, std::rename
+#include <cstdlib>   // std::getenv
+#include <cstring>   // std::strcmp
+#include <fstream>   // std::ifstream, std::ofstream
+#include <map>       // std::map
+#include <mutex>     // std::lock_guard, std::mutex
+#include <sstream>   // std::istringstream, std::ostringstream
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#include "SPTK/math/fast_fourier_transform.h"
+#include "SPTK/math/real_valued_fast_fourier_transform.h"
+
+namespace {
+
+// Minimum time spent on timing one variant.
+const double kMinMeasurementTimeInSeconds(2e-3);
+
+// Number of timings of one variant. The fastest one is used.
+const int kNumMeasurement(3);
+
+const char* const kPackingNames[sptk::FastFourierTransformPlanner::
+                                    kNumRealPackings] = {"half", "full"};
+
+enum PlanningModes { kEstimate = 0, kMeasure };
+
+struct Wisdom {
+  Wisdom() : planning_mode(kEstimate), is_loaded(false) {
+  }
+
+  PlanningModes planning_mode;
+  bool is_loaded;
+  std::string file_name;
+  std::mutex mutex;
+  std::map<int, sptk::FastFourierTransformPlanner::ComplexPlan> complex_plans;
+  std::map<int, sptk::FastFourierTransformPlanner::RealPlan> real_plans;
+};
+
+Wisdom* CreateWisdom() {
+  Wisdom* wisdom(new Wisdom());
+  const char* file_name(std::getenv("SPTK_FFT_WISDOM"));
+  if (NULL != file_name && '\0' != file_name[0]) {
+    wisdom->file_name = file_name;
+  }
+  const char* planning_mode(std::getenv("SPTK_FFT_PLANNING"));
+  if (NULL != planning_mode) {
+    if (0 == std::strcmp(planning_mode, "measure")) {
+      wisdom->planning_mode = kMeasure;
+    } else if (0 == std::strcmp(planning_mode, "estimate")) {
+      wisdom->planning_mode = kEstimate;
+    }
+  }
+  return wisdom;
+}
+
+// The wisdom is never destroyed since FFT objects may be created at exit.
+Wisdom* GetWisdom() {
+  static Wisdom* wisdom(CreateWisdom());
+  return wisdom;
+}
+
+bool IsValidLength(int fft_length) {
+  return 2 <= fft_length && sptk::IsPowerOfTwo(fft_length);
+}
+
+// Time one call of the given function in seconds.
+template <typename Function>
+double Measure(Function function) {
+  double best_time(0.0);
+  for (int n(0); n < kNumMeasurement; ++n) {
+    int num_call(0);
+    double elapsed_time(0.0);
+    const std::chrono::steady_clock::time_point start_time(
+        std::chrono::steady_clock::now());
+    do {
+      if (!function()) return -1.0;
+      ++num_call;
+      elapsed_time = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start_time)
+                         .count();
+    } while (elapsed_time < kMinMeasurementTimeInSeconds);
+    const double time(elapsed_time / num_call);
+    if (0 == n || time < best_time) best_time = time;
+  }
+  return best_time;
+}
+
+std::vector<double> MakeSignal(int length) {
+  std::vector<double> signal(length);
+  for (int i(0); i < length; ++i) {
+    signal[i] = std::sin(0.1 * i + 0.3);
+  }
+  return signal;
+}
+
+sptk::FastFourierTransformPlanner::ComplexPlan MeasureComplexPlan(
+    int fft_length) {
+  const std::vector<double> real_part_input(MakeSignal(fft_length));
+  const std::vector<double> imag_part_input(MakeSignal(fft_length));
+  std::vector<double> real_part_output(fft_length);
+  std::vector<double> imag_part_output(fft_length);
+
+  // If an instruction set is given explicitly, only radix is planned.
+  const bool is_fixed_instruction_set(NULL != std::getenv("SPTK_SIMD"));
+
+  sptk::FastFourierTransformPlanner::ComplexPlan best_plan;
+  double best_time(-1.0);
+  for (int k(sptk::SimdKernels::kScalar); k < sptk::SimdKernels::kCheck; ++k) {
+    sptk::FastFourierTransformPlanner::ComplexPlan plan;
+    if (!is_fixed_instruction_set) {
+      plan.instruction_set = static_cast<sptk::SimdKernels::InstructionSets>(k);
+      if (!sptk::SimdKernels::IsSupported(plan.instruction_set)) continue;
+    } else if (sptk::SimdKernels::kScalar != k) {
+      break;
+    }
+    for (int radix(2); radix <= 4; radix += 2) {
+      plan.radix = radix;
+      const sptk::FastFourierTransform fft(fft_length - 1, fft_length, plan);
+      const double time(Measure([&]() {
+        return fft.Run(real_part_input, imag_part_input, &real_part_output,
+                       &imag_part_output);
+      }));
+      if (0.0 <= time && (best_time < 0.0 || time < best_time)) {
+        best_plan = plan;
+        best_time = time;
+      }
+    }
+  }
+  return best_plan;
+}
+
+sptk::FastFourierTransformPlanner::RealPlan MeasureRealPlan(int fft_length) {
+  const std::vector<double> real_part_input(MakeSignal(fft_length));
+  std::vector<double> real_part_output(fft_length);
+  std::vector<double> imag_part_output(fft_length);
+
+  sptk::FastFourierTransformPlanner::RealPlan best_plan;
+  double best_time(-1.0);
+  for (int k(0); k < sptk::FastFourierTransformPlanner::kNumRealPackings;
+       ++k) {
+    sptk::FastFourierTransformPlanner::RealPlan plan;
+    plan.packing = static_cast<sptk::FastFourierTransformPlanner::RealPackings>(k);
+    const sptk::RealValuedFastFourierTransform fft(fft_length - 1, fft_length,
+                                                   plan);
+    sptk::RealValuedFastFourierTransform::Buffer buffer;
+    const double time(Measure([&]() {
+      return fft.Run(real_part_input, &real_part_output, &imag_part_output,
+                     &buffer);
+    }));
+    if (0.0 <= time && (best_time < 0.0 || time < best_time)) {
+      best_plan = plan;
+      best_time = time;
+    }
+  }
+  return best_plan;
+}
+
+bool ParseWisdom(std::istream* input_stream, Wisdom* wisdom) {
+  std::string line;
+  while (std::getline(*input_stream, line)) {
+    std::istringstream iss(line);
+    std::string type;
+    int fft_length;
+    if (!(iss >> type) || '#' == type[0]) continue;
+    if (!(iss >> fft_length) || !IsValidLength(fft_length)) return false;
+
+    if ("complex" == type) {
+      std::string name;
+      sptk::FastFourierTransformPlanner::ComplexPlan plan;
+      if (!(iss >> name >> plan.radix)) return false;
+      if (2 != plan.radix && 4 != plan.radix) return false;
+      // Skip plans of instruction sets which the host does not support.
+      bool is_supported(false);
+      for (int k(0); k < sptk::SimdKernels::kCheck; ++k) {
+        const sptk::SimdKernels::InstructionSets instruction_set(
+            static_cast<sptk::SimdKernels::InstructionSets>(k));
+        if (name == sptk::SimdKernels::GetName(instruction_set)) {
+          plan.instruction_set = instruction_set;
+          is_supported = sptk::SimdKernels::IsSupported(instruction_set);
+          break;
+        }
+      }
+      if (is_supported) {
+        wisdom->complex_plans[fft_length] = plan;
+      }
+    } else if ("real" == type) {
+      std::string name;
+      if (!(iss >> name)) return false;
+      bool is_found(false);
+      for (int k(0); k < sptk::FastFourierTransformPlanner::kNumRealPackings;
+           ++k) {
+        if (name == kPackingNames[k]) {
+          sptk::FastFourierTransformPlanner::RealPlan plan;
+          plan.packing =
+              static_cast<sptk::FastFourierTransformPlanner::RealPackings>(k);
+          wisdom->real_plans[fft_length] = plan;
+          is_found = true;
+          break;
+        }
+      }
+      if (!is_found) return false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void WriteWisdom(const Wisdom& wisdom, std::ostream* output_stream) {
+  *output_stream << "# SPTK FFT wisdom" << std::endl;
+  for (std::map<int, sptk::FastFourierTransformPlanner::ComplexPlan>::
+           const_iterator itr(wisdom.complex_plans.begin());
+       itr != wisdom.complex_plans.end(); ++itr) {
+    *output_stream << "complex " << itr->first << " "
+                   << sptk::SimdKernels::GetName(itr->second.instruction_set)
+                   << " " << itr->second.radix << std::endl;
+  }
+  for (std::map<int, sptk::FastFourierTransformPlanner::RealPlan>::
+           const_iterator itr(wisdom.real_plans.begin());
+       itr != wisdom.real_plans.end(); ++itr) {
+    *output_stream << "real " << itr->first << " "
+                   << kPackingNames[itr->second.packing] << std::endl;
+  }
+}
+
+// Load the wisdom file given by the environment variable once.
+void LoadWisdomIfNeeded(Wisdom* wisdom) {
+  if (wisdom->is_loaded) return;
+  wisdom->is_loaded = true;
+  if (!wisdom->file_name.empty()) {
+    std::ifstream ifs(wisdom->file_name.c_str());
+    if (ifs.is_open()) {
+      ParseWisdom(&ifs, wisdom);
+    }
+  }
+}
+
+// Merge the wisdom with the file so that plans stored by other processes are
+// kept, write it to a temporary file, and rename it so that concurrent
+// processes never read a partially written file.
+bool StoreWisdom(const Wisdom& wisdom, const std::string& file_name) {
+  Wisdom merged_wisdom;
+  {
+    std::ifstream ifs(file_name.c_str());
+    if (ifs.is_open()) {
+      ParseWisdom(&ifs, &merged_wisdom);
+    }
+  }
+  for (std::map<int, sptk::FastFourierTransformPlanner::ComplexPlan>::
+           const_iterator itr(wisdom.complex_plans.begin());
+       itr != wisdom.complex_plans.end(); ++itr) {
+    merged_wisdom.complex_plans[itr->first] = itr->second;
+  }
+  for (std::map<int, sptk::FastFourierTransformPlanner::RealPlan>::
+           const_iterator itr(wisdom.real_plans.begin());
+       itr != wisdom.real_plans.end(); ++itr) {
+    merged_wisdom.real_plans[itr->first] = itr->second;
+  }
+
+  std::ostringstream temporary_file_name;
+  temporary_file_name << file_name << ".tmp" << getpid();
+  {
+    std::ofstream ofs(temporary_file_name.str().c_str());
+    if (!ofs.is_open()) return false;
+    WriteWisdom(merged_wisdom, &ofs);
+    if (ofs.fail()) {
+      ofs.close();
+      std::remove(temporary_file_name.str().c_str());
+      return false;
+    }
+  }
+  if (0 != std::rename(temporary_file_name.str().c_str(), file_name.c_str())) {
+    std::remove(temporary_file_name.str().c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+namespace sptk {
+
+FastFourierTransformPlanner::ComplexPlan
+FastFourierTransformPlanner::GetComplexPlan(int fft_length) {
+  ComplexPlan plan(GetComplexPlanFromWisdom(fft_length));
+  // An instruction set given explicitly takes precedence over the wisdom.
+  if (NULL != std::getenv("SPTK_SIMD")) {
+    plan.instruction_set = SimdKernels::Get().instruction_set;
+  }
+  return plan;
+}
+
+FastFourierTransformPlanner::ComplexPlan
+FastFourierTransformPlanner::GetComplexPlanFromWisdom(int fft_length) {
+  if (!IsValidLength(fft_length)) {
+    return ComplexPlan();
+  }
+
+  Wisdom* wisdom(GetWisdom());
+  {
+    std::lock_guard<std::mutex> lock(wisdom->mutex);
+    LoadWisdomIfNeeded(wisdom);
+    std::map<int, ComplexPlan>::const_iterator itr(
+        wisdom->complex_plans.find(fft_length));
+    if (itr != wisdom->complex_plans.end()) {
+      return itr->second;
+    }
+    if (kEstimate == wisdom->planning_mode) {
+      return ComplexPlan();
+    }
+  }
+
+  // Measure without the lock since the FFTs to be timed may ask for plans.
+  const ComplexPlan plan(MeasureComplexPlan(fft_length));
+  std::lock_guard<std::mutex> lock(wisdom->mutex);
+  wisdom->complex_plans[fft_length] = plan;
+  if (!wisdom->file_name.empty()) {
+    StoreWisdom(*wisdom, wisdom->file_name);
+  }
+  return plan;
+}
+
+FastFourierTransformPlanner::RealPlan FastFourierTransformPlanner::GetRealPlan(
+    int fft_length) {
+  if (!IsValidLength(fft_length)) {
+    return RealPlan();
+  }
+
+  Wisdom* wisdom(GetWisdom());
+  {
+    std::lock_guard<std::mutex> lock(wisdom->mutex);
+    LoadWisdomIfNeeded(wisdom);
+    std::map<int, RealPlan>::const_iterator itr(
+        wisdom->real_plans.find(fft_length));
+    if (itr != wisdom->real_plans.end()) {
+      return itr->second;
+    }
+    if (kEstimate == wisdom->planning_mode) {
+      return RealPlan();
+    }
+  }
+
+  // Measure without the lock since the FFTs to be timed may ask for plans.
+  const RealPlan plan(MeasureRealPlan(fft_length));
+  std::lock_guard<std::mutex> lock(wisdom->mutex);
+  wisdom->real_plans[fft_length] = plan;
+  if (!wisdom->file_name.empty()) {
+    StoreWisdom(*wisdom, wisdom->file_name);
+  }
+  return plan;
+}
+
+bool FastFourierTransformPlanner::LoadWisdom(const std::string& file_name) {
+  std::ifstream ifs(file_name.c_str());
+  if (!ifs.is_open()) {
+    return false;
+  }
+  Wisdom* wisdom(GetWisdom());
+  std::lock_guard<std::mutex> lock(wisdom->mutex);
+  LoadWisdomIfNeeded(wisdom);
+  return ParseWisdom(&ifs, wisdom);
+}
+
+bool FastFourierTransformPlanner::SaveWisdom(const std::string& file_name) {
+  Wisdom* wisdom(GetWisdom());
+  std::lock_guard<std::mutex> lock(wisdom->mutex);
+  LoadWisdomIfNeeded(wisdom);
+  return StoreWisdom(*wisdom, file_name);
+}
+
+}  // namespace sptk
@@ -47,6 +47,8 @@
 #include <algorithm>  // std::copy, std::fill
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
 namespace sptk {
 
 FrequencyTransform::FrequencyTransform(int num_input_order,
@@ -65,6 +67,7 @@ FrequencyTransform::FrequencyTransform(int num_input_order,
 bool FrequencyTransform::Run(const std::vector<double>& minimum_phase_sequence,
                              std::vector<double>* warped_sequence,
                              FrequencyTransform::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("FrequencyTransform::Run");
   // Check inputs.
   const int input_length(num_input_order_ + 1);
   if (!is_valid_ ||
@@ -44,10 +44,16 @@
 
 #include "SPTK/math/gaussian_mixture_model_based_conversion.h"
 
-#include <algorithm>  // std::copy, std::max_element
+#include <algorithm>  // std::copy, std::min
+#include <cmath>      // std::log
 #include <cstddef>    // std::size_t
 
-#include "SPTK/math/gaussian_mixture_modeling.h"
+namespace {
+
+// Number of frames processed at once.
+const int kBlockSize(64);
+
+}  // namespace
 
 namespace sptk {
 
@@ -71,9 +77,10 @@ GaussianMixtureModelBasedConversion::GaussianMixtureModelBasedConversion(
       mlpg_(num_target_order_, window_coefficients, use_magic_number_,
             magic_number_),
       is_valid_(true),
+      log_constants_(num_mixture_),
       source_mean_vectors_(num_mixture_, std::vector<double>(source_length_)),
-      source_covariance_matrices_(num_mixture_,
-                                  SymmetricMatrix(source_length_)),
+      source_precision_matrices_(num_mixture_,
+                                 Matrix(source_length_, source_length_)),
       e_slope_(num_mixture_, Matrix(target_length_, source_length_)),
       e_bias_(num_mixture_, std::vector<double>(target_length_)),
       d_(num_mixture_, SymmetricMatrix(target_length_)) {
@@ -97,18 +104,42 @@ GaussianMixtureModelBasedConversion::GaussianMixtureModelBasedConversion(
               source_mean_vectors_[k].begin());
 
     // Set \Sigma^{(XX)}.
+    SymmetricMatrix source_covariance_matrix(source_length_);
     for (int l(0); l < source_length_; ++l) {
       for (int m(0); m <= l; ++m) {
-        source_covariance_matrices_[k][l][m] = covariance_matrices[k][l][m];
+        source_covariance_matrix[l][m] = covariance_matrices[k][l][m];
       }
     }
 
-    // Set \Sigma^{(YX)} \Sigma^{(XX)}^{-1}.
+    // Set log w - 0.5 * log |2 \pi \Sigma^{(XX)}|.
+    {
+      SymmetricMatrix lower_triangular_matrix;
+      std::vector<double> diagonal_elements;
+      if (!source_covariance_matrix.CholeskyDecomposition(
+              &lower_triangular_matrix, &diagonal_elements)) {
+        is_valid_ = false;
+        return;
+      }
+      double gconst(source_length_ * std::log(kTwoPi));
+      for (int l(0); l < source_length_; ++l) {
+        gconst += std::log(diagonal_elements[l]);
+      }
+      log_constants_[k] = std::log(weights_[k]) - 0.5 * gconst;
+    }
+
+    // Set \Sigma^{(XX)}^{-1}.
     SymmetricMatrix xx(source_length_);
-    if (!source_covariance_matrices_[k].Invert(&xx)) {
+    if (!source_covariance_matrix.Invert(&xx)) {
       is_valid_ = false;
       return;
     }
+    for (int l(0); l < source_length_; ++l) {
+      for (int m(0); m < source_length_; ++m) {
+        source_precision_matrices_[k][l][m] = xx[l][m];
+      }
+    }
+
+    // Set \Sigma^{(YX)} \Sigma^{(XX)}^{-1}.
     for (int l(0); l < target_length_; ++l) {
       const int ll(source_length_ + l);
       for (int m(0); m < source_length_; ++m) {
@@ -158,39 +189,74 @@ bool GaussianMixtureModelBasedConversion::Run(
   std::vector<SymmetricMatrix> d(sequence_length,
                                  SymmetricMatrix(target_length_));
 
-  // Compute posterior probabilities of source input.
-  {
-    std::vector<double> components_of_log_probability(num_mixture_);
-    GaussianMixtureModeling::Buffer buffer;
-    for (int t(0); t < sequence_length; ++t) {
-      if (use_magic_number_ && magic_number_ == source_vectors[t][0]) {
-        continue;
-      }
+  // Check size of source vectors.
+  for (int t(0); t < sequence_length; ++t) {
+    if (source_vectors[t].size() != static_cast<std::size_t>(source_length_)) {
+      return false;
+    }
+  }
 
-      if (!GaussianMixtureModeling::CalculateLogProbability(
-              source_length_ - 1, num_mixture_, false, 0 == t,
-              source_vectors[t], weights_, source_mean_vectors_,
-              source_covariance_matrices_, &components_of_log_probability, NULL,
-              &buffer)) {
-        return false;
-      }
+  // Process a block of frames at once.
+  std::vector<int> selected_mixtures(kBlockSize);
+  std::vector<double> max_log_probabilities(kBlockSize);
+  std::vector<double> diff(source_length_);
+  for (int begin(0); begin < sequence_length; begin += kBlockSize) {
+    const int block_size(std::min(kBlockSize, sequence_length - begin));
+    std::fill(selected_mixtures.begin(), selected_mixtures.end(), -1);
 
-      const int selected_mixture(static_cast<int>(
-          std::max_element(components_of_log_probability.begin(),
-                           components_of_log_probability.end()) -
-          components_of_log_probability.begin()));
+    // Select the mixture component with the maximum posterior probability.
+    for (int k(0); k < num_mixture_; ++k) {
+      const double* mu(&(source_mean_vectors_[k][0]));
+      const Matrix& precision(source_precision_matrices_[k]);
+      for (int b(0); b < block_size; ++b) {
+        const double* x(&(source_vectors[begin + b][0]));
+        if (use_magic_number_ && magic_number_ == x[0]) {
+          continue;
+        }
 
-      // Set E.
-      for (int l(0); l < target_length_; ++l) {
-        double tmp(0.0);
-        for (int m(0); m < source_length_; ++m) {
-          tmp += e_slope_[selected_mixture][l][m] * source_vectors[t][m];
+        for (int l(0); l < source_length_; ++l) {
+          diff[l] = x[l] - mu[l];
+        }
+        double sum(0.0);
+        for (int l(0); l < source_length_; ++l) {
+          const double* p(precision[l]);
+          double tmp(0.0);
+          for (int m(0); m < l; ++m) {
+            tmp += p[m] * diff[m];
+          }
+          sum += diff[l] * (2.0 * tmp + p[l] * diff[l]);
+        }
+
+        const double log_probability(log_constants_[k] - 0.5 * sum);
+        if (selected_mixtures[b] < 0 ||
+            max_log_probabilities[b] < log_probability) {
+          max_log_probabilities[b] = log_probability;
+          selected_mixtures[b] = k;
         }
-        e[t][l] = e_bias_[selected_mixture][l] + tmp;
       }
+    }
+
+    // Set E and D of the frames assigned to each mixture component.
+    for (int k(0); k < num_mixture_; ++k) {
+      const Matrix& slope(e_slope_[k]);
+      const double* bias(&(e_bias_[k][0]));
+      for (int b(0); b < block_size; ++b) {
+        if (k != selected_mixtures[b]) continue;
 
-      // Set D.
-      d[t] = d_[selected_mixture];
+        const int t(begin + b);
+        const double* x(&(source_vectors[t][0]));
+        double* y(&(e[t][0]));
+        for (int l(0); l < target_length_; ++l) {
+          const double* a(slope[l]);
+          double tmp(0.0);
+          for (int m(0); m < source_length_; ++m) {
+            tmp += a[m] * x[m];
+          }
+          y[l] = bias[l] + tmp;
+        }
+
+        d[t] = d_[k];
+      }
     }
   }
 
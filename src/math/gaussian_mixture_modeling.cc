@@ -54,6 +54,7 @@
 
 #include "SPTK/compression/linde_buzo_gray_algorithm.h"
 #include "SPTK/math/statistics_accumulation.h"
+#include "SPTK/utils/profiler.h"
 
 namespace {
 
@@ -194,6 +195,7 @@ bool GaussianMixtureModeling::Run(
     std::vector<double>* weights,
     std::vector<std::vector<double> >* mean_vectors,
     std::vector<SymmetricMatrix>* covariance_matrices) const {
+  SPTK_PROFILE_SCOPE("GaussianMixtureModeling::Run");
   // Check inputs.
   if (!is_valid_ || input_vectors.empty() || NULL == weights ||
       NULL == mean_vectors || NULL == covariance_matrices) {
@@ -226,6 +228,8 @@ bool GaussianMixtureModeling::Run(
     default: { return false; }
   }
 
+  SPTK_PROFILE_FRAME(input_vectors.size());
+
   // Prepare memories.
   std::vector<double> buffer0(num_mixture_);
   std::vector<std::vector<double> > buffer1(num_mixture_);
@@ -242,6 +246,8 @@ bool GaussianMixtureModeling::Run(
   double prev_log_likelihood(-DBL_MAX);
 
   for (int n(1); n <= num_iteration_; ++n) {
+    SPTK_PROFILE_ITERATION(1);
+
     // Clear buffers.
     std::fill(buffer0.begin(), buffer0.end(), 0.0);
     for (int k(0); k < num_mixture_; ++k) {
@@ -386,6 +392,7 @@ bool GaussianMixtureModeling::CalculateLogProbability(
     const std::vector<SymmetricMatrix>& covariance_matrices,
     std::vector<double>* components_of_log_probability, double* log_probability,
     GaussianMixtureModeling::Buffer* buffer) {
+  SPTK_PROFILE_SCOPE("GaussianMixtureModeling::CalculateLogProbability");
   // Check inputs.
   const int length(num_order + 1);
   if (num_mixture < 0 ||
@@ -558,7 +565,7 @@ bool GaussianMixtureModeling::Initialize(
     const int seed(1);
     LindeBuzoGrayAlgorithm lbg(num_order_, 1, num_mixture_, 1, num_iteration,
                                convergence_threshold, splitting_factor, seed);
-    if (!lbg.Run(input_vectors, mean_vectors, &codebook_indices)) {
+    if (!lbg.Run(input_vectors, mean_vectors, &codebook_indices, NULL)) {
       return false;
     }
   }
@@ -47,6 +47,15 @@
 #include <cmath>    // std::fabs, std::isnan, std::sqrt
 #include <cstddef>  // std::size_t
 
+#include "SPTK/utils/profiler.h"
+
+namespace {
+
+// Number of frames processed in SIMD lanes.
+const int kNumLane(4);
+
+}  // namespace
+
 namespace sptk {
 
 LevinsonDurbinRecursion::LevinsonDurbinRecursion(int num_order)
@@ -61,6 +70,7 @@ bool LevinsonDurbinRecursion::Run(
     const std::vector<double>& autocorrelation,
     std::vector<double>* linear_predictive_coefficients, bool* is_stable,
     LevinsonDurbinRecursion::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("LevinsonDurbinRecursion::Run");
   // Check inputs.
   const int length(num_order_ + 1);
   if (!is_valid_ ||
@@ -133,4 +143,137 @@ bool LevinsonDurbinRecursion::Run(
   return Run(input, input_and_output, is_stable, buffer);
 }
 
+bool LevinsonDurbinRecursion::Run(
+    const std::vector<std::vector<double> >& autocorrelations,
+    std::vector<std::vector<double> >* linear_predictive_coefficients,
+    std::vector<bool>* is_stable,
+    LevinsonDurbinRecursion::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("LevinsonDurbinRecursion::Run");
+  // Check inputs.
+  const int length(num_order_ + 1);
+  if (!is_valid_ || NULL == linear_predictive_coefficients ||
+      NULL == is_stable || NULL == buffer) {
+    return false;
+  }
+  const int num_frame(static_cast<int>(autocorrelations.size()));
+  SPTK_PROFILE_FRAME(num_frame);
+  for (int n(0); n < num_frame; ++n) {
+    if (autocorrelations[n].size() != static_cast<std::size_t>(length)) {
+      return false;
+    }
+  }
+
+  // Prepare memories.
+  if (linear_predictive_coefficients->size() !=
+      static_cast<std::size_t>(num_frame)) {
+    linear_predictive_coefficients->resize(num_frame);
+  }
+  for (int n(0); n < num_frame; ++n) {
+    if ((*linear_predictive_coefficients)[n].size() !=
+        static_cast<std::size_t>(length)) {
+      (*linear_predictive_coefficients)[n].resize(length);
+    }
+  }
+  if (is_stable->size() != static_cast<std::size_t>(num_frame)) {
+    is_stable->resize(num_frame);
+  }
+  if (buffer->r_.size() != static_cast<std::size_t>(length * kNumLane)) {
+    buffer->r_.resize(length * kNumLane);
+  }
+  if (buffer->a_.size() != static_cast<std::size_t>(length * kNumLane)) {
+    buffer->a_.resize(length * kNumLane);
+  }
+  if (buffer->c_.size() < static_cast<std::size_t>(length * kNumLane)) {
+    buffer->c_.resize(length * kNumLane);
+  }
+
+  bool is_successful(true);
+  int n(0);
+  for (; n + kNumLane <= num_frame; n += kNumLane) {
+    // Interleave autocorrelation of four frames, i.e., r[i * 4 + k] is the
+    // i-th autocorrelation of the k-th frame.
+    double* r(&buffer->r_[0]);
+    double* a(&buffer->a_[0]);
+    double* c(&buffer->c_[0]);
+    for (int i(0); i < length; ++i) {
+      for (int k(0); k < kNumLane; ++k) {
+        r[i * kNumLane + k] = autocorrelations[n + k][i];
+      }
+    }
+
+    // Set initial condition.
+    double e[kNumLane];
+    bool is_stable_in_lane[kNumLane];
+    bool is_failed_in_lane[kNumLane];
+    for (int k(0); k < kNumLane; ++k) {
+      a[k] = 0.0;
+      e[k] = r[k];
+      is_stable_in_lane[k] = true;
+      is_failed_in_lane[k] = (0.0 == e[k] || std::isnan(e[k]));
+    }
+
+    // Perform Durbin's iterative algorithm.
+    for (int i(1); i < length; ++i) {
+      double kappa[kNumLane];
+      for (int k(0); k < kNumLane; ++k) {
+        kappa[k] = -r[i * kNumLane + k];
+      }
+      for (int j(1); j < i; ++j) {
+        for (int k(0); k < kNumLane; ++k) {
+          kappa[k] -= c[j * kNumLane + k] * r[(i - j) * kNumLane + k];
+        }
+      }
+      for (int k(0); k < kNumLane; ++k) {
+        kappa[k] /= e[k];
+        if (1.0 <= std::fabs(kappa[k])) {
+          is_stable_in_lane[k] = false;
+        }
+      }
+
+      for (int j(1); j < i; ++j) {
+        for (int k(0); k < kNumLane; ++k) {
+          a[j * kNumLane + k] =
+              c[j * kNumLane + k] + kappa[k] * c[(i - j) * kNumLane + k];
+        }
+      }
+      for (int k(0); k < kNumLane; ++k) {
+        a[i * kNumLane + k] = kappa[k];
+        e[k] *= 1.0 - kappa[k] * kappa[k];
+        if (0.0 == e[k] || std::isnan(e[k])) {
+          is_failed_in_lane[k] = true;
+        }
+      }
+
+      for (int j(0); j <= i * kNumLane + kNumLane - 1; ++j) {
+        c[j] = a[j];
+      }
+    }
+
+    // Set gain and store outputs.
+    for (int k(0); k < kNumLane; ++k) {
+      if (is_failed_in_lane[k]) {
+        is_successful = false;
+      }
+      (*is_stable)[n + k] = is_stable_in_lane[k];
+      double* output(&((*linear_predictive_coefficients)[n + k][0]));
+      output[0] = std::sqrt(e[k]);
+      for (int i(1); i < length; ++i) {
+        output[i] = a[i * kNumLane + k];
+      }
+    }
+  }
+
+  // Solve the rest frames one by one.
+  for (; n < num_frame; ++n) {
+    bool is_stable_in_frame(false);
+    if (!Run(autocorrelations[n], &((*linear_predictive_coefficients)[n]),
+             &is_stable_in_frame, buffer)) {
+      is_successful = false;
+    }
+    (*is_stable)[n] = is_stable_in_frame;
+  }
+
+  return is_successful;
+}
+
 }  // namespace sptk
@@ -44,10 +44,13 @@
 
 #include "SPTK/math/real_valued_fast_fourier_transform.h"
 
-#include <algorithm>  // std::fill
+#include <algorithm>  // std::copy, std::fill
 #include <cmath>      // std::sin
 #include <cstddef>    // std::size_t
 
+#include "SPTK/utils/profiler.h"
+#include "SPTK/utils/shared_table_cache.h"
+
 namespace sptk {
 
 RealValuedFastFourierTransform::RealValuedFastFourierTransform(int fft_length)
@@ -56,10 +59,22 @@ RealValuedFastFourierTransform::RealValuedFastFourierTransform(int fft_length)
 
 RealValuedFastFourierTransform::RealValuedFastFourierTransform(int num_order,
                                                                int fft_length)
+    : RealValuedFastFourierTransform(
+          num_order, fft_length,
+          FastFourierTransformPlanner::GetRealPlan(fft_length)) {
+}
+
+RealValuedFastFourierTransform::RealValuedFastFourierTransform(
+    int num_order, int fft_length,
+    const FastFourierTransformPlanner::RealPlan& plan)
     : num_order_(num_order),
       fft_length_(fft_length),
       half_fft_length_(fft_length_ / 2),
-      fast_fourier_transform_(half_fft_length_),
+      packing_(plan.packing),
+      fast_fourier_transform_(
+          FastFourierTransformPlanner::kFullLengthComplex == packing_
+              ? fft_length_
+              : half_fft_length_),
       is_valid_(true) {
   if (num_order_ < 0 || fft_length_ <= num_order_ ||
       !IsPowerOfTwo(fft_length_) || !fast_fourier_transform_.IsValid()) {
@@ -67,13 +82,21 @@ RealValuedFastFourierTransform::RealValuedFastFourierTransform(int num_order,
     return;
   }
 
-  const int table_size(fft_length_ - fft_length_ / 4 + 1);
-  const double argument(sptk::kPi / fft_length_ * 2);
-  sine_table_.resize(table_size);
-  for (int i(0); i < table_size; ++i) {
-    sine_table_[i] = std::sin(argument * i);
+  if (FastFourierTransformPlanner::kFullLengthComplex == packing_) {
+    return;
   }
-  sine_table_[fft_length_ / 2] = 0.0;
+
+  sine_table_ = SharedTableCache::Get<std::vector<double> >(
+      SharedTableCache::MakeKey("RealValuedFastFourierTransform", fft_length_),
+      [fft_length](std::vector<double>* sine_table) {
+        const int table_size(fft_length - fft_length / 4 + 1);
+        const double argument(sptk::kPi / fft_length * 2);
+        sine_table->resize(table_size);
+        for (int i(0); i < table_size; ++i) {
+          (*sine_table)[i] = std::sin(argument * i);
+        }
+        (*sine_table)[fft_length / 2] = 0.0;
+      });
 }
 
 bool RealValuedFastFourierTransform::Run(
@@ -81,6 +104,7 @@ bool RealValuedFastFourierTransform::Run(
     std::vector<double>* real_part_output,
     std::vector<double>* imag_part_output,
     RealValuedFastFourierTransform::Buffer* buffer) const {
+  SPTK_PROFILE_SCOPE("RealValuedFastFourierTransform::Run");
   // Check inputs.
   const int input_length(num_order_ + 1);
   if (!is_valid_ ||
@@ -89,6 +113,28 @@ bool RealValuedFastFourierTransform::Run(
     return false;
   }
 
+  if (FastFourierTransformPlanner::kFullLengthComplex == packing_) {
+    // Transform real-valued input as complex-valued one with zero imaginary
+    // part.
+    if (buffer->real_part_input_.size() !=
+        static_cast<std::size_t>(fft_length_)) {
+      buffer->real_part_input_.resize(fft_length_);
+    }
+    if (buffer->imag_part_input_.size() !=
+        static_cast<std::size_t>(fft_length_)) {
+      buffer->imag_part_input_.resize(fft_length_);
+    }
+    std::copy(real_part_input.begin(), real_part_input.end(),
+              buffer->real_part_input_.begin());
+    std::fill(buffer->real_part_input_.begin() + input_length,
+              buffer->real_part_input_.end(), 0.0);
+    std::fill(buffer->imag_part_input_.begin(), buffer->imag_part_input_.end(),
+              0.0);
+    return fast_fourier_transform_.Run(buffer->real_part_input_,
+                                       buffer->imag_part_input_,
+                                       real_part_output, imag_part_output);
+  }
+
   // Prepare memories.
   if (buffer->real_part_input_.size() !=
       static_cast<std::size_t>(half_fft_length_)) {
@@ -136,8 +182,8 @@ bool RealValuedFastFourierTransform::Run(
   *(yp + half_fft_length_) = 0.0;
   *yp = 0.0;
 
-  const double* sinp(&(sine_table_[0]));
-  const double* cosp(&(sine_table_[0]) + fft_length_ / 4);
+  const double* sinp(&((*sine_table_)[0]));
+  const double* cosp(&((*sine_table_)[0]) + fft_length_ / 4);
   for (int i(1), j(half_fft_length_ - 2); i < half_fft_length_; ++i, j -= 2) {
     ++xp;
     ++yp;
@@ -0,0 +1,810 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/utils/feature_container.h"
+
+#include <fcntl.h>     // open, O_RDONLY
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+
+#include <algorithm>  // std::min
+#include <climits>    // INT_MAX
+#include <cstring>    // std::memcmp, std::memcpy, std::memmove, std::memset
+#include <fstream>    // std::ifstream
+#include <ios>        // std::ios_base
+#include <memory>     // std::unique_ptr
+#include <streambuf>  // std::streambuf
+
+#include "SPTK/compression/lossless_feature_decoding.h"
+#include "SPTK/compression/lossless_feature_format.h"
+#include "SPTK/utils/int24_t.h"
+#include "SPTK/utils/uint24_t.h"
+
+namespace {
+
+const char* const kHeaderMagic("SPTKFEAT");
+const char* const kIndexMagic("SPTKINDX");
+const int kMagicSize(8);
+const int32_t kFormatVersion(1);
+const int kHeaderSize(64);
+const int kChunkSize(16);
+const int kFooterSize(24);
+
+// Header layout.
+const int kVersionOffset(8);
+const int kDataTypeOffset(12);
+const int kVectorLengthOffset(16);
+const int kFramePeriodOffset(24);
+const int kSamplingRateOffset(32);
+
+// Frames read from a pipe are held back by this size, so that the chunk index
+// of up to 65534 chunks is not passed as frames.
+const int kLookaheadSize(1 << 20);
+const int kReadSize(1 << 16);
+
+int GetDataSize(const std::string& data_type) {
+  if ("c" == data_type || "C" == data_type) return 1;
+  if ("s" == data_type || "S" == data_type) return 2;
+  if ("h" == data_type || "H" == data_type) return 3;
+  if ("i" == data_type || "I" == data_type) return 4;
+  if ("l" == data_type || "L" == data_type) return 8;
+  if ("f" == data_type) return static_cast<int>(sizeof(float));
+  if ("d" == data_type) return static_cast<int>(sizeof(double));
+  if ("e" == data_type) return static_cast<int>(sizeof(long double));
+  return 0;
+}
+
+template <typename T>
+void ConvertToDouble(const char* input, int length, double* output) {
+  for (int i(0); i < length; ++i) {
+    T tmp;
+    std::memcpy(static_cast<void*>(&tmp), input + i * sizeof(T), sizeof(T));
+    output[i] = static_cast<double>(tmp);
+  }
+}
+
+template <typename T>
+void PutValue(T value, int offset, char* buffer) {
+  std::memcpy(buffer + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T GetValue(int offset, const char* buffer) {
+  T value;
+  std::memcpy(&value, buffer + offset, sizeof(T));
+  return value;
+}
+
+int CalculateFrameSize(const sptk::FeatureContainerHeader& header) {
+  const int data_size(GetDataSize(header.data_type));
+  if (data_size <= 0 || header.vector_length <= 0 ||
+      INT_MAX / data_size < header.vector_length) {
+    return 0;
+  }
+  return data_size * header.vector_length;
+}
+
+bool ParseHeader(const char* buffer, sptk::FeatureContainerHeader* header,
+                 int* frame_size) {
+  if (0 != std::memcmp(buffer, kHeaderMagic, kMagicSize) ||
+      kFormatVersion != GetValue<int32_t>(kVersionOffset, buffer)) {
+    return false;
+  }
+  header->data_type = std::string(1, buffer[kDataTypeOffset]);
+  header->vector_length = GetValue<int32_t>(kVectorLengthOffset, buffer);
+  header->frame_period = GetValue<double>(kFramePeriodOffset, buffer);
+  header->sampling_rate = GetValue<double>(kSamplingRateOffset, buffer);
+  *frame_size = CalculateFrameSize(*header);
+  return 0 < *frame_size;
+}
+
+// Parse the footer of a container whose size except the header is
+// @p body_size. The sizes are compared by division so as not to overflow.
+bool ParseFooter(const char* footer, int64_t body_size, int frame_size,
+                 int64_t* num_frame, int64_t* num_chunk) {
+  if (body_size < kFooterSize ||
+      0 != std::memcmp(footer + 16, kIndexMagic, kMagicSize)) {
+    return false;
+  }
+  *num_frame = GetValue<int64_t>(0, footer);
+  *num_chunk = GetValue<int64_t>(8, footer);
+  if (*num_frame < 0 || *num_chunk < 0 || INT_MAX < *num_chunk ||
+      (body_size - kFooterSize) / kChunkSize < *num_chunk) {
+    return false;
+  }
+  const int64_t frames_size(body_size - kFooterSize - *num_chunk * kChunkSize);
+  return 0 == frames_size % frame_size &&
+         *num_frame == frames_size / frame_size;
+}
+
+// Stream buffer attached by PrepareFeatureInputStream. A broken input ends the
+// stream as the end of input does, and is told apart by the error kept here.
+class InputStreamBuffer : public std::streambuf {
+ public:
+  InputStreamBuffer() {
+  }
+
+  virtual ~InputStreamBuffer() {
+  }
+
+  const std::string& GetErrorMessage() const {
+    return error_message_;
+  }
+
+ protected:
+  int_type Fail(const std::string& error_message) {
+    error_message_ = error_message;
+    setg(NULL, NULL, NULL);
+    return traits_type::eof();
+  }
+
+ private:
+  std::string error_message_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputStreamBuffer);
+};
+
+// Stream buffer passing only the frames of a feature container read from
+// another stream buffer. A seekable source is limited to the frames by the
+// footer; a pipe is read ahead so that the chunk index is not passed.
+class FrameStreamBuffer : public InputStreamBuffer {
+ public:
+  FrameStreamBuffer(std::streambuf* source, int frame_size,
+                    std::streamoff frames_begin, int64_t frames_size)
+      : source_(source),
+        frame_size_(frame_size),
+        is_seekable_(0 <= frames_begin),
+        frames_begin_(frames_begin),
+        frames_size_(frames_size),
+        position_(0),
+        is_end_of_source_(false) {
+  }
+
+  virtual ~FrameStreamBuffer() {
+  }
+
+ protected:
+  int_type underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    if (is_seekable_ ? !FillFromFile() : !FillFromPipe()) {
+      setg(NULL, NULL, NULL);
+      return traits_type::eof();
+    }
+    return traits_type::to_int_type(*gptr());
+  }
+
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction,
+                   std::ios_base::openmode which) {
+    if (!is_seekable_ || 0 == (which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+    const int64_t current_position(position_ - (egptr() - gptr()));
+    int64_t target;
+    if (std::ios_base::beg == direction) {
+      target = offset;
+    } else if (std::ios_base::cur == direction) {
+      if (0 == offset) return pos_type(current_position);
+      target = current_position + offset;
+    } else {
+      target = frames_size_ + offset;
+    }
+    if (target < 0 || frames_size_ < target ||
+        source_->pubseekpos(frames_begin_ + target, std::ios_base::in) < 0) {
+      return pos_type(off_type(-1));
+    }
+    setg(NULL, NULL, NULL);
+    position_ = target;
+    return pos_type(target);
+  }
+
+  pos_type seekpos(pos_type position, std::ios_base::openmode which) {
+    return seekoff(off_type(position), std::ios_base::beg, which);
+  }
+
+ private:
+  bool FillFromFile() {
+    const int64_t size(std::min<int64_t>(kReadSize, frames_size_ - position_));
+    if (size <= 0) {
+      return false;
+    }
+    buffer_.resize(kReadSize);
+    const std::streamsize gcount(source_->sgetn(&(buffer_[0]), size));
+    if (gcount <= 0) {
+      return false;
+    }
+    setg(&(buffer_[0]), &(buffer_[0]), &(buffer_[0]) + gcount);
+    position_ += gcount;
+    return true;
+  }
+
+  // Bytes after the ones already passed stay at the front of the buffer.
+  bool FillFromPipe() {
+    if (is_end_of_source_) {
+      return false;
+    }
+    const std::size_t num_passed(egptr() - eback());
+    const std::size_t num_held(buffer_.size() - num_passed);
+    if (0 < num_passed) {
+      std::memmove(&(buffer_[0]), &(buffer_[0]) + num_passed, num_held);
+    }
+    buffer_.resize(num_held);
+
+    while (buffer_.size() < static_cast<std::size_t>(2 * kLookaheadSize)) {
+      const std::size_t size(buffer_.size());
+      buffer_.resize(size + kReadSize);
+      const std::streamsize gcount(
+          source_->sgetn(&(buffer_[0]) + size, kReadSize));
+      buffer_.resize(size + (0 < gcount ? gcount : 0));
+      if (gcount <= 0) {
+        is_end_of_source_ = true;
+        break;
+      }
+    }
+
+    std::size_t num_passing;
+    if (is_end_of_source_) {
+      // The chunk index must not have been passed as frames.
+      int64_t num_frame, num_chunk;
+      if (buffer_.size() < static_cast<std::size_t>(kFooterSize) ||
+          !ParseFooter(&(buffer_[0]) + buffer_.size() - kFooterSize,
+                       position_ + buffer_.size(), frame_size_, &num_frame,
+                       &num_chunk) ||
+          num_frame * frame_size_ < position_) {
+        Fail("Broken feature container");
+        return false;
+      }
+      num_passing = static_cast<std::size_t>(num_frame * frame_size_ -
+                                             position_);
+    } else {
+      num_passing = buffer_.size() - kLookaheadSize;
+    }
+    if (0 == num_passing) {
+      return false;
+    }
+    setg(&(buffer_[0]), &(buffer_[0]), &(buffer_[0]) + num_passing);
+    position_ += num_passing;
+    return true;
+  }
+
+  std::streambuf* source_;
+  const int frame_size_;
+  const bool is_seekable_;
+  const std::streamoff frames_begin_;
+  const int64_t frames_size_;
+
+  // Position in the frames at the end of the get area.
+  int64_t position_;
+  bool is_end_of_source_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(FrameStreamBuffer);
+};
+
+// Indices of the slots of std::ios_base which hold the size of one element of
+// the input and the stream buffer attached by PrepareFeatureInputStream.
+const int kElementSizeIndex(std::ios_base::xalloc());
+const int kStreamBufferIndex(std::ios_base::xalloc());
+
+// Stream buffer which first returns bytes already read from another stream
+// buffer and then passes the rest of it.
+class ProbedStreamBuffer : public InputStreamBuffer {
+ public:
+  ProbedStreamBuffer(std::streambuf* source, const char* probed_bytes,
+                     int num_probed_byte)
+      : source_(source),
+        buffer_(probed_bytes, probed_bytes + num_probed_byte) {
+    char* begin(buffer_.empty() ? NULL : &(buffer_[0]));
+    setg(begin, begin, begin + buffer_.size());
+  }
+
+  virtual ~ProbedStreamBuffer() {
+  }
+
+ protected:
+  int_type underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    buffer_.resize(kReadSize);
+    const std::streamsize gcount(source_->sgetn(&(buffer_[0]), kReadSize));
+    if (gcount <= 0) {
+      setg(NULL, NULL, NULL);
+      return traits_type::eof();
+    }
+    setg(&(buffer_[0]), &(buffer_[0]), &(buffer_[0]) + gcount);
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  std::streambuf* source_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(ProbedStreamBuffer);
+};
+
+// Stream buffer passing the frames decoded from a stream encoded by
+// sptk::LosslessFeatureEncoding.
+class DecodedStreamBuffer : public InputStreamBuffer {
+ public:
+  // @p owned_source is deleted with this object if it is not NULL.
+  DecodedStreamBuffer(std::streambuf* source, std::streambuf* owned_source)
+      : owned_source_(owned_source),
+        input_stream_(source),
+        decoding_(&input_stream_) {
+  }
+
+  virtual ~DecodedStreamBuffer() {
+  }
+
+  int GetElementSize() const {
+    return decoding_.IsValid() ? GetDataSize(decoding_.GetDataType()) : 0;
+  }
+
+ protected:
+  int_type underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    setg(NULL, NULL, NULL);
+    if (!GetErrorMessage().empty()) {
+      return traits_type::eof();
+    }
+    int num_frame;
+    if (!decoding_.Run(&input_stream_, &frames_, &num_frame, &buffer_)) {
+      // Only the end of stream at a chunk boundary is a normal end.
+      if (!decoding_.IsValid() || !input_stream_.eof() ||
+          0 != input_stream_.gcount()) {
+        return Fail("Broken encoded stream");
+      }
+      return traits_type::eof();
+    }
+    char* begin(&(frames_[0]));
+    setg(begin, begin,
+         begin + static_cast<std::size_t>(num_frame) * decoding_.GetFrameSize());
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  std::unique_ptr<std::streambuf> owned_source_;
+  std::istream input_stream_;
+  const sptk::LosslessFeatureDecoding decoding_;
+  sptk::LosslessFeatureDecoding::Buffer buffer_;
+  std::vector<char> frames_;
+
+  DISALLOW_COPY_AND_ASSIGN(DecodedStreamBuffer);
+};
+
+void DeleteStreamBuffer(std::ios_base::event event,
+                        std::ios_base& stream,  // NOLINT
+                        int index) {
+  if (std::ios_base::erase_event == event) {
+    delete static_cast<InputStreamBuffer*>(stream.pword(index));
+    stream.pword(index) = NULL;
+  }
+}
+
+// Replace the stream buffer of @p input_stream by @p stream_buffer, which is
+// deleted together with the stream.
+void ReplaceStreamBuffer(InputStreamBuffer* stream_buffer,
+                         std::istream* input_stream) {
+  input_stream->pword(kStreamBufferIndex) = stream_buffer;
+  input_stream->register_callback(DeleteStreamBuffer, kStreamBufferIndex);
+  input_stream->rdbuf(stream_buffer);
+}
+
+// Return the size of one element if the stream is a container or an encoded
+// stream.
+int AttachStreamBuffer(std::istream* input_stream) {
+  typedef std::streambuf::traits_type traits_type;
+  std::streambuf* source(input_stream->rdbuf());
+  if (NULL == source ||
+      !traits_type::eq_int_type(source->sgetc(),
+                                traits_type::to_int_type(kHeaderMagic[0]))) {
+    return 0;
+  }
+
+  const std::streamoff begin(
+      source->pubseekoff(0, std::ios_base::cur, std::ios_base::in));
+  char buffer[kHeaderSize];
+  const std::streamsize gcount(source->sgetn(buffer, kHeaderSize));
+
+  if (sptk::lossless_feature_format::kMagicSize <= gcount &&
+      0 == std::memcmp(buffer, sptk::lossless_feature_format::kMagic,
+                       sptk::lossless_feature_format::kMagicSize)) {
+    ProbedStreamBuffer* probed(NULL);
+    if (0 <= begin) {
+      source->pubseekpos(begin, std::ios_base::in);
+    } else {
+      probed = new ProbedStreamBuffer(source, buffer, gcount);
+    }
+    DecodedStreamBuffer* decoded(
+        new DecodedStreamBuffer(NULL == probed ? source : probed, probed));
+    ReplaceStreamBuffer(decoded, input_stream);
+    return decoded->GetElementSize();
+  }
+
+  sptk::FeatureContainerHeader header;
+  int frame_size;
+  const bool is_container(kHeaderSize == gcount &&
+                          ParseHeader(buffer, &header, &frame_size));
+
+  if (0 <= begin) {
+    // Read the footer to know where the frames end.
+    char footer[kFooterSize];
+    std::streamoff end(-1);
+    int64_t num_frame, num_chunk;
+    if (is_container &&
+        0 <= (end = source->pubseekoff(-kFooterSize, std::ios_base::end,
+                                       std::ios_base::in)) &&
+        kFooterSize == source->sgetn(footer, kFooterSize) &&
+        ParseFooter(footer, end + kFooterSize - begin - kHeaderSize,
+                    frame_size, &num_frame, &num_chunk)) {
+      source->pubseekpos(begin + kHeaderSize, std::ios_base::in);
+      ReplaceStreamBuffer(new FrameStreamBuffer(source, frame_size,
+                                                begin + kHeaderSize,
+                                                num_frame * frame_size),
+                          input_stream);
+      return GetDataSize(header.data_type);
+    }
+    // Not a container or broken; read the stream as it is.
+    source->pubseekpos(begin, std::ios_base::in);
+    return 0;
+  }
+
+  if (is_container) {
+    ReplaceStreamBuffer(new FrameStreamBuffer(source, frame_size, -1, 0),
+                        input_stream);
+    return GetDataSize(header.data_type);
+  }
+  if (0 < gcount) {
+    ReplaceStreamBuffer(new ProbedStreamBuffer(source, buffer, gcount),
+                        input_stream);
+  }
+  return 0;
+}
+
+}  // namespace
+
+namespace sptk {
+
+FeatureContainerWriter::FeatureContainerWriter(
+    const FeatureContainerHeader& header, std::ostream* output_stream)
+    : header_(header),
+      output_stream_(output_stream),
+      frame_size_(CalculateFrameSize(header)),
+      is_valid_(true),
+      is_header_written_(false),
+      is_closed_(false),
+      num_frame_(0) {
+  if (NULL == output_stream_ || frame_size_ <= 0 ||
+      header_.vector_length <= 0 || header_.frame_period < 0.0 ||
+      header_.sampling_rate < 0.0) {
+    is_valid_ = false;
+    return;
+  }
+}
+
+bool FeatureContainerWriter::StartChunk() {
+  if (!is_valid_ || is_closed_) {
+    return false;
+  }
+
+  // Close the implicit first chunk if some frames are already written.
+  if (chunks_.empty() && 0 < num_frame_) {
+    FeatureContainerChunk chunk = {0, num_frame_};
+    chunks_.push_back(chunk);
+  }
+  FeatureContainerChunk chunk = {num_frame_, 0};
+  chunks_.push_back(chunk);
+
+  return true;
+}
+
+bool FeatureContainerWriter::Write(const char* frames, int num_frame) {
+  if (!is_valid_ || is_closed_ || NULL == frames || num_frame < 0) {
+    return false;
+  }
+
+  if (!is_header_written_ && !WriteHeader()) {
+    return false;
+  }
+
+  output_stream_->write(frames, static_cast<std::streamsize>(frame_size_) *
+                                    num_frame);
+  if (output_stream_->fail()) {
+    return false;
+  }
+
+  num_frame_ += num_frame;
+  if (!chunks_.empty()) {
+    chunks_.back().num_frame += num_frame;
+  }
+
+  return true;
+}
+
+bool FeatureContainerWriter::Close() {
+  if (!is_valid_ || is_closed_) {
+    return false;
+  }
+
+  if (!is_header_written_ && !WriteHeader()) {
+    return false;
+  }
+
+  if (chunks_.empty()) {
+    FeatureContainerChunk chunk = {0, num_frame_};
+    chunks_.push_back(chunk);
+  }
+
+  for (std::size_t i(0); i < chunks_.size(); ++i) {
+    char buffer[kChunkSize];
+    PutValue(chunks_[i].first_frame, 0, buffer);
+    PutValue(chunks_[i].num_frame, 8, buffer);
+    output_stream_->write(buffer, kChunkSize);
+  }
+
+  char footer[kFooterSize];
+  PutValue(num_frame_, 0, footer);
+  PutValue(static_cast<int64_t>(chunks_.size()), 8, footer);
+  std::memcpy(footer + 16, kIndexMagic, kMagicSize);
+  output_stream_->write(footer, kFooterSize);
+
+  is_closed_ = true;
+  return !output_stream_->fail();
+}
+
+bool FeatureContainerWriter::WriteHeader() {
+  char buffer[kHeaderSize];
+  std::memset(buffer, 0, kHeaderSize);
+  std::memcpy(buffer, kHeaderMagic, kMagicSize);
+  PutValue(kFormatVersion, kVersionOffset, buffer);
+  buffer[kDataTypeOffset] = header_.data_type[0];
+  PutValue(static_cast<int32_t>(header_.vector_length), kVectorLengthOffset,
+           buffer);
+  PutValue(header_.frame_period, kFramePeriodOffset, buffer);
+  PutValue(header_.sampling_rate, kSamplingRateOffset, buffer);
+
+  output_stream_->write(buffer, kHeaderSize);
+  is_header_written_ = true;
+
+  return !output_stream_->fail();
+}
+
+FeatureContainerReader::FeatureContainerReader(const std::string& file_name)
+    : frame_size_(0),
+      num_frame_(0),
+      mapped_memory_(MAP_FAILED),
+      mapped_size_(0),
+      frames_(NULL),
+      is_valid_(false) {
+  const int fd(open(file_name.c_str(), O_RDONLY));
+  if (fd < 0) {
+    return;
+  }
+
+  struct stat file_status;
+  if (0 != fstat(fd, &file_status) ||
+      file_status.st_size < kHeaderSize + kFooterSize) {
+    close(fd);
+    return;
+  }
+
+  mapped_size_ = file_status.st_size;
+  mapped_memory_ = mmap(NULL, static_cast<std::size_t>(mapped_size_),
+                        PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (MAP_FAILED == mapped_memory_) {
+    return;
+  }
+  const char* memory(static_cast<const char*>(mapped_memory_));
+
+  // Parse header.
+  if (!ParseHeader(memory, &header_, &frame_size_)) {
+    return;
+  }
+
+  // Parse footer and chunk index.
+  const char* footer(memory + mapped_size_ - kFooterSize);
+  int64_t num_chunk;
+  if (!ParseFooter(footer, mapped_size_ - kHeaderSize, frame_size_,
+                   &num_frame_, &num_chunk)) {
+    return;
+  }
+  const char* index(footer - num_chunk * kChunkSize);
+  chunks_.resize(static_cast<std::size_t>(num_chunk));
+  for (int64_t i(0); i < num_chunk; ++i) {
+    chunks_[i].first_frame = GetValue<int64_t>(0, index + i * kChunkSize);
+    chunks_[i].num_frame = GetValue<int64_t>(8, index + i * kChunkSize);
+    if (chunks_[i].first_frame < 0 || chunks_[i].num_frame < 0 ||
+        num_frame_ < chunks_[i].first_frame ||
+        num_frame_ - chunks_[i].first_frame < chunks_[i].num_frame) {
+      return;
+    }
+  }
+
+  frames_ = memory + kHeaderSize;
+  is_valid_ = true;
+}
+
+FeatureContainerReader::~FeatureContainerReader() {
+  if (MAP_FAILED != mapped_memory_) {
+    munmap(mapped_memory_, static_cast<std::size_t>(mapped_size_));
+  }
+}
+
+bool FeatureContainerReader::GetChunk(int chunk_index,
+                                      FeatureContainerChunk* chunk) const {
+  if (!is_valid_ || chunk_index < 0 || GetNumChunk() <= chunk_index ||
+      NULL == chunk) {
+    return false;
+  }
+  *chunk = chunks_[chunk_index];
+  return true;
+}
+
+const char* FeatureContainerReader::GetFrame(int64_t frame_index) const {
+  if (!is_valid_ || frame_index < 0 || num_frame_ <= frame_index) {
+    return NULL;
+  }
+  return frames_ + frame_index * frame_size_;
+}
+
+bool FeatureContainerReader::GetFrame(int64_t frame_index,
+                                      std::vector<double>* frame) const {
+  const char* input(GetFrame(frame_index));
+  if (NULL == input || NULL == frame) {
+    return false;
+  }
+
+  const int length(header_.vector_length);
+  if (frame->size() != static_cast<std::size_t>(length)) {
+    frame->resize(length);
+  }
+  double* output(&((*frame)[0]));
+
+  switch (header_.data_type[0]) {
+    case 'c': {
+      ConvertToDouble<int8_t>(input, length, output);
+      break;
+    }
+    case 'C': {
+      ConvertToDouble<uint8_t>(input, length, output);
+      break;
+    }
+    case 's': {
+      ConvertToDouble<int16_t>(input, length, output);
+      break;
+    }
+    case 'S': {
+      ConvertToDouble<uint16_t>(input, length, output);
+      break;
+    }
+    case 'h': {
+      ConvertToDouble<int24_t>(input, length, output);
+      break;
+    }
+    case 'H': {
+      ConvertToDouble<uint24_t>(input, length, output);
+      break;
+    }
+    case 'i': {
+      ConvertToDouble<int32_t>(input, length, output);
+      break;
+    }
+    case 'I': {
+      ConvertToDouble<uint32_t>(input, length, output);
+      break;
+    }
+    case 'l': {
+      ConvertToDouble<int64_t>(input, length, output);
+      break;
+    }
+    case 'L': {
+      ConvertToDouble<uint64_t>(input, length, output);
+      break;
+    }
+    case 'f': {
+      ConvertToDouble<float>(input, length, output);
+      break;
+    }
+    case 'd': {
+      ConvertToDouble<double>(input, length, output);
+      break;
+    }
+    case 'e': {
+      ConvertToDouble<long double>(input, length, output);
+      break;
+    }
+    default: {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+int PrepareFeatureInputStream(std::istream* input_stream) {
+  if (NULL == input_stream) {
+    return 0;
+  }
+  long& element_size(input_stream->iword(kElementSizeIndex));  // NOLINT
+  if (0 == element_size) {
+    const int size(AttachStreamBuffer(input_stream));
+    element_size = (0 < size) ? size : -1;
+  }
+  return (0 < element_size) ? static_cast<int>(element_size) : 0;
+}
+
+bool IsFeatureInputBroken(std::istream* input_stream,
+                          std::string* error_message) {
+  if (NULL == input_stream) {
+    return false;
+  }
+  const InputStreamBuffer* stream_buffer(static_cast<InputStreamBuffer*>(
+      input_stream->pword(kStreamBufferIndex)));
+  if (NULL == stream_buffer || stream_buffer->GetErrorMessage().empty()) {
+    return false;
+  }
+  if (NULL != error_message) {
+    *error_message = stream_buffer->GetErrorMessage();
+  }
+  return true;
+}
+
+bool IsFeatureContainer(const std::string& file_name) {
+  std::ifstream ifs(file_name.c_str(), std::ios::in | std::ios::binary);
+  if (ifs.fail()) {
+    return false;
+  }
+  char magic[kMagicSize];
+  ifs.read(magic, kMagicSize);
+  return kMagicSize == ifs.gcount() &&
+         0 == std::memcmp(magic, kHeaderMagic, kMagicSize);
+}
+
+}  // namespace sptk
@@ -0,0 +1,403 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/utils/pipeline.h"
+
+#include <algorithm>           // std::min
+#include <condition_variable>  // std::condition_variable
+#include <cstring>             // std::memcpy
+#include <mutex>               // std::mutex, std::unique_lock
+#include <sstream>             // std::istringstream
+#include <streambuf>           // std::streambuf
+#include <thread>              // std::thread
+#include <utility>             // std::move
+
+#include "SPTK/command/command_line_parser.h"
+#include "SPTK/command/data_transform_command.h"
+#include "SPTK/command/frame_command.h"
+#include "SPTK/command/mel_generalized_cepstral_analysis_command.h"
+#include "SPTK/command/window_command.h"
+
+namespace {
+
+const std::size_t kPipeCapacity(1 << 20);
+const std::size_t kStreamBufferSize(1 << 16);
+
+// Characters interpreted by the shell other than whitespace and '|': quotes,
+// expansions, redirections, command separators, grouping, globs, and comments.
+const char* const kShellCharacters("'\"`$\\<>;&()*?[~#\n");
+
+// Bounded byte queue between two commands running on different threads.
+class Pipe {
+ public:
+  explicit Pipe(std::size_t capacity)
+      : buffer_(capacity),
+        begin_(0),
+        size_(0),
+        is_writer_closed_(false),
+        is_reader_closed_(false) {
+  }
+
+  // Block until all data are queued. Return false if the reader is closed.
+  bool Write(const char* data, std::size_t size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (0 < size) {
+      writable_.wait(lock, [this] {
+        return is_reader_closed_ || size_ < buffer_.size();
+      });
+      if (is_reader_closed_) return false;
+      const std::size_t end((begin_ + size_) % buffer_.size());
+      const std::size_t copy_size(std::min(
+          size, std::min(buffer_.size() - size_, buffer_.size() - end)));
+      std::memcpy(&buffer_[end], data, copy_size);
+      size_ += copy_size;
+      data += copy_size;
+      size -= copy_size;
+      readable_.notify_one();
+    }
+    return true;
+  }
+
+  // Block until some data are queued. Return 0 at the end of data.
+  std::size_t Read(char* data, std::size_t size) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    readable_.wait(lock, [this] { return is_writer_closed_ || 0 < size_; });
+    const std::size_t copy_size(
+        std::min(size, std::min(size_, buffer_.size() - begin_)));
+    std::memcpy(data, &buffer_[begin_], copy_size);
+    begin_ = (begin_ + copy_size) % buffer_.size();
+    size_ -= copy_size;
+    writable_.notify_one();
+    return copy_size;
+  }
+
+  void CloseWriter() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_writer_closed_ = true;
+    readable_.notify_all();
+  }
+
+  void CloseReader() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_reader_closed_ = true;
+    writable_.notify_all();
+  }
+
+  bool IsReaderClosed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return is_reader_closed_;
+  }
+
+ private:
+  std::vector<char> buffer_;
+  std::size_t begin_;
+  std::size_t size_;
+  bool is_writer_closed_;
+  bool is_reader_closed_;
+
+  std::mutex mutex_;
+  std::condition_variable readable_;
+  std::condition_variable writable_;
+
+  DISALLOW_COPY_AND_ASSIGN(Pipe);
+};
+
+class PipeInputBuffer : public std::streambuf {
+ public:
+  explicit PipeInputBuffer(Pipe* pipe)
+      : pipe_(pipe), buffer_(kStreamBufferSize) {
+    setg(&buffer_[0], &buffer_[0], &buffer_[0]);
+  }
+
+ protected:
+  virtual int_type underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    const std::size_t size(pipe_->Read(&buffer_[0], buffer_.size()));
+    if (0 == size) {
+      return traits_type::eof();
+    }
+    setg(&buffer_[0], &buffer_[0], &buffer_[0] + size);
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  Pipe* pipe_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(PipeInputBuffer);
+};
+
+class PipeOutputBuffer : public std::streambuf {
+ public:
+  explicit PipeOutputBuffer(Pipe* pipe)
+      : pipe_(pipe), buffer_(kStreamBufferSize) {
+    setp(&buffer_[0], &buffer_[0] + buffer_.size());
+  }
+
+ protected:
+  virtual int_type overflow(int_type c) {
+    if (!Flush()) {
+      return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  virtual int sync() {
+    return Flush() ? 0 : -1;
+  }
+
+ private:
+  bool Flush() {
+    const std::size_t size(pptr() - pbase());
+    if (0 < size && !pipe_->Write(pbase(), size)) {
+      return false;
+    }
+    setp(&buffer_[0], &buffer_[0] + buffer_.size());
+    return true;
+  }
+
+  Pipe* pipe_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(PipeOutputBuffer);
+};
+
+// Run a command reading from @p input_pipe if given and writing to
+// @p output_pipe if given. The pipes are closed on return so that the
+// neighboring commands do not wait for this command forever.
+bool RunStage(const sptk::CommandInterface& command,
+              std::istream* input_stream, std::ostream* output_stream,
+              Pipe* input_pipe, Pipe* output_pipe,
+              std::string* error_message) {
+  std::unique_ptr<PipeInputBuffer> input_buffer;
+  std::unique_ptr<std::istream> pipe_input_stream;
+  if (NULL != input_pipe) {
+    input_buffer.reset(new PipeInputBuffer(input_pipe));
+    pipe_input_stream.reset(new std::istream(input_buffer.get()));
+    input_stream = pipe_input_stream.get();
+  }
+  std::unique_ptr<PipeOutputBuffer> output_buffer;
+  std::unique_ptr<std::ostream> pipe_output_stream;
+  if (NULL != output_pipe) {
+    output_buffer.reset(new PipeOutputBuffer(output_pipe));
+    pipe_output_stream.reset(new std::ostream(output_buffer.get()));
+    output_stream = pipe_output_stream.get();
+  }
+
+  bool is_succeeded(command.Run(input_stream, output_stream, error_message));
+  // A broken input has ended the command as the end of input does.
+  if (is_succeeded && sptk::GetInputError(input_stream, error_message)) {
+    is_succeeded = false;
+  }
+  if (is_succeeded && !output_stream->flush()) {
+    *error_message = "Failed to write data";
+    is_succeeded = false;
+  }
+  // In shell, the command would be silently killed by SIGPIPE.
+  if (!is_succeeded && NULL != output_pipe && output_pipe->IsReaderClosed()) {
+    is_succeeded = true;
+  }
+
+  if (NULL != output_pipe) output_pipe->CloseWriter();
+  if (NULL != input_pipe) input_pipe->CloseReader();
+  return is_succeeded;
+}
+
+sptk::CommandInterface* CreateCommand(const std::string& command_name) {
+  if ("x2x" == command_name) {
+    return new sptk::DataTransformCommand();
+  } else if ("frame" == command_name) {
+    return new sptk::FrameCommand();
+  } else if ("window" == command_name) {
+    return new sptk::WindowCommand();
+  } else if ("mgcep" == command_name) {
+    return new sptk::MelGeneralizedCepstralAnalysisCommand();
+  }
+  return NULL;
+}
+
+}  // namespace
+
+namespace sptk {
+
+Pipeline::Pipeline(const std::string& command_line)
+    : is_valid_(false), is_supported_(false) {
+  // Words are split only at whitespace, so anything else the shell would
+  // interpret is left to the shell.
+  if (std::string::npos != command_line.find_first_of(kShellCharacters)) {
+    error_message_ = "Shell syntax is not supported";
+    return;
+  }
+
+  std::istringstream command_stream(command_line);
+  std::string command;
+  while (std::getline(command_stream, command, '|')) {
+    std::istringstream argument_stream(command);
+    std::vector<std::string> arguments;
+    std::string argument;
+    while (argument_stream >> argument) {
+      arguments.push_back(argument);
+    }
+    if (arguments.empty()) {
+      error_message_ = "Empty command in pipeline";
+      return;
+    }
+
+    // Commands may be given with their directory.
+    std::string command_name(arguments[0]);
+    const std::string::size_type slash(command_name.rfind('/'));
+    if (std::string::npos != slash) {
+      command_name = command_name.substr(slash + 1);
+    }
+
+    // Anything the command itself would reject is left to the command.
+    std::unique_ptr<CommandInterface> stage(CreateCommand(command_name));
+    if (NULL == stage) {
+      error_message_ = command_name + ": Command is not supported";
+      return;
+    }
+    const CommandLineParser parser(stage->GetOptionString());
+    CommandLineParser::Options options;
+    std::vector<std::string> operands;
+    if (!parser.Parse(
+            std::vector<std::string>(arguments.begin() + 1, arguments.end()),
+            &options, &operands, &error_message_)) {
+      error_message_ = command_name + ": " + error_message_;
+      return;
+    }
+
+    // Values are checked by the command in the same way as in its main.
+    for (const std::pair<char, std::string>& option : options) {
+      if (!stage->SetOption(option.first, option.second, &error_message_)) {
+        error_message_ = command_name + ": " + error_message_;
+        is_supported_ = true;
+        return;
+      }
+    }
+    for (const std::string& operand : operands) {
+      bool is_consumed;
+      if (!stage->SetOperand(operand, &is_consumed, &error_message_)) {
+        error_message_ = command_name + ": " + error_message_;
+        is_supported_ = true;
+        return;
+      }
+      if (!is_consumed) {
+        error_message_ = command_name + ": Input files are not supported";
+        return;
+      }
+    }
+    if (!stage->Prepare(&error_message_)) {
+      error_message_ = command_name + ": " + error_message_;
+      is_supported_ = true;
+      return;
+    }
+
+    command_names_.push_back(command_name);
+    commands_.push_back(std::move(stage));
+  }
+
+  if (commands_.empty()) {
+    error_message_ = "Empty pipeline";
+    return;
+  }
+
+  is_valid_ = true;
+  is_supported_ = true;
+}
+
+bool Pipeline::Run(std::istream* input_stream, std::ostream* output_stream,
+                   std::string* error_message) const {
+  if (!is_valid_ || NULL == input_stream || NULL == output_stream ||
+      NULL == error_message) {
+    return false;
+  }
+
+  const std::size_t num_command(commands_.size());
+  std::vector<std::unique_ptr<Pipe> > pipes;
+  for (std::size_t i(1); i < num_command; ++i) {
+    pipes.emplace_back(new Pipe(kPipeCapacity));
+  }
+
+  // Run each command but the last one on its own thread.
+  std::vector<int> results(num_command, 0);
+  std::vector<std::string> error_messages(num_command);
+  std::vector<std::thread> threads;
+  for (std::size_t i(0); i < num_command; ++i) {
+    Pipe* input_pipe(0 == i ? NULL : pipes[i - 1].get());
+    Pipe* output_pipe(i + 1 == num_command ? NULL : pipes[i].get());
+    const CommandInterface* command(commands_[i].get());
+    int* result(&results[i]);
+    std::string* message(&error_messages[i]);
+    auto run = [=]() {
+      *result = RunStage(*command, input_stream, output_stream, input_pipe,
+                         output_pipe, message);
+    };
+    if (i + 1 < num_command) {
+      threads.emplace_back(run);
+    } else {
+      run();
+    }
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // The first failure is the cause of the others.
+  for (std::size_t i(0); i < num_command; ++i) {
+    if (!results[i]) {
+      *error_message = command_names_[i] + ": " + error_messages[i];
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace sptk
@@ -0,0 +1,753 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/utils/pipeline_daemon.h"
+
+#include <fcntl.h>       // fcntl, F_GET_SEALS, F_SEAL_SHRINK
+#include <poll.h>        // poll
+#include <pthread.h>     // pthread_sigmask
+#include <signal.h>      // sigaddset, sigemptyset, sigwait, etc.
+#include <sys/mman.h>    // mmap, munmap
+#include <sys/socket.h>  // accept, bind, connect, listen, setsockopt, etc.
+#include <sys/stat.h>    // fstat, umask
+#include <sys/time.h>    // timeval
+#include <sys/un.h>      // sockaddr_un
+#include <unistd.h>      // close, getuid, pipe, read, unlink, write
+
+#include <algorithm>  // std::max
+#include <cerrno>     // errno
+#include <cstdint>    // uint32_t, uint64_t
+#include <cstdlib>  // std::getenv
+#include <cstring>  // std::memcpy, std::memset, std::strerror
+#include <sstream>  // std::ostringstream
+#include <thread>   // std::thread
+#include <vector>   // std::vector
+
+namespace {
+
+const char kMagic[4] = {'S', 'P', 'T', 'K'};
+const uint32_t kProtocolVersion(2);
+const uint32_t kMaxCommandLineLength(65536);
+const std::size_t kChunkSize(65536);
+const uint64_t kMaxChunkSize(1 << 20);
+const std::size_t kMaxNumCachedPipeline(64);
+const int kConnectionTimeoutInSeconds(60);
+const int kMinDefaultNumWorker(4);
+
+struct RequestHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t is_shared_memory_used;
+  uint32_t command_line_length;
+  uint64_t input_size;
+};
+
+struct ResponseHeader {
+  uint32_t status;
+  uint32_t message_length;
+};
+
+// Input sent through the socket and output are split into chunks, each of
+// which is preceded by its size. A chunk of size 0 marks the end of data.
+typedef uint64_t ChunkHeader;
+
+bool ReadAll(int fd, void* buffer, std::size_t size) {
+  char* p(static_cast<char*>(buffer));
+  while (0 < size) {
+    const ssize_t read_size(read(fd, p, size));
+    if (read_size < 0 && EINTR == errno) continue;
+    if (read_size <= 0) return false;
+    p += read_size;
+    size -= read_size;
+  }
+  return true;
+}
+
+bool WriteAll(int fd, const void* buffer, std::size_t size) {
+  const char* p(static_cast<const char*>(buffer));
+  while (0 < size) {
+    const ssize_t written_size(write(fd, p, size));
+    if (written_size < 0 && EINTR == errno) continue;
+    if (written_size <= 0) return false;
+    p += written_size;
+    size -= written_size;
+  }
+  return true;
+}
+
+// Same as WriteAll but for sockets, where SIGPIPE is not raised.
+bool SendAll(int fd, const void* buffer, std::size_t size) {
+  const char* p(static_cast<const char*>(buffer));
+  while (0 < size) {
+    const ssize_t sent_size(send(fd, p, size, MSG_NOSIGNAL));
+    if (sent_size < 0 && EINTR == errno) continue;
+    if (sent_size <= 0) return false;
+    p += sent_size;
+    size -= sent_size;
+  }
+  return true;
+}
+
+bool MakeSocketAddress(const std::string& socket_path,
+                       struct sockaddr_un* address) {
+  std::memset(address, 0, sizeof(*address));
+  address->sun_family = AF_UNIX;
+  if (sizeof(address->sun_path) <= socket_path.size()) return false;
+  std::memcpy(address->sun_path, socket_path.c_str(), socket_path.size() + 1);
+  return true;
+}
+
+int Connect(const std::string& socket_path) {
+  struct sockaddr_un address;
+  if (!MakeSocketAddress(socket_path, &address)) return -1;
+  const int fd(socket(AF_UNIX, SOCK_STREAM, 0));
+  if (fd < 0) return -1;
+  if (connect(fd, reinterpret_cast<struct sockaddr*>(&address),
+              sizeof(address)) < 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+bool SendResponse(int fd, sptk::PipelineDaemon::Status status,
+                  const std::string& message) {
+  ResponseHeader header;
+  header.status = status;
+  header.message_length = static_cast<uint32_t>(message.size());
+  return SendAll(fd, &header, sizeof(header)) &&
+         SendAll(fd, message.data(), message.size());
+}
+
+bool ReceiveResponse(int fd, sptk::PipelineDaemon::Status* status,
+                     std::string* message) {
+  ResponseHeader header;
+  if (!ReadAll(fd, &header, sizeof(header)) ||
+      sptk::PipelineDaemon::kNumStatuses <= header.status ||
+      kMaxCommandLineLength < header.message_length) {
+    return false;
+  }
+  *status = static_cast<sptk::PipelineDaemon::Status>(header.status);
+  message->resize(header.message_length);
+  return ReadAll(fd, &(*message)[0], message->size());
+}
+
+bool SendChunk(int fd, const char* data, std::size_t size) {
+  const ChunkHeader header(size);
+  return SendAll(fd, &header, sizeof(header)) && SendAll(fd, data, size);
+}
+
+// Check that the size of shared memory is at least @p size and cannot be
+// reduced by the client while it is mapped, which would raise SIGBUS.
+bool IsSafeToMap(int fd, uint64_t size) {
+#if defined(F_GET_SEALS) && defined(F_SEAL_SHRINK)
+  const int seals(fcntl(fd, F_GET_SEALS));
+  if (seals < 0 || 0 == (seals & F_SEAL_SHRINK)) return false;
+  struct stat status;
+  return 0 == fstat(fd, &status) &&
+         size <= static_cast<uint64_t>(status.st_size);
+#else
+  return false;
+#endif
+}
+
+// Read-only stream buffer over memory.
+class MemoryBuffer : public std::streambuf {
+ public:
+  MemoryBuffer(const char* data, std::size_t size) {
+    char* begin(const_cast<char*>(data));
+    setg(begin, begin, begin + size);
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(MemoryBuffer);
+};
+
+// Stream buffer reading chunks from a socket.
+class SocketInputBuffer : public std::streambuf {
+ public:
+  explicit SocketInputBuffer(int fd)
+      : fd_(fd),
+        rest_(0),
+        is_end_(false),
+        is_broken_(false),
+        buffer_(kChunkSize) {
+    setg(&buffer_[0], &buffer_[0], &buffer_[0]);
+  }
+
+  // Return true if the input has ended without its end mark, e.g., by timeout.
+  bool IsBroken() const {
+    return is_broken_;
+  }
+
+ protected:
+  virtual int_type underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    if (0 == rest_ && !is_end_) {
+      ChunkHeader size;
+      if (!ReadAll(fd_, &size, sizeof(size)) || kMaxChunkSize < size) {
+        is_end_ = true;
+        is_broken_ = true;
+      } else if (0 == size) {
+        is_end_ = true;
+      } else {
+        rest_ = size;
+      }
+    }
+    if (is_end_) {
+      return traits_type::eof();
+    }
+    const std::size_t size(rest_ < buffer_.size() ? rest_ : buffer_.size());
+    if (!ReadAll(fd_, &buffer_[0], size)) {
+      is_end_ = true;
+      is_broken_ = true;
+      return traits_type::eof();
+    }
+    rest_ -= size;
+    setg(&buffer_[0], &buffer_[0], &buffer_[0] + size);
+    return traits_type::to_int_type(*gptr());
+  }
+
+ private:
+  const int fd_;
+  uint64_t rest_;
+  bool is_end_;
+  bool is_broken_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(SocketInputBuffer);
+};
+
+// Stream buffer writing chunks to a socket.
+class SocketOutputBuffer : public std::streambuf {
+ public:
+  explicit SocketOutputBuffer(int fd) : fd_(fd), buffer_(kChunkSize) {
+    setp(&buffer_[0], &buffer_[0] + buffer_.size());
+  }
+
+ protected:
+  virtual int_type overflow(int_type c) {
+    if (!Flush()) {
+      return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  virtual int sync() {
+    return Flush() ? 0 : -1;
+  }
+
+ private:
+  bool Flush() {
+    const std::size_t size(pptr() - pbase());
+    if (0 < size && !SendChunk(fd_, pbase(), size)) {
+      return false;
+    }
+    setp(&buffer_[0], &buffer_[0] + buffer_.size());
+    return true;
+  }
+
+  const int fd_;
+  std::vector<char> buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(SocketOutputBuffer);
+};
+
+// Send the input of a client as chunks until its end or Stop() is called.
+class InputSender {
+ public:
+  InputSender(int input_fd, int socket_fd) : is_started_(false) {
+    wake_fds_[0] = wake_fds_[1] = -1;
+    if (pipe(wake_fds_) < 0) return;
+    thread_ = std::thread(&InputSender::Run, this, input_fd, socket_fd);
+    is_started_ = true;
+  }
+
+  ~InputSender() {
+    Stop();
+    if (0 <= wake_fds_[0]) close(wake_fds_[0]);
+    if (0 <= wake_fds_[1]) close(wake_fds_[1]);
+  }
+
+  bool IsStarted() const {
+    return is_started_;
+  }
+
+  void Stop() {
+    if (!is_started_) return;
+    const char c(0);
+    WriteAll(wake_fds_[1], &c, sizeof(c));
+    thread_.join();
+    is_started_ = false;
+  }
+
+ private:
+  void Run(int input_fd, int socket_fd) {
+    std::vector<char> buffer(kChunkSize);
+    for (;;) {
+      // Wait for input without blocking Stop().
+      struct pollfd fds[2];
+      fds[0].fd = input_fd;
+      fds[0].events = POLLIN;
+      fds[1].fd = wake_fds_[0];
+      fds[1].events = POLLIN;
+      if (poll(fds, 2, -1) < 0) {
+        if (EINTR == errno) continue;
+        return;
+      }
+      if (0 != fds[1].revents) return;
+
+      const ssize_t read_size(read(input_fd, &buffer[0], buffer.size()));
+      if (read_size < 0 && (EINTR == errno || EAGAIN == errno)) continue;
+      if (read_size <= 0) {
+        SendChunk(socket_fd, NULL, 0);
+        return;
+      }
+      if (!SendChunk(socket_fd, &buffer[0], read_size)) return;
+    }
+  }
+
+  int wake_fds_[2];
+  bool is_started_;
+  std::thread thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputSender);
+};
+
+}  // namespace
+
+namespace sptk {
+
+PipelineDaemon::PipelineDaemon(const std::string& socket_path, int num_worker)
+    : socket_path_(socket_path),
+      num_worker_(num_worker < 1 ? 1 : num_worker),
+      is_stopping_(false) {
+}
+
+bool PipelineDaemon::Run(std::string* error_message) {
+  if (NULL == error_message) {
+    return false;
+  }
+
+  struct sockaddr_un address;
+  if (!MakeSocketAddress(socket_path_, &address)) {
+    *error_message = "Too long socket path " + socket_path_;
+    return false;
+  }
+
+  // Remove the socket left by a daemon which has exited abnormally.
+  {
+    const int fd(Connect(socket_path_));
+    if (0 <= fd) {
+      close(fd);
+      *error_message = "Another daemon is running on " + socket_path_;
+      return false;
+    }
+    unlink(socket_path_.c_str());
+  }
+
+  const int listen_fd(socket(AF_UNIX, SOCK_STREAM, 0));
+  if (listen_fd < 0) {
+    *error_message = std::string("Failed to create socket: ") +
+                     std::strerror(errno);
+    return false;
+  }
+  // Only the user can connect to the socket.
+  const mode_t mask(umask(0077));
+  const int bind_result(bind(listen_fd,
+                             reinterpret_cast<struct sockaddr*>(&address),
+                             sizeof(address)));
+  umask(mask);
+  if (bind_result < 0 || listen(listen_fd, SOMAXCONN) < 0) {
+    *error_message = "Failed to listen on " + socket_path_ + ": " +
+                     std::strerror(errno);
+    close(listen_fd);
+    return false;
+  }
+
+  // Signals are received only by sigwait below.
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, NULL);
+  signal(SIGPIPE, SIG_IGN);
+
+  is_stopping_ = false;
+  std::vector<std::thread> workers;
+  for (int i(0); i < num_worker_; ++i) {
+    workers.emplace_back(&PipelineDaemon::RunWorker, this, listen_fd);
+  }
+
+  int received_signal;
+  sigwait(&signals, &received_signal);
+
+  // Cut off the requests being served, whose clients may never end their
+  // input, and wake up the workers waiting for connections.
+  is_stopping_ = true;
+  {
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    for (int fd : connection_fds_) {
+      shutdown(fd, SHUT_RDWR);
+    }
+  }
+  for (int i(0); i < num_worker_; ++i) {
+    const int fd(Connect(socket_path_));
+    if (0 <= fd) close(fd);
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  close(listen_fd);
+  unlink(socket_path_.c_str());
+
+  return true;
+}
+
+void PipelineDaemon::RunWorker(int listen_fd) {
+  while (!is_stopping_) {
+    const int connection_fd(accept(listen_fd, NULL, NULL));
+    if (connection_fd < 0) {
+      if (EINTR == errno || ECONNABORTED == errno) continue;
+      return;
+    }
+    if (AddConnection(connection_fd)) {
+      HandleConnection(connection_fd);
+      RemoveConnection(connection_fd);
+    }
+    close(connection_fd);
+  }
+}
+
+bool PipelineDaemon::AddConnection(int connection_fd) {
+  // A client which stops sending or receiving must not hold the worker.
+  struct timeval timeout;
+  timeout.tv_sec = kConnectionTimeoutInSeconds;
+  timeout.tv_usec = 0;
+  if (setsockopt(connection_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+                 sizeof(timeout)) < 0 ||
+      setsockopt(connection_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout,
+                 sizeof(timeout)) < 0) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(connection_mutex_);
+  if (is_stopping_) {
+    return false;
+  }
+  connection_fds_.insert(connection_fd);
+  return true;
+}
+
+void PipelineDaemon::RemoveConnection(int connection_fd) {
+  std::lock_guard<std::mutex> lock(connection_mutex_);
+  connection_fds_.erase(connection_fd);
+}
+
+void PipelineDaemon::HandleConnection(int connection_fd) {
+  // Receive header with file descriptor of input if any.
+  RequestHeader header;
+  int input_fd(-1);
+  {
+    struct iovec iov;
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+    union {
+      struct cmsghdr header;
+      char buffer[CMSG_SPACE(sizeof(int))];
+    } control;
+    struct msghdr message;
+    std::memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+    ssize_t received_size;
+    do {
+      received_size = recvmsg(connection_fd, &message, MSG_WAITALL);
+    } while (received_size < 0 && EINTR == errno);
+    for (struct cmsghdr* c(CMSG_FIRSTHDR(&message)); NULL != c;
+         c = CMSG_NXTHDR(&message, c)) {
+      if (SOL_SOCKET == c->cmsg_level && SCM_RIGHTS == c->cmsg_type) {
+        std::memcpy(&input_fd, CMSG_DATA(c), sizeof(input_fd));
+      }
+    }
+    if (sizeof(header) != static_cast<std::size_t>(received_size) ||
+        0 != std::memcmp(header.magic, kMagic, sizeof(kMagic)) ||
+        kProtocolVersion != header.version ||
+        kMaxCommandLineLength < header.command_line_length ||
+        (header.is_shared_memory_used && input_fd < 0)) {
+      if (0 <= input_fd) close(input_fd);
+      SendResponse(connection_fd, kFailure, "Invalid request");
+      return;
+    }
+  }
+
+  std::string command_line(header.command_line_length, '\0');
+  if (!ReadAll(connection_fd, &command_line[0], command_line.size())) {
+    if (0 <= input_fd) close(input_fd);
+    return;
+  }
+
+  std::shared_ptr<const Pipeline> pipeline(GetPipeline(command_line));
+  if (!pipeline->IsValid()) {
+    if (0 <= input_fd) close(input_fd);
+    SendResponse(connection_fd,
+                 pipeline->IsSupported() ? kFailure : kUnsupported,
+                 pipeline->GetErrorMessage());
+    return;
+  }
+
+  // Map shared memory instead of copying it.
+  void* mapped_input(MAP_FAILED);
+  if (header.is_shared_memory_used) {
+    if (!IsSafeToMap(input_fd, header.input_size)) {
+      close(input_fd);
+      SendResponse(connection_fd, kFailure,
+                   "Shared memory is not sealed or smaller than input");
+      return;
+    }
+    if (0 < header.input_size) {
+      mapped_input = mmap(NULL, header.input_size, PROT_READ, MAP_SHARED,
+                          input_fd, 0);
+      if (MAP_FAILED == mapped_input) {
+        close(input_fd);
+        SendResponse(connection_fd, kFailure, "Failed to map input");
+        return;
+      }
+    }
+    close(input_fd);
+  }
+
+  // Tell the client to start sending input and receiving output.
+  if (!SendResponse(connection_fd, kSuccess, "")) {
+    if (MAP_FAILED != mapped_input) munmap(mapped_input, header.input_size);
+    return;
+  }
+
+  std::unique_ptr<std::streambuf> input_buffer;
+  SocketInputBuffer* socket_input_buffer(NULL);
+  if (header.is_shared_memory_used) {
+    if (MAP_FAILED == mapped_input) {
+      input_buffer.reset(new MemoryBuffer(NULL, 0));
+    } else {
+      input_buffer.reset(new MemoryBuffer(
+          static_cast<const char*>(mapped_input), header.input_size));
+    }
+  } else {
+    socket_input_buffer = new SocketInputBuffer(connection_fd);
+    input_buffer.reset(socket_input_buffer);
+  }
+  std::istream input_stream(input_buffer.get());
+  SocketOutputBuffer output_buffer(connection_fd);
+  std::ostream output_stream(&output_buffer);
+  std::string error_message;
+  bool is_succeeded(
+      pipeline->Run(&input_stream, &output_stream, &error_message));
+  if (is_succeeded && NULL != socket_input_buffer &&
+      socket_input_buffer->IsBroken()) {
+    error_message = "Failed to receive input";
+    is_succeeded = false;
+  }
+  if (MAP_FAILED != mapped_input) {
+    munmap(mapped_input, header.input_size);
+  }
+
+  if (SendChunk(connection_fd, NULL, 0)) {
+    SendResponse(connection_fd, is_succeeded ? kSuccess : kFailure,
+                 error_message);
+  }
+}
+
+std::shared_ptr<const Pipeline> PipelineDaemon::GetPipeline(
+    const std::string& command_line) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, std::shared_ptr<const Pipeline> >::const_iterator
+        itr(pipelines_.find(command_line));
+    if (pipelines_.end() != itr) {
+      return itr->second;
+    }
+  }
+
+  // Create outside the lock not to block other requests.
+  std::shared_ptr<const Pipeline> pipeline(new Pipeline(command_line));
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (kMaxNumCachedPipeline <= pipelines_.size()) {
+    pipelines_.clear();
+  }
+  pipelines_[command_line] = pipeline;
+  return pipeline;
+}
+
+int PipelineDaemon::GetDefaultNumWorker() {
+  return std::max(kMinDefaultNumWorker,
+                  static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+std::string PipelineDaemon::GetDefaultSocketPath() {
+  const char* socket_path(std::getenv("SPTK_DAEMON_SOCKET"));
+  if (NULL != socket_path && '\0' != socket_path[0]) {
+    return socket_path;
+  }
+  std::ostringstream default_socket_path;
+  default_socket_path << "/tmp/sptkd-" << getuid() << ".sock";
+  return default_socket_path.str();
+}
+
+PipelineDaemon::Status PipelineDaemon::Request(
+    const std::string& socket_path, const std::string& command_line,
+    int input_fd, off_t input_size, bool is_shared_memory_used, int output_fd,
+    std::string* message) {
+  if (input_fd < 0 || input_size < 0 || output_fd < 0 || NULL == message ||
+      kMaxCommandLineLength < command_line.size()) {
+    return kFailure;
+  }
+  message->clear();
+
+  const int fd(Connect(socket_path));
+  if (fd < 0) {
+    *message = "No daemon is running on " + socket_path;
+    return kUnsupported;
+  }
+
+  RequestHeader header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kProtocolVersion;
+  header.is_shared_memory_used = is_shared_memory_used;
+  header.command_line_length = static_cast<uint32_t>(command_line.size());
+  header.input_size = is_shared_memory_used ? input_size : 0;
+
+  // Send header with file descriptor of input.
+  bool is_sent;
+  {
+    struct iovec iov;
+    iov.iov_base = &header;
+    iov.iov_len = sizeof(header);
+    union {
+      struct cmsghdr header;
+      char buffer[CMSG_SPACE(sizeof(int))];
+    } control;
+    struct msghdr request;
+    std::memset(&request, 0, sizeof(request));
+    request.msg_iov = &iov;
+    request.msg_iovlen = 1;
+    if (is_shared_memory_used) {
+      std::memset(control.buffer, 0, sizeof(control.buffer));
+      request.msg_control = control.buffer;
+      request.msg_controllen = sizeof(control.buffer);
+      struct cmsghdr* c(CMSG_FIRSTHDR(&request));
+      c->cmsg_level = SOL_SOCKET;
+      c->cmsg_type = SCM_RIGHTS;
+      c->cmsg_len = CMSG_LEN(sizeof(int));
+      std::memcpy(CMSG_DATA(c), &input_fd, sizeof(input_fd));
+    }
+    ssize_t sent_size;
+    do {
+      sent_size = sendmsg(fd, &request, MSG_NOSIGNAL);
+    } while (sent_size < 0 && EINTR == errno);
+    is_sent = (sizeof(header) == static_cast<std::size_t>(sent_size)) &&
+              SendAll(fd, command_line.data(), command_line.size());
+  }
+
+  // Nothing of the input is read until the daemon accepts the pipeline, so
+  // that the caller can run it by itself otherwise.
+  Status status;
+  if (!is_sent || !ReceiveResponse(fd, &status, message)) {
+    close(fd);
+    *message = "Failed to communicate with daemon";
+    return kFailure;
+  }
+  if (kSuccess != status) {
+    close(fd);
+    return status;
+  }
+
+  // Send input while relaying output not to block the daemon.
+  std::unique_ptr<InputSender> input_sender;
+  if (!is_shared_memory_used) {
+    input_sender.reset(new InputSender(input_fd, fd));
+    if (!input_sender->IsStarted()) {
+      close(fd);
+      *message = "Failed to send input";
+      return kFailure;
+    }
+  }
+  std::vector<char> buffer(kChunkSize);
+  bool is_relayed(true);
+  for (;;) {
+    ChunkHeader size;
+    if (!ReadAll(fd, &size, sizeof(size)) || kMaxChunkSize < size) {
+      is_relayed = false;
+      break;
+    }
+    if (0 == size) break;
+    while (is_relayed && 0 < size) {
+      const std::size_t relay_size(size < buffer.size() ? size
+                                                        : buffer.size());
+      is_relayed = ReadAll(fd, &buffer[0], relay_size) &&
+                   WriteAll(output_fd, &buffer[0], relay_size);
+      size -= relay_size;
+    }
+    if (!is_relayed) break;
+  }
+  const bool is_received(is_relayed && ReceiveResponse(fd, &status, message));
+  input_sender.reset();
+  close(fd);
+  if (!is_received) {
+    *message = "Failed to receive output";
+    return kFailure;
+  }
+
+  return status;
+}
+
+}  // namespace sptk
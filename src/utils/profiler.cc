@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/utils/profiler.h"
+
+#include <unistd.h>  // getpid
+
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
+#include <cstdlib>   // std::atexit, std::getenv
+#include <cstring>   // std::strcmp, std::strlen, std::strncmp
+#include <fstream>   // std::ofstream
+#include <iostream>  // std::cerr
+#include <map>       // std::map
+#include <mutex>     // std::lock_guard, std::mutex
+#include <string>    // std::string
+#include <sstream>   // std::ostringstream
+
+namespace {
+
+void DumpAtExit();
+
+// The registry is never destroyed so that counters stay valid until the
+// statistics are written at exit.
+struct Registry {
+  Registry() : is_enabled(false), is_registered(false) {
+  }
+
+  void Enable(const std::string& output_file_name) {
+    is_enabled = true;
+    output_file = output_file_name;
+    if (!is_registered) {
+      std::atexit(DumpAtExit);
+      is_registered = true;
+    }
+  }
+
+  std::atomic<bool> is_enabled;
+  bool is_registered;
+  std::string output_file;
+  std::mutex mutex;
+  std::map<std::string, sptk::ProfileCounter*> counters;
+};
+
+Registry* CreateRegistry() {
+  Registry* registry(new Registry());
+  const char* value(std::getenv("SPTK_PROFILE"));
+  if (NULL != value && '\0' != value[0] && 0 != std::strcmp(value, "0")) {
+    const bool is_stderr(0 == std::strcmp(value, "1") ||
+                         0 == std::strcmp(value, "stderr"));
+    registry->Enable(is_stderr ? "" : value);
+  }
+  return registry;
+}
+
+Registry* GetRegistry() {
+  static Registry* registry(CreateRegistry());
+  return registry;
+}
+
+void DumpAtExit() {
+  // Build the whole line first so that one write appends it.
+  std::ostringstream oss;
+  sptk::Profiler::Dump(&oss);
+  Registry* registry(GetRegistry());
+  if (registry->output_file.empty()) {
+    std::cerr << oss.str() << std::flush;
+  } else {
+    std::ofstream ofs(registry->output_file.c_str(), std::ios::app);
+    ofs << oss.str() << std::flush;
+  }
+}
+
+}  // namespace
+
+namespace sptk {
+
+bool Profiler::IsEnabled() {
+  return GetRegistry()->is_enabled;
+}
+
+void Profiler::ParseCommandLine(int* argc, char* argv[]) {
+  if (NULL == argc || NULL == argv) {
+    return;
+  }
+
+  const char* kOption("--profile");
+  const std::size_t option_length(std::strlen(kOption));
+  int num_argument(1);
+  for (int i(1); i < *argc; ++i) {
+    // Options after "--" are left as they are.
+    if (0 == std::strcmp(argv[i], "--")) {
+      for (; i < *argc; ++i) {
+        argv[num_argument++] = argv[i];
+      }
+      break;
+    }
+    if (0 == std::strncmp(argv[i], kOption, option_length) &&
+        ('\0' == argv[i][option_length] || '=' == argv[i][option_length])) {
+      const char* file_name('=' == argv[i][option_length]
+                                ? argv[i] + option_length + 1
+                                : "");
+      Registry* registry(GetRegistry());
+      std::lock_guard<std::mutex> lock(registry->mutex);
+      registry->Enable(file_name);
+    } else {
+      argv[num_argument++] = argv[i];
+    }
+  }
+  if (num_argument < *argc) {
+    argv[num_argument] = NULL;
+  }
+  *argc = num_argument;
+}
+
+ProfileCounter* Profiler::GetCounter(const char* name) {
+  Registry* registry(GetRegistry());
+  if (!registry->is_enabled || NULL == name) {
+    return NULL;
+  }
+
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  ProfileCounter*& counter(registry->counters[name]);
+  if (NULL == counter) {
+    counter = new ProfileCounter(name);
+  }
+  return counter;
+}
+
+ProfileCounter* Profiler::GetCounter(const char* name,
+                                     std::atomic<ProfileCounter*>* cache) {
+  if (NULL == cache) {
+    return GetCounter(name);
+  }
+  if (!GetRegistry()->is_enabled) {
+    return NULL;
+  }
+
+  ProfileCounter* counter(cache->load(std::memory_order_acquire));
+  if (NULL == counter) {
+    counter = GetCounter(name);
+    cache->store(counter, std::memory_order_release);
+  }
+  return counter;
+}
+
+void Profiler::Dump(std::ostream* output_stream) {
+  if (NULL == output_stream) {
+    return;
+  }
+
+  Registry* registry(GetRegistry());
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  *output_stream << "{\"pid\": " << getpid() << ", \"profile\": [";
+  bool is_first(true);
+  for (std::map<std::string, ProfileCounter*>::const_iterator itr(
+           registry->counters.begin());
+       itr != registry->counters.end(); ++itr) {
+    const ProfileCounter& counter(*itr->second);
+    if (0 == counter.num_call_) continue;
+    if (!is_first) *output_stream << ", ";
+    is_first = false;
+    *output_stream << "{\"name\": \"" << counter.name_ << "\""
+                   << ", \"calls\": " << counter.num_call_
+                   << ", \"seconds\": " << 1e-9 * counter.num_nanosecond_
+                   << ", \"frames\": " << counter.num_frame_
+                   << ", \"bytes_read\": " << counter.num_byte_read_
+                   << ", \"bytes_written\": " << counter.num_byte_written_
+                   << ", \"iterations\": " << counter.num_iteration_ << "}";
+  }
+  *output_stream << "]}" << std::endl;
+}
+
+}  // namespace sptk
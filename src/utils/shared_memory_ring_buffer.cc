@@ -0,0 +1,472 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/utils/shared_memory_ring_buffer.h"
+
+#include <fcntl.h>        // fcntl, O_CREAT, O_EXCL, O_RDWR
+#include <signal.h>       // raise, SIGPIPE
+#include <sys/mman.h>     // memfd_create, mmap, munmap, shm_open, shm_unlink
+#include <sys/stat.h>     // fstat
+#include <sys/syscall.h>  // SYS_futex
+#include <unistd.h>       // close, ftruncate, getpid, syscall
+
+#include <algorithm>  // std::min
+#include <atomic>     // std::atomic
+#include <cerrno>     // errno
+#include <cstdlib>    // std::atexit, std::getenv, unsetenv
+#include <iostream>   // std::cin, std::cout
+#include <new>        // placement new
+#include <sstream>    // std::istringstream, std::ostringstream
+#include <streambuf>  // std::streambuf
+#include <string>     // std::getline, std::string
+#include <thread>     // std::this_thread
+
+#if defined(__linux__)
+#include <linux/futex.h>  // FUTEX_WAIT, FUTEX_WAKE
+#endif
+
+namespace {
+
+const uint32_t kMagic(0x53505452);  // "SPTR"
+const uint32_t kLayoutVersion(1);
+const std::size_t kHeaderSize(4096);
+const int kNumSpin(4096);
+const char* kEnvironmentVariable("SPTK_SHARED_MEMORY_STREAM");
+
+void Wait(std::atomic<uint32_t>* event, uint32_t value) {
+#if defined(__linux__)
+  // The timeout is a safety net; the other side wakes us up on every event.
+  struct timespec timeout = {0, 10000000};
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(event), FUTEX_WAIT, value,
+          &timeout, NULL, 0);
+#else
+  if (event->load() == value) std::this_thread::yield();
+#endif
+}
+
+void Wake(std::atomic<uint32_t>* event) {
+  event->fetch_add(1);
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(event), FUTEX_WAKE, 1, NULL,
+          NULL, 0);
+#endif
+}
+
+// Create an anonymous file in shared memory. memfd_create is available only on
+// Linux; elsewhere a POSIX shared memory object is unlinked right after it is
+// created, so that it is removed when the last descriptor is closed.
+int CreateMemoryFile() {
+#if defined(MFD_CLOEXEC)
+  return memfd_create("sptk-ring", MFD_CLOEXEC);
+#else
+  static std::atomic<uint32_t> num_created(0);
+  for (int i(0); i < 16; ++i) {
+    std::ostringstream name;
+    name << "/sptk-ring-" << getpid() << "-" << num_created.fetch_add(1);
+    const int fd(
+        shm_open(name.str().c_str(), O_RDWR | O_CREAT | O_EXCL, 0600));
+    if (0 <= fd) {
+      shm_unlink(name.str().c_str());
+      if (fcntl(fd, F_SETFD, FD_CLOEXEC) < 0) {
+        close(fd);
+        return -1;
+      }
+      return fd;
+    }
+    if (EEXIST != errno) {
+      break;
+    }
+  }
+  return -1;
+#endif
+}
+
+// The get area points directly at the readable region of the ring buffer.
+class InputStreamBuffer : public std::streambuf {
+ public:
+  explicit InputStreamBuffer(sptk::SharedMemoryRingBuffer* ring_buffer)
+      : ring_buffer_(ring_buffer) {
+  }
+
+  void Close() {
+    ring_buffer_->CloseReader();
+  }
+
+ protected:
+  int_type underflow() {
+    if (gptr() < egptr()) {
+      return traits_type::to_int_type(*gptr());
+    }
+    if (NULL != eback()) {
+      ring_buffer_->Consume(gptr() - eback());
+      setg(NULL, NULL, NULL);
+    }
+    const char* data;
+    std::size_t size;
+    if (!ring_buffer_->GetReadableRegion(&data, &size)) {
+      return traits_type::eof();
+    }
+    char* begin(const_cast<char*>(data));
+    setg(begin, begin, begin + size);
+    return traits_type::to_int_type(*begin);
+  }
+
+ private:
+  sptk::SharedMemoryRingBuffer* ring_buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(InputStreamBuffer);
+};
+
+// The put area points directly at the writable region of the ring buffer.
+class OutputStreamBuffer : public std::streambuf {
+ public:
+  explicit OutputStreamBuffer(sptk::SharedMemoryRingBuffer* ring_buffer)
+      : ring_buffer_(ring_buffer) {
+  }
+
+  void Close() {
+    Publish();
+    ring_buffer_->CloseWriter();
+  }
+
+ protected:
+  int_type overflow(int_type c) {
+    Publish();
+    char* data;
+    std::size_t size;
+    if (!ring_buffer_->GetWritableRegion(&data, &size)) {
+      // Behave as if the reader of a pipe had exited.
+      raise(SIGPIPE);
+      return traits_type::eof();
+    }
+    setp(data, data + size);
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  int sync() {
+    Publish();
+    return 0;
+  }
+
+ private:
+  void Publish() {
+    if (NULL != pbase()) {
+      ring_buffer_->Commit(pptr() - pbase());
+      setp(NULL, NULL);
+    }
+  }
+
+  sptk::SharedMemoryRingBuffer* ring_buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(OutputStreamBuffer);
+};
+
+InputStreamBuffer* input_stream_buffer(NULL);
+OutputStreamBuffer* output_stream_buffer(NULL);
+
+void DetachStandardStreams() {
+  if (NULL != output_stream_buffer) {
+    std::cout.flush();
+    output_stream_buffer->Close();
+  }
+  if (NULL != input_stream_buffer) {
+    input_stream_buffer->Close();
+  }
+}
+
+}  // namespace
+
+namespace sptk {
+
+// The positions are the total numbers of bytes written and read. Each side
+// writes its own cache line so that the two processes do not share one.
+struct SharedMemoryRingBuffer::Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t capacity;
+
+  alignas(64) std::atomic<uint64_t> write_position;
+  std::atomic<uint32_t> data_event;
+  std::atomic<uint32_t> is_reader_waiting;
+  std::atomic<uint32_t> is_writer_closed;
+
+  alignas(64) std::atomic<uint64_t> read_position;
+  std::atomic<uint32_t> space_event;
+  std::atomic<uint32_t> is_writer_waiting;
+  std::atomic<uint32_t> is_reader_closed;
+};
+
+bool SharedMemoryRingBuffer::Create(std::size_t capacity, int* fd) {
+  if (0 == capacity || NULL == fd) {
+    return false;
+  }
+
+  std::size_t rounded_capacity(kHeaderSize);
+  while (rounded_capacity < capacity) {
+    rounded_capacity *= 2;
+  }
+
+  const int new_fd(CreateMemoryFile());
+  if (new_fd < 0) {
+    return false;
+  }
+  const std::size_t mapped_size(kHeaderSize + rounded_capacity);
+  if (ftruncate(new_fd, mapped_size) < 0) {
+    close(new_fd);
+    return false;
+  }
+  void* address(
+      mmap(NULL, kHeaderSize, PROT_READ | PROT_WRITE, MAP_SHARED, new_fd, 0));
+  if (MAP_FAILED == address) {
+    close(new_fd);
+    return false;
+  }
+
+  Header* header(new (address) Header);
+  header->magic = kMagic;
+  header->version = kLayoutVersion;
+  header->capacity = rounded_capacity;
+  header->write_position.store(0);
+  header->data_event.store(0);
+  header->is_reader_waiting.store(0);
+  header->is_writer_closed.store(0);
+  header->read_position.store(0);
+  header->space_event.store(0);
+  header->is_writer_waiting.store(0);
+  header->is_reader_closed.store(0);
+  munmap(address, kHeaderSize);
+
+  *fd = new_fd;
+  return true;
+}
+
+SharedMemoryRingBuffer::SharedMemoryRingBuffer(int fd)
+    : header_(NULL), data_(NULL), mapped_size_(0) {
+  struct stat status;
+  if (fstat(fd, &status) < 0 || !S_ISREG(status.st_mode) ||
+      status.st_size <= static_cast<off_t>(kHeaderSize)) {
+    return;
+  }
+
+  const std::size_t mapped_size(status.st_size);
+  void* address(
+      mmap(NULL, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+  if (MAP_FAILED == address) {
+    return;
+  }
+
+  Header* header(static_cast<Header*>(address));
+  if (kMagic != header->magic || kLayoutVersion != header->version ||
+      kHeaderSize + header->capacity != mapped_size) {
+    munmap(address, mapped_size);
+    return;
+  }
+
+  header_ = header;
+  data_ = static_cast<char*>(address) + kHeaderSize;
+  mapped_size_ = mapped_size;
+}
+
+SharedMemoryRingBuffer::~SharedMemoryRingBuffer() {
+  if (NULL != header_) {
+    munmap(header_, mapped_size_);
+  }
+}
+
+bool SharedMemoryRingBuffer::GetReadableRegion(const char** data,
+                                               std::size_t* size) {
+  if (NULL == header_ || NULL == data || NULL == size) {
+    return false;
+  }
+
+  const uint64_t capacity(header_->capacity);
+  const uint64_t read_position(header_->read_position.load());
+  for (int i(0);; ++i) {
+    const uint64_t write_position(header_->write_position.load());
+    if (read_position != write_position) {
+      // Give at most a quarter at once so that the writer can go ahead.
+      const uint64_t offset(read_position & (capacity - 1));
+      *data = data_ + offset;
+      *size = std::min(std::min(write_position - read_position,
+                                capacity - offset),
+                       capacity / 4);
+      return true;
+    }
+    if (header_->is_writer_closed.load()) {
+      if (read_position == header_->write_position.load()) {
+        return false;
+      }
+      continue;
+    }
+    if (i < kNumSpin) {
+      continue;
+    }
+
+    const uint32_t event(header_->data_event.load());
+    header_->is_reader_waiting.store(1);
+    if (read_position == header_->write_position.load() &&
+        !header_->is_writer_closed.load()) {
+      Wait(&header_->data_event, event);
+    }
+    header_->is_reader_waiting.store(0);
+  }
+}
+
+void SharedMemoryRingBuffer::Consume(std::size_t size) {
+  if (NULL == header_ || 0 == size) {
+    return;
+  }
+  header_->read_position.fetch_add(size);
+  if (header_->is_writer_waiting.load()) {
+    Wake(&header_->space_event);
+  }
+}
+
+bool SharedMemoryRingBuffer::GetWritableRegion(char** data,
+                                               std::size_t* size) {
+  if (NULL == header_ || NULL == data || NULL == size) {
+    return false;
+  }
+
+  const uint64_t capacity(header_->capacity);
+  const uint64_t write_position(header_->write_position.load());
+  for (int i(0);; ++i) {
+    if (header_->is_reader_closed.load()) {
+      return false;
+    }
+    const uint64_t read_position(header_->read_position.load());
+    if (write_position - read_position < capacity) {
+      const uint64_t offset(write_position & (capacity - 1));
+      *data = data_ + offset;
+      *size = std::min(
+          std::min(capacity - (write_position - read_position),
+                   capacity - offset),
+          capacity / 4);
+      return true;
+    }
+    if (i < kNumSpin) {
+      continue;
+    }
+
+    const uint32_t event(header_->space_event.load());
+    header_->is_writer_waiting.store(1);
+    if (read_position == header_->read_position.load() &&
+        !header_->is_reader_closed.load()) {
+      Wait(&header_->space_event, event);
+    }
+    header_->is_writer_waiting.store(0);
+  }
+}
+
+void SharedMemoryRingBuffer::Commit(std::size_t size) {
+  if (NULL == header_ || 0 == size) {
+    return;
+  }
+  header_->write_position.fetch_add(size);
+  if (header_->is_reader_waiting.load()) {
+    Wake(&header_->data_event);
+  }
+}
+
+void SharedMemoryRingBuffer::CloseWriter() {
+  if (NULL == header_) {
+    return;
+  }
+  header_->is_writer_closed.store(1);
+  Wake(&header_->data_event);
+}
+
+void SharedMemoryRingBuffer::CloseReader() {
+  if (NULL == header_) {
+    return;
+  }
+  header_->is_reader_closed.store(1);
+  Wake(&header_->space_event);
+}
+
+void SharedMemoryRingBuffer::AttachStandardStreams() {
+  const char* value(std::getenv(kEnvironmentVariable));
+  if (NULL == value || NULL != input_stream_buffer ||
+      NULL != output_stream_buffer) {
+    return;
+  }
+
+  std::istringstream stream(value);
+  std::string name;
+  while (std::getline(stream, name, ',')) {
+    if ("stdin" == name && NULL == input_stream_buffer) {
+      SharedMemoryRingBuffer* ring_buffer(
+          new SharedMemoryRingBuffer(STDIN_FILENO));
+      if (ring_buffer->IsValid()) {
+        input_stream_buffer = new InputStreamBuffer(ring_buffer);
+        std::cin.rdbuf(input_stream_buffer);
+      } else {
+        delete ring_buffer;
+      }
+    } else if ("stdout" == name && NULL == output_stream_buffer) {
+      SharedMemoryRingBuffer* ring_buffer(
+          new SharedMemoryRingBuffer(STDOUT_FILENO));
+      if (ring_buffer->IsValid()) {
+        std::cout.flush();
+        output_stream_buffer = new OutputStreamBuffer(ring_buffer);
+        std::cout.rdbuf(output_stream_buffer);
+      } else {
+        delete ring_buffer;
+      }
+    }
+  }
+
+  // Child processes must not take the standard streams for ring buffers.
+  unsetenv(kEnvironmentVariable);
+  if (NULL != input_stream_buffer || NULL != output_stream_buffer) {
+    std::atexit(DetachStandardStreams);
+  }
+}
+
+}  // namespace sptk
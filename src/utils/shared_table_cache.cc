@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/utils/shared_table_cache.h"
+
+#include <map>    // std::map
+#include <mutex>  // std::lock_guard, std::mutex
+
+namespace {
+
+// The registry is never destroyed so that tables can be released at exit.
+struct Registry {
+  std::mutex mutex;
+  std::map<std::string, std::weak_ptr<const void> > tables;
+};
+
+Registry* GetRegistry() {
+  static Registry* registry(new Registry());
+  return registry;
+}
+
+}  // namespace
+
+namespace sptk {
+
+std::shared_ptr<const void> SharedTableCache::Find(const std::string& key) {
+  Registry* registry(GetRegistry());
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  std::map<std::string, std::weak_ptr<const void> >::iterator itr(
+      registry->tables.find(key));
+  if (itr == registry->tables.end()) {
+    return std::shared_ptr<const void>();
+  }
+  std::shared_ptr<const void> table(itr->second.lock());
+  if (!table) {
+    registry->tables.erase(itr);
+  }
+  return table;
+}
+
+std::shared_ptr<const void> SharedTableCache::Insert(
+    const std::string& key, const std::shared_ptr<const void>& table) {
+  Registry* registry(GetRegistry());
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  std::weak_ptr<const void>& cached_table(registry->tables[key]);
+  std::shared_ptr<const void> existing_table(cached_table.lock());
+  if (existing_table) {
+    return existing_table;
+  }
+  cached_table = table;
+  return table;
+}
+
+int SharedTableCache::GetNumTable() {
+  Registry* registry(GetRegistry());
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  int num_table(0);
+  for (std::map<std::string, std::weak_ptr<const void> >::const_iterator itr(
+           registry->tables.begin());
+       itr != registry->tables.end(); ++itr) {
+    if (!itr->second.expired()) ++num_table;
+  }
+  return num_table;
+}
+
+}  // namespace sptk
@@ -0,0 +1,734 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+#include "SPTK/utils/simd_kernels.h"
+
+#include <cmath>     // std::fabs
+#include <cstdlib>   // std::abort, std::getenv
+#include <cstring>   // std::memcmp, std::strcmp
+#include <iostream>  // std::cerr, std::endl
+#include <vector>    // std::vector
+
+// The target attribute with intrinsics requires GCC 4.9 and AVX-512 requires
+// GCC 5. Older compilers build only the scalar variant.
+#if defined(__clang__)
+#define SPTK_SIMD_GCC_AT_LEAST(major, minor) 1
+#else
+#define SPTK_SIMD_GCC_AT_LEAST(major, minor) \
+  ((major) < __GNUC__ || ((major) == __GNUC__ && (minor) <= __GNUC_MINOR__))
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && SPTK_SIMD_GCC_AT_LEAST(4, 9)
+#define SPTK_SIMD_X86
+#include <immintrin.h>
+#if SPTK_SIMD_GCC_AT_LEAST(5, 0)
+#define SPTK_SIMD_AVX512
+#endif
+#elif defined(__aarch64__) && SPTK_SIMD_GCC_AT_LEAST(4, 9)
+#define SPTK_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// Contraction into fused multiply-add is disabled in all variants including
+// the scalar reference so that they give bit-exact results.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#define SPTK_SIMD_NO_CONTRACT
+#define SPTK_SIMD_TARGET(name) __attribute__((target(name)))
+#else
+#define SPTK_SIMD_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#define SPTK_SIMD_TARGET(name) \
+  __attribute__((target(name), optimize("fp-contract=off")))
+#endif
+
+namespace {
+
+// Reductions add the i-th term to the (i mod 8)-th partial sum and combine the
+// partial sums in a fixed order. All variants follow the same order, so their
+// results do not depend on the instruction set of the host.
+const int kNumLane(8);
+
+double CombineLanes(const double* sum) {
+  return ((sum[0] + sum[4]) + (sum[2] + sum[6])) +
+         ((sum[1] + sum[5]) + (sum[3] + sum[7]));
+}
+
+// Scalar reference implementations. The SIMD variants use them for the
+// elements which do not fill all lanes.
+
+SPTK_SIMD_NO_CONTRACT double DotProductTail(const double* x, const double* y,
+                                            int begin, int length,
+                                            double sum) {
+  for (int i(begin); i < length; ++i) {
+    sum += x[i] * y[i];
+  }
+  return sum;
+}
+
+SPTK_SIMD_NO_CONTRACT double ManhattanDistanceTail(const double* x,
+                                                   const double* y, int begin,
+                                                   int length, double sum) {
+  for (int i(begin); i < length; ++i) {
+    sum += std::fabs(x[i] - y[i]);
+  }
+  return sum;
+}
+
+SPTK_SIMD_NO_CONTRACT double SquaredEuclideanDistanceTail(const double* x,
+                                                          const double* y,
+                                                          int begin,
+                                                          int length,
+                                                          double sum) {
+  for (int i(begin); i < length; ++i) {
+    const double diff(x[i] - y[i]);
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+SPTK_SIMD_NO_CONTRACT void FftButterflyTail(const double* cosine,
+                                            const double* sine, int begin,
+                                            int length, double* real,
+                                            double* imag) {
+  double* x2(real + length);
+  double* y2(imag + length);
+  for (int i(begin); i < length; ++i) {
+    const double t1(real[i] - x2[i]);
+    const double t2(imag[i] - y2[i]);
+    real[i] += x2[i];
+    imag[i] += y2[i];
+    x2[i] = cosine[i] * t1 + sine[i] * t2;
+    y2[i] = cosine[i] * t2 - sine[i] * t1;
+  }
+}
+
+SPTK_SIMD_NO_CONTRACT double DotProductScalar(const double* x, const double* y,
+                                              int length) {
+  double sum[kNumLane] = {0.0};
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane; ++k) {
+      sum[k] += x[i + k] * y[i + k];
+    }
+  }
+  return DotProductTail(x, y, i, length, CombineLanes(sum));
+}
+
+SPTK_SIMD_NO_CONTRACT double ManhattanDistanceScalar(const double* x,
+                                                     const double* y,
+                                                     int length) {
+  double sum[kNumLane] = {0.0};
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane; ++k) {
+      sum[k] += std::fabs(x[i + k] - y[i + k]);
+    }
+  }
+  return ManhattanDistanceTail(x, y, i, length, CombineLanes(sum));
+}
+
+SPTK_SIMD_NO_CONTRACT double SquaredEuclideanDistanceScalar(const double* x,
+                                                            const double* y,
+                                                            int length) {
+  double sum[kNumLane] = {0.0};
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane; ++k) {
+      const double diff(x[i + k] - y[i + k]);
+      sum[k] += diff * diff;
+    }
+  }
+  return SquaredEuclideanDistanceTail(x, y, i, length, CombineLanes(sum));
+}
+
+void FftButterflyScalar(const double* cosine, const double* sine, int length,
+                        double* real, double* imag) {
+  FftButterflyTail(cosine, sine, 0, length, real, imag);
+}
+
+#if defined(SPTK_SIMD_X86)
+
+// SSE2 variants. Each register holds two lanes.
+
+SPTK_SIMD_TARGET("sse2") double DotProductSse2(const double* x,
+                                               const double* y, int length) {
+  __m128d sum[kNumLane / 2];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    sum[k] = _mm_setzero_pd();
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 2; ++k) {
+      sum[k] = _mm_add_pd(sum[k], _mm_mul_pd(_mm_loadu_pd(x + i + 2 * k),
+                                             _mm_loadu_pd(y + i + 2 * k)));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    _mm_storeu_pd(lanes + 2 * k, sum[k]);
+  }
+  return DotProductTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("sse2") double ManhattanDistanceSse2(const double* x,
+                                                      const double* y,
+                                                      int length) {
+  const __m128d sign_mask(_mm_set1_pd(-0.0));
+  __m128d sum[kNumLane / 2];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    sum[k] = _mm_setzero_pd();
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 2; ++k) {
+      const __m128d diff(_mm_sub_pd(_mm_loadu_pd(x + i + 2 * k),
+                                    _mm_loadu_pd(y + i + 2 * k)));
+      sum[k] = _mm_add_pd(sum[k], _mm_andnot_pd(sign_mask, diff));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    _mm_storeu_pd(lanes + 2 * k, sum[k]);
+  }
+  return ManhattanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("sse2") double SquaredEuclideanDistanceSse2(
+    const double* x, const double* y, int length) {
+  __m128d sum[kNumLane / 2];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    sum[k] = _mm_setzero_pd();
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 2; ++k) {
+      const __m128d diff(_mm_sub_pd(_mm_loadu_pd(x + i + 2 * k),
+                                    _mm_loadu_pd(y + i + 2 * k)));
+      sum[k] = _mm_add_pd(sum[k], _mm_mul_pd(diff, diff));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    _mm_storeu_pd(lanes + 2 * k, sum[k]);
+  }
+  return SquaredEuclideanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("sse2") void FftButterflySse2(const double* cosine,
+                                               const double* sine, int length,
+                                               double* real, double* imag) {
+  double* x2(real + length);
+  double* y2(imag + length);
+  int i(0);
+  for (; i + 2 <= length; i += 2) {
+    const __m128d x1(_mm_loadu_pd(real + i));
+    const __m128d y1(_mm_loadu_pd(imag + i));
+    const __m128d xx(_mm_loadu_pd(x2 + i));
+    const __m128d yy(_mm_loadu_pd(y2 + i));
+    const __m128d c(_mm_loadu_pd(cosine + i));
+    const __m128d s(_mm_loadu_pd(sine + i));
+    const __m128d t1(_mm_sub_pd(x1, xx));
+    const __m128d t2(_mm_sub_pd(y1, yy));
+    _mm_storeu_pd(real + i, _mm_add_pd(x1, xx));
+    _mm_storeu_pd(imag + i, _mm_add_pd(y1, yy));
+    _mm_storeu_pd(x2 + i, _mm_add_pd(_mm_mul_pd(c, t1), _mm_mul_pd(s, t2)));
+    _mm_storeu_pd(y2 + i, _mm_sub_pd(_mm_mul_pd(c, t2), _mm_mul_pd(s, t1)));
+  }
+  FftButterflyTail(cosine, sine, i, length, real, imag);
+}
+
+// AVX2 variants. Each register holds four lanes.
+
+SPTK_SIMD_TARGET("avx2") double DotProductAvx2(const double* x,
+                                               const double* y, int length) {
+  __m256d sum[kNumLane / 4];
+  for (int k(0); k < kNumLane / 4; ++k) {
+    sum[k] = _mm256_setzero_pd();
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 4; ++k) {
+      sum[k] = _mm256_add_pd(
+          sum[k], _mm256_mul_pd(_mm256_loadu_pd(x + i + 4 * k),
+                                _mm256_loadu_pd(y + i + 4 * k)));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 4; ++k) {
+    _mm256_storeu_pd(lanes + 4 * k, sum[k]);
+  }
+  return DotProductTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("avx2") double ManhattanDistanceAvx2(const double* x,
+                                                      const double* y,
+                                                      int length) {
+  const __m256d sign_mask(_mm256_set1_pd(-0.0));
+  __m256d sum[kNumLane / 4];
+  for (int k(0); k < kNumLane / 4; ++k) {
+    sum[k] = _mm256_setzero_pd();
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 4; ++k) {
+      const __m256d diff(_mm256_sub_pd(_mm256_loadu_pd(x + i + 4 * k),
+                                       _mm256_loadu_pd(y + i + 4 * k)));
+      sum[k] = _mm256_add_pd(sum[k], _mm256_andnot_pd(sign_mask, diff));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 4; ++k) {
+    _mm256_storeu_pd(lanes + 4 * k, sum[k]);
+  }
+  return ManhattanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("avx2") double SquaredEuclideanDistanceAvx2(
+    const double* x, const double* y, int length) {
+  __m256d sum[kNumLane / 4];
+  for (int k(0); k < kNumLane / 4; ++k) {
+    sum[k] = _mm256_setzero_pd();
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 4; ++k) {
+      const __m256d diff(_mm256_sub_pd(_mm256_loadu_pd(x + i + 4 * k),
+                                       _mm256_loadu_pd(y + i + 4 * k)));
+      sum[k] = _mm256_add_pd(sum[k], _mm256_mul_pd(diff, diff));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 4; ++k) {
+    _mm256_storeu_pd(lanes + 4 * k, sum[k]);
+  }
+  return SquaredEuclideanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("avx2") void FftButterflyAvx2(const double* cosine,
+                                               const double* sine, int length,
+                                               double* real, double* imag) {
+  double* x2(real + length);
+  double* y2(imag + length);
+  int i(0);
+  for (; i + 4 <= length; i += 4) {
+    const __m256d x1(_mm256_loadu_pd(real + i));
+    const __m256d y1(_mm256_loadu_pd(imag + i));
+    const __m256d xx(_mm256_loadu_pd(x2 + i));
+    const __m256d yy(_mm256_loadu_pd(y2 + i));
+    const __m256d c(_mm256_loadu_pd(cosine + i));
+    const __m256d s(_mm256_loadu_pd(sine + i));
+    const __m256d t1(_mm256_sub_pd(x1, xx));
+    const __m256d t2(_mm256_sub_pd(y1, yy));
+    _mm256_storeu_pd(real + i, _mm256_add_pd(x1, xx));
+    _mm256_storeu_pd(imag + i, _mm256_add_pd(y1, yy));
+    _mm256_storeu_pd(x2 + i,
+                     _mm256_add_pd(_mm256_mul_pd(c, t1), _mm256_mul_pd(s, t2)));
+    _mm256_storeu_pd(y2 + i,
+                     _mm256_sub_pd(_mm256_mul_pd(c, t2), _mm256_mul_pd(s, t1)));
+  }
+  FftButterflyTail(cosine, sine, i, length, real, imag);
+}
+
+#endif  // SPTK_SIMD_X86
+
+#if defined(SPTK_SIMD_AVX512)
+
+// AVX-512 variants. One register holds all lanes.
+
+SPTK_SIMD_TARGET("avx512f") double DotProductAvx512(const double* x,
+                                                    const double* y,
+                                                    int length) {
+  __m512d sum(_mm512_setzero_pd());
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    sum = _mm512_add_pd(
+        sum, _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+  }
+  double lanes[kNumLane];
+  _mm512_storeu_pd(lanes, sum);
+  return DotProductTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("avx512f") double ManhattanDistanceAvx512(
+    const double* x, const double* y, int length) {
+  // The sign bit is cleared by an integer operation because _mm512_abs_pd and
+  // _mm512_andnot_pd are not available in AVX512F of old compilers.
+  const __m512i abs_mask(_mm512_set1_epi64(0x7fffffffffffffffLL));
+  __m512d sum(_mm512_setzero_pd());
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    const __m512d diff(
+        _mm512_sub_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    sum = _mm512_add_pd(sum, _mm512_castsi512_pd(_mm512_and_epi64(
+                                 _mm512_castpd_si512(diff), abs_mask)));
+  }
+  double lanes[kNumLane];
+  _mm512_storeu_pd(lanes, sum);
+  return ManhattanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("avx512f") double SquaredEuclideanDistanceAvx512(
+    const double* x, const double* y, int length) {
+  __m512d sum(_mm512_setzero_pd());
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    const __m512d diff(
+        _mm512_sub_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    sum = _mm512_add_pd(sum, _mm512_mul_pd(diff, diff));
+  }
+  double lanes[kNumLane];
+  _mm512_storeu_pd(lanes, sum);
+  return SquaredEuclideanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_TARGET("avx512f") void FftButterflyAvx512(
+    const double* cosine, const double* sine, int length, double* real,
+    double* imag) {
+  double* x2(real + length);
+  double* y2(imag + length);
+  int i(0);
+  for (; i + 8 <= length; i += 8) {
+    const __m512d x1(_mm512_loadu_pd(real + i));
+    const __m512d y1(_mm512_loadu_pd(imag + i));
+    const __m512d xx(_mm512_loadu_pd(x2 + i));
+    const __m512d yy(_mm512_loadu_pd(y2 + i));
+    const __m512d c(_mm512_loadu_pd(cosine + i));
+    const __m512d s(_mm512_loadu_pd(sine + i));
+    const __m512d t1(_mm512_sub_pd(x1, xx));
+    const __m512d t2(_mm512_sub_pd(y1, yy));
+    _mm512_storeu_pd(real + i, _mm512_add_pd(x1, xx));
+    _mm512_storeu_pd(imag + i, _mm512_add_pd(y1, yy));
+    _mm512_storeu_pd(x2 + i,
+                     _mm512_add_pd(_mm512_mul_pd(c, t1), _mm512_mul_pd(s, t2)));
+    _mm512_storeu_pd(y2 + i,
+                     _mm512_sub_pd(_mm512_mul_pd(c, t2), _mm512_mul_pd(s, t1)));
+  }
+  FftButterflyTail(cosine, sine, i, length, real, imag);
+}
+
+#endif  // SPTK_SIMD_AVX512
+
+#if defined(SPTK_SIMD_NEON)
+
+// NEON variants. Each register holds two lanes.
+
+SPTK_SIMD_NO_CONTRACT double DotProductNeon(const double* x, const double* y,
+                                            int length) {
+  float64x2_t sum[kNumLane / 2];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    sum[k] = vdupq_n_f64(0.0);
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 2; ++k) {
+      sum[k] = vaddq_f64(sum[k], vmulq_f64(vld1q_f64(x + i + 2 * k),
+                                           vld1q_f64(y + i + 2 * k)));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    vst1q_f64(lanes + 2 * k, sum[k]);
+  }
+  return DotProductTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_NO_CONTRACT double ManhattanDistanceNeon(const double* x,
+                                                   const double* y,
+                                                   int length) {
+  float64x2_t sum[kNumLane / 2];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    sum[k] = vdupq_n_f64(0.0);
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 2; ++k) {
+      sum[k] = vaddq_f64(
+          sum[k], vabdq_f64(vld1q_f64(x + i + 2 * k), vld1q_f64(y + i + 2 * k)));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    vst1q_f64(lanes + 2 * k, sum[k]);
+  }
+  return ManhattanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_NO_CONTRACT double SquaredEuclideanDistanceNeon(const double* x,
+                                                          const double* y,
+                                                          int length) {
+  float64x2_t sum[kNumLane / 2];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    sum[k] = vdupq_n_f64(0.0);
+  }
+  int i(0);
+  for (; i + kNumLane <= length; i += kNumLane) {
+    for (int k(0); k < kNumLane / 2; ++k) {
+      const float64x2_t diff(
+          vsubq_f64(vld1q_f64(x + i + 2 * k), vld1q_f64(y + i + 2 * k)));
+      sum[k] = vaddq_f64(sum[k], vmulq_f64(diff, diff));
+    }
+  }
+  double lanes[kNumLane];
+  for (int k(0); k < kNumLane / 2; ++k) {
+    vst1q_f64(lanes + 2 * k, sum[k]);
+  }
+  return SquaredEuclideanDistanceTail(x, y, i, length, CombineLanes(lanes));
+}
+
+SPTK_SIMD_NO_CONTRACT void FftButterflyNeon(const double* cosine,
+                                            const double* sine, int length,
+                                            double* real, double* imag) {
+  double* x2(real + length);
+  double* y2(imag + length);
+  int i(0);
+  for (; i + 2 <= length; i += 2) {
+    const float64x2_t x1(vld1q_f64(real + i));
+    const float64x2_t y1(vld1q_f64(imag + i));
+    const float64x2_t xx(vld1q_f64(x2 + i));
+    const float64x2_t yy(vld1q_f64(y2 + i));
+    const float64x2_t c(vld1q_f64(cosine + i));
+    const float64x2_t s(vld1q_f64(sine + i));
+    const float64x2_t t1(vsubq_f64(x1, xx));
+    const float64x2_t t2(vsubq_f64(y1, yy));
+    vst1q_f64(real + i, vaddq_f64(x1, xx));
+    vst1q_f64(imag + i, vaddq_f64(y1, yy));
+    vst1q_f64(x2 + i, vaddq_f64(vmulq_f64(c, t1), vmulq_f64(s, t2)));
+    vst1q_f64(y2 + i, vsubq_f64(vmulq_f64(c, t2), vmulq_f64(s, t1)));
+  }
+  FftButterflyTail(cosine, sine, i, length, real, imag);
+}
+
+#endif  // SPTK_SIMD_NEON
+
+// Cross-checking variants. All variants must give bit-exact results.
+
+void ReportMismatch(const char* kernel_name,
+                    sptk::SimdKernels::InstructionSets instruction_set) {
+  std::cerr << "SimdKernels: " << kernel_name << " of "
+            << sptk::SimdKernels::GetName(instruction_set)
+            << " differs from scalar reference" << std::endl;
+  std::abort();
+}
+
+template <typename Function>
+double CheckReduction(const char* kernel_name,
+                      Function sptk::SimdKernels::*kernel, const double* x,
+                      const double* y, int length) {
+  const double reference(
+      (sptk::SimdKernels::Get(sptk::SimdKernels::kScalar)->*kernel)(x, y,
+                                                                   length));
+  for (int k(sptk::SimdKernels::kScalar + 1); k < sptk::SimdKernels::kCheck;
+       ++k) {
+    const sptk::SimdKernels::InstructionSets instruction_set(
+        static_cast<sptk::SimdKernels::InstructionSets>(k));
+    const sptk::SimdKernels* kernels(sptk::SimdKernels::Get(instruction_set));
+    if (NULL == kernels) continue;
+    const double result((kernels->*kernel)(x, y, length));
+    if (0 != std::memcmp(&result, &reference, sizeof(result))) {
+      ReportMismatch(kernel_name, instruction_set);
+    }
+  }
+  return reference;
+}
+
+double DotProductCheck(const double* x, const double* y, int length) {
+  return CheckReduction("dot_product", &sptk::SimdKernels::dot_product, x, y,
+                        length);
+}
+
+double ManhattanDistanceCheck(const double* x, const double* y, int length) {
+  return CheckReduction("manhattan_distance",
+                        &sptk::SimdKernels::manhattan_distance, x, y, length);
+}
+
+double SquaredEuclideanDistanceCheck(const double* x, const double* y,
+                                     int length) {
+  return CheckReduction("squared_euclidean_distance",
+                        &sptk::SimdKernels::squared_euclidean_distance, x, y,
+                        length);
+}
+
+void FftButterflyCheck(const double* cosine, const double* sine, int length,
+                       double* real, double* imag) {
+  const std::vector<double> real_input(real, real + 2 * length);
+  const std::vector<double> imag_input(imag, imag + 2 * length);
+  FftButterflyScalar(cosine, sine, length, real, imag);
+
+  std::vector<double> real_output(2 * length);
+  std::vector<double> imag_output(2 * length);
+  for (int k(sptk::SimdKernels::kScalar + 1); k < sptk::SimdKernels::kCheck;
+       ++k) {
+    const sptk::SimdKernels::InstructionSets instruction_set(
+        static_cast<sptk::SimdKernels::InstructionSets>(k));
+    const sptk::SimdKernels* kernels(sptk::SimdKernels::Get(instruction_set));
+    if (NULL == kernels || 0 == length) continue;
+    real_output = real_input;
+    imag_output = imag_input;
+    kernels->fft_butterfly(cosine, sine, length, &(real_output[0]),
+                           &(imag_output[0]));
+    if (0 != std::memcmp(&(real_output[0]), real,
+                         sizeof(*real) * 2 * length) ||
+        0 != std::memcmp(&(imag_output[0]), imag,
+                         sizeof(*imag) * 2 * length)) {
+      ReportMismatch("fft_butterfly", instruction_set);
+    }
+  }
+}
+
+const sptk::SimdKernels kKernels[sptk::SimdKernels::kNumInstructionSets] = {
+    {sptk::SimdKernels::kScalar, DotProductScalar, ManhattanDistanceScalar,
+     SquaredEuclideanDistanceScalar, FftButterflyScalar},
+#if defined(SPTK_SIMD_X86)
+    {sptk::SimdKernels::kSse2, DotProductSse2, ManhattanDistanceSse2,
+     SquaredEuclideanDistanceSse2, FftButterflySse2},
+    {sptk::SimdKernels::kAvx2, DotProductAvx2, ManhattanDistanceAvx2,
+     SquaredEuclideanDistanceAvx2, FftButterflyAvx2},
+#else
+    {sptk::SimdKernels::kSse2, NULL, NULL, NULL, NULL},
+    {sptk::SimdKernels::kAvx2, NULL, NULL, NULL, NULL},
+#endif
+#if defined(SPTK_SIMD_AVX512)
+    {sptk::SimdKernels::kAvx512, DotProductAvx512, ManhattanDistanceAvx512,
+     SquaredEuclideanDistanceAvx512, FftButterflyAvx512},
+#else
+    {sptk::SimdKernels::kAvx512, NULL, NULL, NULL, NULL},
+#endif
+#if defined(SPTK_SIMD_NEON)
+    {sptk::SimdKernels::kNeon, DotProductNeon, ManhattanDistanceNeon,
+     SquaredEuclideanDistanceNeon, FftButterflyNeon},
+#else
+    {sptk::SimdKernels::kNeon, NULL, NULL, NULL, NULL},
+#endif
+    {sptk::SimdKernels::kCheck, DotProductCheck, ManhattanDistanceCheck,
+     SquaredEuclideanDistanceCheck, FftButterflyCheck},
+};
+
+const char* const kNames[sptk::SimdKernels::kNumInstructionSets] = {
+    "scalar", "sse2", "avx2", "avx512", "neon", "check",
+};
+
+const sptk::SimdKernels* SelectKernels() {
+  const char* value(std::getenv("SPTK_SIMD"));
+  if (NULL != value && '\0' != value[0]) {
+    int k(0);
+    while (k < sptk::SimdKernels::kNumInstructionSets &&
+           0 != std::strcmp(value, kNames[k])) {
+      ++k;
+    }
+    if (sptk::SimdKernels::kNumInstructionSets == k) {
+      std::cerr << "SimdKernels: unknown SPTK_SIMD=" << value
+                << ", using the default" << std::endl;
+    } else {
+      const sptk::SimdKernels* kernels(sptk::SimdKernels::Get(
+          static_cast<sptk::SimdKernels::InstructionSets>(k)));
+      if (NULL != kernels) return kernels;
+      std::cerr << "SimdKernels: " << value
+                << " is not supported on this host, using the default"
+                << std::endl;
+    }
+  }
+
+  // Use the widest supported instruction set.
+  for (int k(sptk::SimdKernels::kCheck - 1); sptk::SimdKernels::kScalar < k;
+       --k) {
+    const sptk::SimdKernels* kernels(sptk::SimdKernels::Get(
+        static_cast<sptk::SimdKernels::InstructionSets>(k)));
+    if (NULL != kernels) return kernels;
+  }
+  return &kKernels[sptk::SimdKernels::kScalar];
+}
+
+}  // namespace
+
+namespace sptk {
+
+bool SimdKernels::IsSupported(SimdKernels::InstructionSets instruction_set) {
+  switch (instruction_set) {
+    case kScalar:
+    case kCheck: {
+      return true;
+    }
+#if defined(SPTK_SIMD_X86)
+    case kSse2: {
+      return __builtin_cpu_supports("sse2");
+    }
+    case kAvx2: {
+      return __builtin_cpu_supports("avx2");
+    }
+#endif
+#if defined(SPTK_SIMD_AVX512)
+    case kAvx512: {
+      return __builtin_cpu_supports("avx512f");
+    }
+#endif
+#if defined(SPTK_SIMD_NEON)
+    case kNeon: {
+      return true;
+    }
+#endif
+    default: { return false; }
+  }
+}
+
+const char* SimdKernels::GetName(SimdKernels::InstructionSets instruction_set) {
+  if (instruction_set < kScalar || kNumInstructionSets <= instruction_set) {
+    return NULL;
+  }
+  return kNames[instruction_set];
+}
+
+const SimdKernels& SimdKernels::Get() {
+  static const SimdKernels* kernels(SelectKernels());
+  return *kernels;
+}
+
+const SimdKernels* SimdKernels::Get(
+    SimdKernels::InstructionSets instruction_set) {
+  if (!IsSupported(instruction_set)) {
+    return NULL;
+  }
+  return &kKernels[instruction_set];
+}
+
+}  // namespace sptk
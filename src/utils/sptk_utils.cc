@@ -44,6 +44,9 @@
 
 #include "SPTK/utils/sptk_utils.h"
 
+#include <poll.h>    // poll
+#include <unistd.h>  // STDIN_FILENO
+
 #include <algorithm>  // std::fill_n, std::max, std::min, std::transform
 #include <cctype>     // std::tolower
 #include <cerrno>     // errno, ERANGE
@@ -51,11 +54,14 @@
 #include <cstddef>    // std::size_t
 #include <cstdint>    // int8_t, int16_t, int32_t, int64_t, etc.
 #include <cstdio>     // std::snprintf
-#include <cstdlib>    // std::strtod, std::strtol
+#include <cstdlib>    // std::exit, std::strtod, std::strtol
 #include <iomanip>    // std::setw
-#include <iostream>   // std::cerr, std::endl, std::left
+#include <iostream>   // std::cerr, std::cin, std::endl, std::left
 
+#include "SPTK/utils/feature_container.h"
 #include "SPTK/utils/int24_t.h"
+#include "SPTK/utils/profiler.h"
+#include "SPTK/utils/shared_memory_ring_buffer.h"
 #include "SPTK/utils/uint24_t.h"
 
 namespace {
@@ -63,23 +69,44 @@ namespace {
 // 34 is a reasonable number near log(1e-15)
 static const double kThresholdOfInformationLossInLogSpace(-34.0);
 
+// Name of the command given to InitializeCommand. Only a command exits on a
+// broken input; a library user such as sptkd checks it by GetInputError.
+std::string command_name;
+
+// Index of the slot of std::ios_base which holds the size of one element
+// expected by the reader of an input whose elements have another size.
+const int kExpectedElementSizeIndex(std::ios_base::xalloc());
+
+// Return false as the end of input. A broken input stops the command here.
+bool EndInput(std::istream* input_stream) {
+  sptk::ExitOnInputError(input_stream);
+  return false;
+}
+
 }  // namespace
 
 namespace sptk {
 
 template <typename T>
 bool ReadStream(T* data_to_read, std::istream* input_stream) {
+  SPTK_PROFILE_SCOPE("ReadStream");
   if (NULL == data_to_read || NULL == input_stream || input_stream->eof()) {
     return false;
   }
 
   const int type_byte(sizeof(*data_to_read));
+  if (!PrepareInputStream(type_byte, input_stream)) {
+    return EndInput(input_stream);
+  }
   input_stream->read(reinterpret_cast<char*>(data_to_read), type_byte);
+  SPTK_PROFILE_BYTE_READ(input_stream->gcount());
 
-  return (type_byte == input_stream->gcount()) ? !input_stream->fail() : false;
+  return (type_byte == input_stream->gcount()) ? !input_stream->fail()
+                                               : EndInput(input_stream);
 }
 
 bool ReadStream(sptk::Matrix* matrix_to_read, std::istream* input_stream) {
+  SPTK_PROFILE_SCOPE("ReadStream");
   if (NULL == matrix_to_read || 0 == matrix_to_read->GetNumRow() ||
       0 == matrix_to_read->GetNumColumn() || NULL == input_stream ||
       input_stream->eof()) {
@@ -87,14 +114,18 @@ bool ReadStream(sptk::Matrix* matrix_to_read, std::istream* input_stream) {
   }
 
   const int type_byte(sizeof((*matrix_to_read)[0][0]));
+  if (!PrepareInputStream(type_byte, input_stream)) {
+    return EndInput(input_stream);
+  }
 
   const int num_read_bytes(type_byte * matrix_to_read->GetNumRow() *
                            matrix_to_read->GetNumColumn());
   input_stream->read(reinterpret_cast<char*>(&((*matrix_to_read)[0][0])),
                      num_read_bytes);
+  SPTK_PROFILE_BYTE_READ(input_stream->gcount());
 
   return (num_read_bytes == input_stream->gcount()) ? !input_stream->fail()
-                                                    : false;
+                                                    : EndInput(input_stream);
 }
 
 bool ReadStream(sptk::SymmetricMatrix* matrix_to_read,
@@ -122,16 +153,20 @@ template <typename T>
 bool ReadStream(bool zero_padding, int stream_skip, int read_point,
                 int read_size, std::vector<T>* sequence_to_read,
                 std::istream* input_stream, int* actual_read_size) {
+  SPTK_PROFILE_SCOPE("ReadStream");
   if (stream_skip < 0 || read_point < 0 || read_size <= 0 ||
       NULL == sequence_to_read || NULL == input_stream || input_stream->eof()) {
     return false;
   }
 
   const int type_byte(sizeof((*sequence_to_read)[0]));
+  if (!PrepareInputStream(type_byte, input_stream)) {
+    return EndInput(input_stream);
+  }
 
   if (0 < stream_skip) {
     input_stream->ignore(type_byte * stream_skip);
-    if (input_stream->eof()) return false;
+    if (input_stream->eof()) return EndInput(input_stream);
   }
 
   const int end(read_point + read_size);
@@ -145,6 +180,8 @@ bool ReadStream(bool zero_padding, int stream_skip, int read_point,
       num_read_bytes);
 
   const int gcount(static_cast<int>(input_stream->gcount()));
+  SPTK_PROFILE_BYTE_READ(gcount);
+  SPTK_PROFILE_FRAME(1);
   if (NULL != actual_read_size) {
     *actual_read_size = gcount / type_byte;
   }
@@ -165,23 +202,109 @@ bool ReadStream(bool zero_padding, int stream_skip, int read_point,
     return !input_stream->bad();
   }
 
+  return EndInput(input_stream);
+}
+
+bool GetRemainingStreamSize(std::istream* input_stream, std::streamoff* size) {
+  if (NULL == input_stream || NULL == size || !input_stream->good()) {
+    return false;
+  }
+
+  // The size of a feature container is that of its frames.
+  sptk::PrepareFeatureInputStream(input_stream);
+
+  // Pipes and terminals are not seekable; leave them untouched.
+  const std::streampos current_position(input_stream->tellg());
+  if (current_position < 0) {
+    input_stream->clear();
+    return false;
+  }
+  input_stream->seekg(0, std::ios::end);
+  const std::streampos end_position(input_stream->tellg());
+  input_stream->seekg(current_position);
+  if (end_position < 0 || input_stream->fail()) {
+    input_stream->clear();
+    input_stream->seekg(current_position);
+    return false;
+  }
+
+  *size = end_position - current_position;
+  return true;
+}
+
+bool IsInputPending(std::istream* input_stream) {
+  if (NULL == input_stream || !input_stream->good()) {
+    return false;
+  }
+
+  if (0 < input_stream->rdbuf()->in_avail()) {
+    return true;
+  }
+
+  // The standard input synchronized with stdio does not report its buffer.
+  if (&std::cin == input_stream) {
+    struct pollfd descriptor = {STDIN_FILENO, POLLIN, 0};
+    return 0 < poll(&descriptor, 1, 0);
+  }
+
   return false;
 }
 
+bool PrepareInputStream(int type_byte, std::istream* input_stream) {
+  const int element_size(PrepareFeatureInputStream(input_stream));
+  if (0 == element_size || type_byte == element_size) {
+    return true;
+  }
+  input_stream->iword(kExpectedElementSizeIndex) = type_byte;
+  return false;
+}
+
+bool GetInputError(std::istream* input_stream, std::string* error_message) {
+  if (NULL == input_stream) {
+    return false;
+  }
+  const long type_byte(  // NOLINT
+      input_stream->iword(kExpectedElementSizeIndex));
+  if (0 != type_byte) {
+    if (NULL != error_message) {
+      std::ostringstream stream;
+      stream << "Element size mismatch (" << type_byte << " bytes expected, "
+             << PrepareFeatureInputStream(input_stream) << " bytes given)";
+      *error_message = stream.str();
+    }
+    return true;
+  }
+  return IsFeatureInputBroken(input_stream, error_message);
+}
+
+void ExitOnInputError(std::istream* input_stream) {
+  std::string error_message;
+  if (command_name.empty() || !GetInputError(input_stream, &error_message)) {
+    return;
+  }
+  std::ostringstream message;
+  message << error_message;
+  PrintErrorMessage(command_name, message);
+  std::exit(1);
+}
+
 template <typename T>
 bool WriteStream(T data_to_write, std::ostream* output_stream) {
+  SPTK_PROFILE_SCOPE("WriteStream");
   if (NULL == output_stream) {
     return false;
   }
 
   output_stream->write(reinterpret_cast<const char*>(&data_to_write),
                        sizeof(data_to_write));
+  SPTK_PROFILE_BYTE_WRITTEN(sizeof(data_to_write));
 
   return !output_stream->fail();
 }
 
 bool WriteStream(const sptk::Matrix& matrix_to_write,
                  std::ostream* output_stream) {
+  SPTK_PROFILE_SCOPE("WriteStream");
   if (0 == matrix_to_write.GetNumRow() || 0 == matrix_to_write.GetNumColumn() ||
       NULL == output_stream) {
     return false;
@@ -191,6 +314,9 @@ bool WriteStream(const sptk::Matrix& matrix_to_write,
                        sizeof(matrix_to_write[0][0]) *
                            matrix_to_write.GetNumRow() *
                            matrix_to_write.GetNumColumn());
+  SPTK_PROFILE_BYTE_WRITTEN(sizeof(matrix_to_write[0][0]) *
+                            matrix_to_write.GetNumRow() *
+                            matrix_to_write.GetNumColumn());
 
   return !output_stream->fail();
 }
@@ -217,6 +343,7 @@ template <typename T>
 bool WriteStream(int write_point, int write_size,
                  const std::vector<T>& sequence_to_write,
                  std::ostream* output_stream, int* actual_write_size) {
+  SPTK_PROFILE_SCOPE("WriteStream");
   if (write_point < 0 || write_size <= 0 || NULL == output_stream) {
     return false;
   }
@@ -233,6 +360,8 @@ bool WriteStream(int write_point, int write_size,
   output_stream->write(
       reinterpret_cast<const char*>(&(sequence_to_write[0]) + write_point),
       sizeof(sequence_to_write[0]) * write_size);
+  SPTK_PROFILE_BYTE_WRITTEN(sizeof(sequence_to_write[0]) * write_size);
+  SPTK_PROFILE_FRAME(1);
 
   // When output_stream is cout, actual_write_size is always zero.
   if (NULL != actual_write_size) {
@@ -523,6 +652,17 @@ void PrintErrorMessage(const std::string& program_name,
   std::cerr << stream.str();
 }
 
+void InitializeCommand(int* argc, char* argv[]) {
+  if (0 < *argc) {
+    const std::string path(argv[0]);
+    command_name = path.substr(path.find_last_of('/') + 1);
+  }
+  // --profile must be removed before getopt_long sees it.
+  Profiler::ParseCommandLine(argc, argv);
+  // Standard streams given by sptkpipe must be attached before any I/O.
+  SharedMemoryRingBuffer::AttachStandardStreams();
+}
+
 // clang-format off
 template bool ReadStream<bool>(bool*, std::istream*);
 template bool ReadStream<int8_t>(int8_t*, std::istream*);
@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+#include "SPTK/utils/thread_pool.h"
+
+#include <cstdlib>  // std::getenv, std::strtol
+#include <cstring>  // std::strcmp, std::strncmp
+
+namespace {
+
+const int kMaxNumThread(1024);
+
+// Index of the worker running on the current thread, or -1 if the thread is
+// not a worker of any pool.
+thread_local const sptk::ThreadPool* current_pool(NULL);
+thread_local int current_worker_index(-1);
+
+int num_thread_given_by_command_line(0);
+
+bool ConvertStringToNumThread(const char* string, int* num_thread) {
+  if (NULL == string || '\0' == string[0]) {
+    return false;
+  }
+  char* end;
+  const long value(std::strtol(string, &end, 10));  // NOLINT
+  if ('\0' != *end || value <= 0 || kMaxNumThread < value) {
+    return false;
+  }
+  *num_thread = static_cast<int>(value);
+  return true;
+}
+
+bool IsNumeric(const char* string) {
+  if ('\0' == string[0]) return false;
+  for (const char* p(string); '\0' != *p; ++p) {
+    if (*p < '0' || '9' < *p) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+namespace sptk {
+
+ThreadPool::ThreadPool(int num_thread)
+    : num_thread_(num_thread < 1 ? 1 : num_thread),
+      num_queued_task_(0),
+      next_queue_index_(0),
+      is_stopping_(false) {
+  // The last queue belongs to threads which are not workers.
+  for (int i(0); i < num_thread_; ++i) {
+    queues_.emplace_back(new TaskQueue());
+  }
+  for (int i(0); i < num_thread_ - 1; ++i) {
+    workers_.emplace_back(&ThreadPool::RunWorker, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopping_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(int begin, int end, int grain_size,
+                             const std::function<void(int, int)>& function) {
+  if (end <= begin) {
+    return;
+  }
+  if (grain_size <= 0) {
+    grain_size = 1;
+  }
+
+  const int num_chunk((end - begin + grain_size - 1) / grain_size);
+  if (1 == num_thread_ || 1 == num_chunk) {
+    function(begin, end);
+    return;
+  }
+
+  const int own_queue_index(this == current_pool ? current_worker_index
+                                                 : num_thread_ - 1);
+  TaskGroup group(num_chunk);
+  {
+    TaskQueue* queue(queues_[own_queue_index].get());
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    for (int first(begin); first < end; first += grain_size) {
+      const int last(std::min(end, first + grain_size));
+      queue->tasks.push_back(Task{&function, first, last, &group});
+    }
+  }
+  num_queued_task_ += num_chunk;
+  {
+    // Lock to avoid missing the notification by a worker about to sleep.
+    std::lock_guard<std::mutex> lock(mutex_);
+  }
+  condition_.notify_all();
+
+  // Help the workers instead of blocking so that nested calls never deadlock.
+  while (0 < group.num_remaining_task.load()) {
+    if (!RunTask(own_queue_index)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void ThreadPool::RunWorker(int worker_index) {
+  current_pool = this;
+  current_worker_index = worker_index;
+  for (;;) {
+    if (RunTask(worker_index)) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(
+        lock, [this] { return is_stopping_ || 0 < num_queued_task_.load(); });
+    if (is_stopping_) {
+      return;
+    }
+  }
+}
+
+bool ThreadPool::RunTask(int queue_index) {
+  Task task;
+  bool is_found(false);
+
+  // Take the newest task of own queue.
+  {
+    TaskQueue* queue(queues_[queue_index].get());
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (!queue->tasks.empty()) {
+      task = queue->tasks.back();
+      queue->tasks.pop_back();
+      is_found = true;
+    }
+  }
+
+  // Steal the oldest task of another queue.
+  if (!is_found) {
+    const int offset(next_queue_index_++);
+    for (int i(0); i < num_thread_ && !is_found; ++i) {
+      const int victim_index((offset + i) % num_thread_);
+      if (victim_index == queue_index) continue;
+      TaskQueue* queue(queues_[victim_index].get());
+      std::lock_guard<std::mutex> lock(queue->mutex);
+      if (!queue->tasks.empty()) {
+        task = queue->tasks.front();
+        queue->tasks.pop_front();
+        is_found = true;
+      }
+    }
+  }
+
+  if (!is_found) {
+    return false;
+  }
+
+  --num_queued_task_;
+  (*task.function)(task.first, task.last);
+  --task.group->num_remaining_task;
+  return true;
+}
+
+ThreadPool& ThreadPool::GetDefault() {
+  // The pool is never destroyed so that it can be used until exit.
+  static ThreadPool* pool(new ThreadPool(GetDefaultNumThread()));
+  return *pool;
+}
+
+int ThreadPool::GetDefaultNumThread() {
+  if (0 < num_thread_given_by_command_line) {
+    return num_thread_given_by_command_line;
+  }
+  int num_thread;
+  if (ConvertStringToNumThread(std::getenv("SPTK_NUM_THREADS"), &num_thread)) {
+    return num_thread;
+  }
+  return 1;
+}
+
+bool ThreadPool::ParseCommandLine(int* argc, char* argv[]) {
+  if (NULL == argc || NULL == argv) {
+    return false;
+  }
+
+  bool is_valid(true);
+  int num_remaining_argument(1);
+  for (int i(1); i < *argc; ++i) {
+    if (0 == std::strcmp(argv[i], "--")) {
+      for (; i < *argc; ++i) {
+        argv[num_remaining_argument++] = argv[i];
+      }
+      break;
+    }
+
+    // Accept only -T N and -TN so that long options such as -TANH are kept.
+    const char* value(NULL);
+    if (0 == std::strcmp(argv[i], "-T") && i + 1 < *argc) {
+      value = argv[++i];
+    } else if (0 == std::strncmp(argv[i], "-T", 2) && IsNumeric(argv[i] + 2)) {
+      value = argv[i] + 2;
+    }
+
+    if (NULL == value) {
+      argv[num_remaining_argument++] = argv[i];
+    } else if (!ConvertStringToNumThread(value,
+                                         &num_thread_given_by_command_line)) {
+      is_valid = false;
+    }
+  }
+  if (num_remaining_argument < *argc) {
+    argv[num_remaining_argument] = NULL;
+  }
+  *argc = num_remaining_argument;
+
+  return is_valid;
+}
+
+}  // namespace sptk
@@ -48,6 +48,9 @@
 #include <cmath>      // std::sqrt
 #include <cstddef>    // std::size_t
 #include <numeric>    // std::accumulate, std::inner_product
+#include <string>     // std::string
+
+#include "SPTK/utils/shared_table_cache.h"
 
 namespace sptk {
 
@@ -62,38 +65,61 @@ DataWindowing::DataWindowing(WindowInterface* window_interface,
     return;
   }
 
-  // Get window.
-  window_ = window_interface->Get();
+  if (normalization_type < kNone ||
+      kNumNormalizationTypes <= normalization_type) {
+    is_valid_ = false;
+    return;
+  }
 
-  double normalization_constant(1.0);
-  switch (normalization_type) {
-    case kNone: {
-      // nothing to do
-      break;
-    }
-    case kPower: {
-      const double power(std::inner_product(window_.begin(), window_.end(),
-                                            window_.begin(), 0.0));
-      normalization_constant = 1.0 / std::sqrt(power);
-      break;
-    }
-    case kMagnitude: {
-      const double magnitude(
-          std::accumulate(window_.begin(), window_.end(), 0.0));
-      normalization_constant = 1.0 / magnitude;
-      break;
+  const std::vector<double>& window(window_interface->Get());
+  const auto make_window([&window, normalization_type](
+                             std::vector<double>* normalized_window) {
+    *normalized_window = window;
+
+    double normalization_constant(1.0);
+    switch (normalization_type) {
+      case kNone: {
+        // nothing to do
+        break;
+      }
+      case kPower: {
+        const double power(std::inner_product(window.begin(), window.end(),
+                                              window.begin(), 0.0));
+        normalization_constant = 1.0 / std::sqrt(power);
+        break;
+      }
+      case kMagnitude: {
+        const double magnitude(
+            std::accumulate(window.begin(), window.end(), 0.0));
+        normalization_constant = 1.0 / magnitude;
+        break;
+      }
+      default: {
+        break;
+      }
     }
-    default: {
-      is_valid_ = false;
-      return;
+
+    if (1.0 != normalization_constant) {
+      std::transform(normalized_window->begin(), normalized_window->end(),
+                     normalized_window->begin(),
+                     [normalization_constant](double w) {
+                       return w * normalization_constant;
+                     });
     }
-  }
+  });
 
-  if (1.0 != normalization_constant) {
-    std::transform(window_.begin(), window_.end(), window_.begin(),
-                   [normalization_constant](double w) {
-                     return w * normalization_constant;
-                   });
+  // Share the normalized window if the window itself is shared.
+  const std::string window_key(window_interface->GetCacheKey());
+  if (window_key.empty()) {
+    std::shared_ptr<std::vector<double> > normalized_window(
+        new std::vector<double>());
+    make_window(normalized_window.get());
+    window_ = normalized_window;
+  } else {
+    window_ = SharedTableCache::Get<std::vector<double> >(
+        SharedTableCache::MakeKey("DataWindowing", window_key,
+                                  normalization_type),
+        make_window);
   }
 }
 
@@ -111,7 +137,7 @@ bool DataWindowing::Run(const std::vector<double>& data,
   }
 
   // Apply window.
-  std::transform(data.begin(), data.begin() + input_length_, window_.begin(),
+  std::transform(data.begin(), data.begin() + input_length_, window_->begin(),
                  windowed_data->begin(),
                  [](double x, double w) { return x * w; });
 
@@ -47,6 +47,7 @@
 #include <algorithm>  // std::fill
 #include <cmath>      // std::round
 
+#include "SPTK/utils/shared_table_cache.h"
 #include "SPTK/window/cosine_window.h"
 
 namespace {
@@ -128,69 +129,84 @@ void MakeTrapezoidal(bool periodic, std::vector<double>* window) {
   }
 }
 
-}  // namespace
-
-namespace sptk {
-
-StandardWindow::StandardWindow(int window_length, WindowType window_type,
-                               bool periodic)
-    : window_length_(window_length),
-      window_type_(window_type),
-      periodic_(periodic),
-      is_valid_(true) {
-  if (window_length_ <= 0) {
-    is_valid_ = false;
-    return;
-  }
-
-  window_.resize(window_length);
-  if (1 == window_length_) {
-    window_[0] = 1.0;
+void MakeWindow(sptk::StandardWindow::WindowType window_type, bool periodic,
+                std::vector<double>* window) {
+  if (1 == static_cast<int>(window->size())) {
+    (*window)[0] = 1.0;
     return;
   }
 
-  switch (window_type_) {
-    case WindowType::kBartlett: {
-      MakeBartlett(periodic_, &window_);
+  switch (window_type) {
+    case sptk::StandardWindow::WindowType::kBartlett: {
+      MakeBartlett(periodic, window);
       break;
     }
-    case WindowType::kBlackman: {
-      MakeBlackman(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kBlackman: {
+      MakeBlackman(periodic, window);
       break;
     }
-    case WindowType::kBlackmanHarris: {
-      MakeBlackmanHarris(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kBlackmanHarris: {
+      MakeBlackmanHarris(periodic, window);
       break;
     }
-    case WindowType::kBlackmanNuttall: {
-      MakeBlackmanNuttall(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kBlackmanNuttall: {
+      MakeBlackmanNuttall(periodic, window);
       break;
     }
-    case WindowType::kFlatTop: {
-      MakeFlatTop(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kFlatTop: {
+      MakeFlatTop(periodic, window);
       break;
     }
-    case WindowType::kHamming: {
-      MakeHamming(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kHamming: {
+      MakeHamming(periodic, window);
       break;
     }
-    case WindowType::kHanning: {
-      MakeHanning(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kHanning: {
+      MakeHanning(periodic, window);
       break;
     }
-    case WindowType::kNuttall: {
-      MakeNuttall(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kNuttall: {
+      MakeNuttall(periodic, window);
       break;
     }
-    case WindowType::kRectangular: {
-      MakeRectangular(&window_);
+    case sptk::StandardWindow::WindowType::kRectangular: {
+      MakeRectangular(window);
       break;
     }
-    case WindowType::kTrapezoidal: {
-      MakeTrapezoidal(periodic_, &window_);
+    case sptk::StandardWindow::WindowType::kTrapezoidal: {
+      MakeTrapezoidal(periodic, window);
       break;
     }
   }
 }
 
+}  // namespace
+
+namespace sptk {
+
+StandardWindow::StandardWindow(int window_length, WindowType window_type,
+                               bool periodic)
+    : window_length_(window_length),
+      window_type_(window_type),
+      periodic_(periodic),
+      is_valid_(true) {
+  if (window_length_ <= 0) {
+    is_valid_ = false;
+    window_.reset(new std::vector<double>());
+    return;
+  }
+
+  window_ = SharedTableCache::Get<std::vector<double> >(
+      GetCacheKey(), [window_length, window_type,
+                      periodic](std::vector<double>* window) {
+        window->resize(window_length);
+        MakeWindow(window_type, periodic, window);
+      });
+}
+
+std::string StandardWindow::GetCacheKey() const {
+  return SharedTableCache::MakeKey("StandardWindow", window_length_,
+                                   window_type_, periodic_);
+}
+
 }  // namespace sptk
@@ -83,6 +83,17 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "bcut: seekable input" {
+   $sptk3/nrand -l 20000 > tmp/1
+   for opt in "-s 3 -e 10" "-s 1000 -l 7" "-s 19999" "-s 20000" "-s 2856 -l 7" \
+              "-s 2857 -l 7"; do
+      cat tmp/1 | $sptk4/bcut +d $opt > tmp/2
+      $sptk4/bcut +d $opt tmp/1 > tmp/3
+      run cmp tmp/2 tmp/3
+      [ "$status" -eq 0 ]
+   done
+}
+
 @test "bcut: valgrind" {
    $sptk3/nrand -l 20 > tmp/1
    run valgrind $sptk4/bcut +d -s 1 -e 5 tmp/1
@@ -0,0 +1,75 @@
+#!/usr/bin/env bats
+# ----------------------------------------------------------------- #
+#             The Speech Signal Processing Toolkit (SPTK)           #
+#             developed by SPTK Working Group                       #
+#             http://sp-tk.sourceforge.net/                         #
+# ----------------------------------------------------------------- #
+#                                                                   #
+#  Copyright (c) 1984-2007  Tokyo Institute of Technology           #
+#                           Interdisciplinary Graduate School of    #
+#                           Science and Engineering                 #
+#                                                                   #
+#                1996-2021  Nagoya Institute of Technology          #
+#                           Department of Computer Science          #
+#                                                                   #
+# All rights reserved.                                              #
+#                                                                   #
+# Redistribution and use in source and binary forms, with or        #
+# without modification, are permitted provided that the following   #
+# conditions are met:                                               #
+#                                                                   #
+# - Redistributions of source code must retain the above copyright  #
+#   notice, this list of conditions and the following disclaimer.   #
+# - Redistributions in binary form must reproduce the above         #
+#   copyright notice, this list of conditions and the following     #
+#   disclaimer in the documentation and/or other materials provided #
+#   with the distribution.                                          #
+# - Neither the name of the SPTK working group nor the names of its #
+#   contributors may be used to endorse or promote products derived #
+#   from this software without specific prior written permission.   #
+#                                                                   #
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            #
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       #
+# INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          #
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          #
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS #
+# BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          #
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   #
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     #
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON #
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   #
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    #
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           #
+# POSSIBILITY OF SUCH DAMAGE.                                       #
+# ----------------------------------------------------------------- #
+
+sptk4=bin
+
+setup() {
+   mkdir -p tmp
+   ${CC:-cc} -std=c99 -Wall -I include test/test_capi.c -L lib -lsptk \
+      -Wl,-rpath,"$(pwd)"/lib -lm -o tmp/capi
+}
+
+teardown() {
+   rm -rf tmp
+}
+
+@test "capi: mgcep" {
+   $sptk4/nrand -l 20000 | $sptk4/frame -l 400 -p 80 > tmp/1
+   $sptk4/window -w 0 -l 400 -L 512 tmp/1 |
+      $sptk4/spec -l 512 -o 3 |
+      $sptk4/mgcep -l 512 -m 24 -a 0.42 -q 3 > tmp/2
+   run tmp/capi 400 512 24 0.42 < tmp/1
+   [ "$status" -eq 0 ]
+   tmp/capi 400 512 24 0.42 < tmp/1 > tmp/3
+   run $sptk4/aeq tmp/2 tmp/3
+   [ "$status" -eq 0 ]
+}
+
+@test "capi: exported symbols" {
+   run sh -c "nm -D --defined-only lib/libsptk.so | awk '{print \$3}' |
+      grep -v -e '^sptk_' -e '^SPTK_CAPI_'"
+   [ "$status" -eq 1 ]
+   [ -z "$output" ]
+}
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------- //
+//             The Speech Signal Processing Toolkit (SPTK)           //
+//             developed by SPTK Working Group                       //
+//             http://sp-tk.sourceforge.net/                         //
+// ----------------------------------------------------------------- //
+//                                                                   //
+//  Copyright (c) 1984-2007  Tokyo Institute of Technology           //
+//                           Interdisciplinary Graduate School of    //
+//                           Science and Engineering                 //
+//                                                                   //
+//                1996-2021  Nagoya Institute of Technology          //
+//                           Department of Computer Science          //
+//                                                                   //
+// All rights reserved.                                              //
+//                                                                   //
+// Redistribution and use in source and binary forms, with or        //
+// without modification, are permitted provided that the following   //
+// conditions are met:                                               //
+//                                                                   //
+// - Redistributions of source code must retain the above copyright  //
+//   notice, this list of conditions and the following disclaimer.   //
+// - Redistributions in binary form must reproduce the above         //
+//   copyright notice, this list of conditions and the following     //
+//   disclaimer in the documentation and/or other materials provided //
+//   with the distribution.                                          //
+// - Neither the name of the SPTK working group nor the names of its //
+//   contributors may be used to endorse or promote products derived //
+//   from this software without specific prior written permission.   //
+//                                                                   //
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            //
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       //
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          //
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          //
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS //
+// BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          //
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   //
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     //
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON //
+// ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   //
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    //
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           //
+// POSSIBILITY OF SUCH DAMAGE.                                       //
+// ----------------------------------------------------------------- //
+
+
+/*
+ * Window frames, compute their power spectra, and analyze them into
+ * mel-cepstra through the C interface of libsptk.so. This is a test program
+ * equivalent to
+ *   window -w 0 -l L -L N | spec -l N -o 3 | mgcep -l N -m M -a A -q 3
+ */
+
+#include <stdio.h>  /* fread, fwrite */
+#include <stdlib.h> /* atof, atoi, malloc */
+
+#include "SPTK/capi/sptk_capi.h"
+
+int main(int argc, char* argv[]) {
+  int frame_length, fft_length, num_order, spectrum_length, num_frame;
+  double alpha;
+  sptk_window* window = NULL;
+  sptk_window_buffer* window_buffer = NULL;
+  sptk_spectrum* spectrum = NULL;
+  sptk_spectrum_buffer* spectrum_buffer = NULL;
+  sptk_mgcep* mgcep = NULL;
+  sptk_mgcep_buffer* mgcep_buffer = NULL;
+  double *frame, *windowed_frame, *power_spectrum, *cepstrum;
+  int status = 1;
+
+  if (5 != argc) {
+    fprintf(stderr, "usage: %s frame_length fft_length order alpha\n",
+            argv[0]);
+    return 1;
+  }
+  frame_length = atoi(argv[1]);
+  fft_length = atoi(argv[2]);
+  num_order = atoi(argv[3]);
+  alpha = atof(argv[4]);
+  spectrum_length = fft_length / 2 + 1;
+
+  if (SPTK_CAPI_VERSION != sptk_get_capi_version() ||
+      SPTK_SUCCESS != sptk_window_create(frame_length, fft_length,
+                                         SPTK_WINDOW_BLACKMAN,
+                                         SPTK_NORMALIZATION_POWER, 0,
+                                         &window) ||
+      SPTK_SUCCESS != sptk_window_buffer_create(&window_buffer) ||
+      SPTK_SUCCESS != sptk_spectrum_create(fft_length, fft_length,
+                                           SPTK_SPECTRUM_POWER, 0.0, -1.7e308,
+                                           &spectrum) ||
+      SPTK_SUCCESS != sptk_spectrum_buffer_create(&spectrum_buffer) ||
+      SPTK_SUCCESS != sptk_mgcep_create(fft_length, num_order, alpha, 0.0, 30,
+                                        1e-3, &mgcep) ||
+      SPTK_SUCCESS != sptk_mgcep_buffer_create(&mgcep_buffer) ||
+      frame_length != sptk_window_get_input_length(window) ||
+      spectrum_length != sptk_spectrum_get_output_length(spectrum) ||
+      num_order + 1 != sptk_mgcep_get_output_length(mgcep)) {
+    fprintf(stderr, "%s: Failed to create handles\n", argv[0]);
+    return 1;
+  }
+
+  frame = (double*)malloc(sizeof(double) * frame_length);
+  windowed_frame = (double*)malloc(sizeof(double) * fft_length);
+  power_spectrum = (double*)malloc(sizeof(double) * spectrum_length);
+  cepstrum = (double*)malloc(sizeof(double) * (num_order + 1));
+  if (NULL == frame || NULL == windowed_frame || NULL == power_spectrum ||
+      NULL == cepstrum) {
+    return 1;
+  }
+
+  /* Process one frame per call so that the buffers are reused. */
+  for (num_frame = 0;
+       fread(frame, sizeof(double), frame_length, stdin) ==
+       (size_t)frame_length;
+       ++num_frame) {
+    if (SPTK_SUCCESS != sptk_window_run(window, window_buffer, frame, 1,
+                                        windowed_frame) ||
+        SPTK_SUCCESS != sptk_spectrum_run(spectrum, spectrum_buffer,
+                                          windowed_frame, 1, power_spectrum) ||
+        SPTK_SUCCESS != sptk_mgcep_run(mgcep, mgcep_buffer, power_spectrum, 1,
+                                       cepstrum)) {
+      fprintf(stderr, "%s: Failed to process frame %d\n", argv[0], num_frame);
+      break;
+    }
+    fwrite(cepstrum, sizeof(double), num_order + 1, stdout);
+  }
+  if (feof(stdin)) {
+    status = 0;
+  }
+
+  free(cepstrum);
+  free(power_spectrum);
+  free(windowed_frame);
+  free(frame);
+  sptk_mgcep_buffer_destroy(mgcep_buffer);
+  sptk_mgcep_destroy(mgcep);
+  sptk_spectrum_buffer_destroy(spectrum_buffer);
+  sptk_spectrum_destroy(spectrum);
+  sptk_window_buffer_destroy(window_buffer);
+  sptk_window_destroy(window);
+
+  return status;
+}
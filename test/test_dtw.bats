@@ -72,6 +72,23 @@ teardown() {
    done
 }
 
+@test "dtw: threads option" {
+   $sptk3/nrand -s 1 -l 600 > tmp/0_q
+   $sptk3/nrand -s 2 -l 400 > tmp/0_r
+
+   for p in $(seq 0 6); do
+      $sptk4/dtw -l 2 -p $p tmp/0_r tmp/0_q -S tmp/1_s > tmp/1
+      $sptk4/dtw -T 4 -l 2 -p $p tmp/0_r tmp/0_q -S tmp/2_s > tmp/2
+      run cmp tmp/1 tmp/2
+      [ "$status" -eq 0 ]
+      run cmp tmp/1_s tmp/2_s
+      [ "$status" -eq 0 ]
+   done
+
+   run $sptk4/dtw -T 0 -l 2 tmp/0_r tmp/0_q
+   [ "$status" -ne 0 ]
+}
+
 @test "dtw: valgrind" {
    $sptk3/nrand -l 20 > tmp/0
    run valgrind $sptk4/dtw -l 2 -p 4 tmp/0 tmp/0
@@ -69,6 +69,30 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "excite: negative pitch" {
+   # The output stops at the first negative pitch as in the sample-by-sample
+   # generation, and the pitch after that is never used.
+   echo 20 20 20 -1 20 20 | $sptk3/x2x +ad > tmp/1
+   $sptk4/excite -p 10 tmp/1 > tmp/2
+   z="0 0 0 0 0 0 0 0"
+   echo 4.47213595499958 $z $z 0 0 0 4.47213595499958 $z 1.04880884817015 |
+      $sptk3/x2x +ad > tmp/3
+   run $sptk4/aeq tmp/2 tmp/3
+   [ "$status" -eq 0 ]
+
+   echo 0 0 -1 0 0 | $sptk3/x2x +ad > tmp/1
+   $sptk4/excite -p 10 tmp/1 > tmp/2
+   [ "$(wc -c < tmp/2)" -eq 160 ]
+}
+
+@test "excite: m-sequence" {
+   # The noise in unvoiced frames is the M-sequence.
+   $sptk3/step -l 101 -v 0 | $sptk4/excite -p 100 -i 0 > tmp/1
+   $sptk4/mseq -l 10001 > tmp/2
+   run cmp tmp/1 tmp/2
+   [ "$status" -eq 0 ]
+}
+
 @test "excite: valgrind" {
    $sptk3/ramp -l 10 > tmp/1
    run valgrind $sptk4/excite -p 2 tmp/1
@@ -62,6 +62,22 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "extract: seekable input" {
+   # The input length is not a multiple of the vector length.
+   $sptk3/nrand -s 123 -l 20002 > tmp/1
+   for l in 1 3 4 7; do
+      # More indices than input vectors.
+      $sptk3/nrand -s 234 -l $((20002 / l + 5)) | $sptk3/sopr -ABS -m 3 | \
+         $sptk3/x2x +di > tmp/2
+      for i in 0 3 7; do
+         cat tmp/1 | $sptk4/extract -l $l -i $i tmp/2 > tmp/3
+         $sptk4/extract -l $l -i $i tmp/2 tmp/1 > tmp/4
+         run cmp tmp/3 tmp/4
+         [ "$status" -eq 0 ]
+      done
+   done
+}
+
 @test "extract: valgrind" {
    $sptk3/step -l 4 | $sptk3/x2x +di > tmp/1
    $sptk3/nrand -l 4 > tmp/2
@@ -0,0 +1,143 @@
+#!/usr/bin/env bats
+# ----------------------------------------------------------------- #
+#             The Speech Signal Processing Toolkit (SPTK)           #
+#             developed by SPTK Working Group                       #
+#             http://sp-tk.sourceforge.net/                         #
+# ----------------------------------------------------------------- #
+#                                                                   #
+#  Copyright (c) 1984-2007  Tokyo Institute of Technology           #
+#                           Interdisciplinary Graduate School of    #
+#                           Science and Engineering                 #
+#                                                                   #
+#                1996-2021  Nagoya Institute of Technology          #
+#                           Department of Computer Science          #
+#                                                                   #
+# All rights reserved.                                              #
+#                                                                   #
+# Redistribution and use in source and binary forms, with or        #
+# without modification, are permitted provided that the following   #
+# conditions are met:                                               #
+#                                                                   #
+# - Redistributions of source code must retain the above copyright  #
+#   notice, this list of conditions and the following disclaimer.   #
+# - Redistributions in binary form must reproduce the above         #
+#   copyright notice, this list of conditions and the following     #
+#   disclaimer in the documentation and/or other materials provided #
+#   with the distribution.                                          #
+# - Neither the name of the SPTK working group nor the names of its #
+#   contributors may be used to endorse or promote products derived #
+#   from this software without specific prior written permission.   #
+#                                                                   #
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            #
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       #
+# INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          #
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          #
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS #
+# BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          #
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   #
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     #
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON #
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   #
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    #
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           #
+# POSSIBILITY OF SUCH DAMAGE.                                       #
+# ----------------------------------------------------------------- #
+
+sptk3=tools/sptk/bin
+sptk4=bin
+
+setup() {
+   mkdir -p tmp
+}
+
+teardown() {
+   rm -rf tmp
+}
+
+@test "fcont: identity" {
+   $sptk3/nrand -l 250 > tmp/1
+   $sptk4/fcont -l 5 -p 80 -s 16 tmp/1 > tmp/2
+   $sptk4/fcont -o 1 -l 5 tmp/2 > tmp/3
+   run cmp tmp/1 tmp/3
+   [ "$status" -eq 0 ]
+}
+
+@test "fcont: chunk" {
+   $sptk3/nrand -l 250 > tmp/1
+   echo 10 20 | $sptk3/x2x +ai > tmp/2
+   $sptk4/fcont -l 5 -c tmp/2 tmp/1 > tmp/3
+   $sptk4/bcut -l 5 -s 10 -e 29 tmp/1 > tmp/4
+   $sptk4/fcont -o 1 -u 1 tmp/3 > tmp/5
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+
+   $sptk4/bcut -l 5 -s 30 tmp/1 > tmp/4
+   $sptk4/fcont -o 1 -u 2 tmp/3 > tmp/5
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+
+   run $sptk4/fcont -o 1 -l 4 tmp/3
+   [ "$status" -eq 1 ]
+}
+
+@test "fcont: transparent input" {
+   $sptk3/nrand -l 250 > tmp/1
+   echo 10 20 | $sptk3/x2x +ai > tmp/2
+   $sptk4/fcont -l 5 -c tmp/2 tmp/1 > tmp/3
+   $sptk4/vstat -l 5 tmp/1 > tmp/4
+   $sptk4/vstat -l 5 tmp/3 > tmp/5
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+   cat tmp/3 | $sptk4/vstat -l 5 > tmp/5
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+
+   # Seeking is limited to the frames.
+   $sptk4/reverse tmp/1 > tmp/4
+   $sptk4/reverse tmp/3 > tmp/5
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+
+   # Data type of different size.
+   run sh -c "$sptk4/x2x +fd tmp/3 > tmp/5"
+   [ "$status" -eq 1 ]
+   [ ! -s tmp/5 ]
+}
+
+@test "fcont: element size mismatch" {
+   $sptk3/nrand -l 20 | $sptk4/x2x +df > tmp/1
+   $sptk4/fcont -l 2 +f tmp/1 > tmp/2
+   run sh -c "$sptk4/sopr -m 2 tmp/2 > tmp/3"
+   [ "$status" -eq 1 ]
+   [ "$output" = "sopr: Element size mismatch (8 bytes expected, 4 bytes given)!" ]
+   [ ! -s tmp/3 ]
+   run sh -c "cat tmp/2 | $sptk4/vstat -l 2 > tmp/3"
+   [ "$status" -eq 1 ]
+   [ ! -s tmp/3 ]
+   $sptk4/x2x +fd tmp/2 > tmp/3
+   $sptk4/x2x +fd tmp/1 > tmp/4
+   run cmp tmp/3 tmp/4
+   [ "$status" -eq 0 ]
+}
+
+@test "fcont: broken index" {
+   echo 1 | $sptk3/x2x +ad > tmp/1
+   $sptk4/fcont -l 1 tmp/1 > tmp/2
+   # Number of frames which overflows when multiplied by the frame size.
+   head -c 88 tmp/2 > tmp/3
+   printf '\x01\x00\x00\x00\x00\x00\x00\x20' >> tmp/3
+   tail -c 16 tmp/2 >> tmp/3
+   run $sptk4/fcont -o 2 tmp/3
+   [ "$status" -eq 1 ]
+   run sh -c "cat tmp/3 | $sptk4/x2x +dd > tmp/4"
+   [ "$status" -eq 1 ]
+   [ "$output" = "x2x: Broken feature container!" ]
+   [ ! -s tmp/4 ]
+}
+
+@test "fcont: valgrind" {
+   $sptk3/nrand -l 20 > tmp/1
+   valgrind $sptk4/fcont -l 2 tmp/1 > tmp/2
+   run valgrind $sptk4/fcont -o 1 tmp/2
+   [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
+}
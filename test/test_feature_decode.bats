@@ -0,0 +1,127 @@
+#!/usr/bin/env bats
+# ----------------------------------------------------------------- #
+#             The Speech Signal Processing Toolkit (SPTK)           #
+#             developed by SPTK Working Group                       #
+#             http://sp-tk.sourceforge.net/                         #
+# ----------------------------------------------------------------- #
+#                                                                   #
+#  Copyright (c) 1984-2007  Tokyo Institute of Technology           #
+#                           Interdisciplinary Graduate School of    #
+#                           Science and Engineering                 #
+#                                                                   #
+#                1996-2021  Nagoya Institute of Technology          #
+#                           Department of Computer Science          #
+#                                                                   #
+# All rights reserved.                                              #
+#                                                                   #
+# Redistribution and use in source and binary forms, with or        #
+# without modification, are permitted provided that the following   #
+# conditions are met:                                               #
+#                                                                   #
+# - Redistributions of source code must retain the above copyright  #
+#   notice, this list of conditions and the following disclaimer.   #
+# - Redistributions in binary form must reproduce the above         #
+#   copyright notice, this list of conditions and the following     #
+#   disclaimer in the documentation and/or other materials provided #
+#   with the distribution.                                          #
+# - Neither the name of the SPTK working group nor the names of its #
+#   contributors may be used to endorse or promote products derived #
+#   from this software without specific prior written permission.   #
+#                                                                   #
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            #
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       #
+# INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          #
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          #
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS #
+# BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          #
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   #
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     #
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON #
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   #
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    #
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           #
+# POSSIBILITY OF SUCH DAMAGE.                                       #
+# ----------------------------------------------------------------- #
+
+sptk3=tools/sptk/bin
+sptk4=bin
+
+setup() {
+   mkdir -p tmp
+}
+
+teardown() {
+   rm -rf tmp
+}
+
+@test "feature_decode: chunk" {
+   $sptk3/nrand -l 1000 > tmp/1
+   $sptk4/feature_encode -l 10 -c 7 tmp/1 > tmp/2
+   $sptk4/feature_decode -s 3 -e 5 tmp/2 > tmp/3
+   $sptk4/bcut -l 10 -s 21 -e 41 tmp/1 > tmp/4
+   run cmp tmp/3 tmp/4
+   [ "$status" -eq 0 ]
+}
+
+@test "feature_decode: transparent input" {
+   $sptk3/nrand -l 1000 > tmp/1
+   $sptk4/feature_encode -l 10 -c 7 tmp/1 > tmp/2
+   $sptk4/vstat -l 10 tmp/1 > tmp/3
+   $sptk4/vstat -l 10 tmp/2 > tmp/4
+   run cmp tmp/3 tmp/4
+   [ "$status" -eq 0 ]
+   cat tmp/2 | $sptk4/x2x +dd > tmp/4
+   run cmp tmp/1 tmp/4
+   [ "$status" -eq 0 ]
+
+   $sptk4/x2x +df tmp/1 > tmp/3
+   $sptk4/feature_encode -l 10 +f tmp/3 > tmp/4
+   $sptk4/x2x +ff tmp/4 > tmp/5
+   run cmp tmp/3 tmp/5
+   [ "$status" -eq 0 ]
+}
+
+@test "feature_decode: broken chunk" {
+   echo 1 | $sptk3/x2x +ad | $sptk4/feature_encode > tmp/1
+   # Too many frames of constant planes.
+   head -c 20 tmp/1 > tmp/2
+   printf '\xff\xff\xff\x7f\x10\x00\x00\x00' >> tmp/2
+   for i in $(seq 8); do
+      printf '\x01\x00' >> tmp/2
+   done
+   run $sptk4/feature_decode tmp/2
+   [ "$status" -eq 1 ]
+   run sh -c "$sptk4/x2x +dd tmp/2 > tmp/3"
+   [ "$status" -eq 1 ]
+   [ "$output" = "x2x: Broken encoded stream!" ]
+   [ ! -s tmp/3 ]
+
+   # Chunk larger than the encoder ever writes.
+   head -c 20 tmp/1 > tmp/2
+   printf '\x01\x00\x00\x00\xff\xff\xff\x7f' >> tmp/2
+   run $sptk4/feature_decode tmp/2
+   [ "$status" -eq 1 ]
+}
+
+@test "feature_decode: truncated input" {
+   $sptk3/nrand -l 1000 > tmp/1
+   $sptk4/feature_encode -l 10 -c 7 tmp/1 > tmp/2
+   head -c 1000 tmp/2 > tmp/3
+   run sh -c "$sptk4/sopr -m 1 tmp/3 > tmp/4"
+   [ "$status" -eq 1 ]
+   [ "$output" = "sopr: Broken encoded stream!" ]
+   # The decoded chunks are passed before the error.
+   $sptk4/bcut -l 10 -e 6 tmp/1 > tmp/5
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+
+   run sh -c "cat tmp/3 | $sptk4/vstat -l 10 > tmp/4"
+   [ "$status" -eq 1 ]
+   [ "$output" = "vstat: Broken encoded stream!" ]
+}
+
+@test "feature_decode: valgrind" {
+   $sptk3/nrand -l 100 | $sptk4/feature_encode -l 5 -c 3 > tmp/1
+   run valgrind $sptk4/feature_decode tmp/1
+   [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
+}
@@ -71,6 +71,43 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "fft: SIMD variants" {
+   $sptk3/nrand -l 1000 > tmp/1
+   SPTK_SIMD=scalar $sptk4/fft -l 256 tmp/1 > tmp/2
+   for simd in sse2 avx2 avx512 neon check; do
+      SPTK_SIMD=$simd $sptk4/fft -l 256 tmp/1 > tmp/3 2> tmp/4
+      # A variant not supported by the host falls back with a warning.
+      if [ -s tmp/4 ]; then continue; fi
+      run $sptk4/aeq tmp/2 tmp/3
+      [ "$status" -eq 0 ]
+   done
+}
+
+@test "fft: wisdom" {
+   $sptk3/nrand -l 1000 > tmp/1
+   SPTK_FFT_PLANNING=estimate $sptk4/fft -l 256 tmp/1 > tmp/2
+
+   # Nothing is measured unless it is requested.
+   SPTK_FFT_WISDOM=tmp/wisdom $sptk4/fft -l 256 tmp/1 > tmp/3
+   [ ! -e tmp/wisdom ]
+
+   SPTK_FFT_PLANNING=measure SPTK_FFT_WISDOM=tmp/wisdom \
+      $sptk4/fft -l 256 tmp/1 > tmp/3
+   SPTK_FFT_WISDOM=tmp/wisdom $sptk4/fft -l 256 tmp/1 > tmp/4
+   run cmp tmp/2 tmp/3
+   [ "$status" -eq 0 ]
+   run cmp tmp/2 tmp/4
+   [ "$status" -eq 0 ]
+   run grep -c "^complex 256 " tmp/wisdom
+   [ "$output" -eq 1 ]
+
+   # Plans of other lengths are merged into the file.
+   SPTK_FFT_PLANNING=measure SPTK_FFT_WISDOM=tmp/wisdom \
+      $sptk4/fft -l 64 tmp/1 > /dev/null
+   run grep -c "^complex \(64\|256\) " tmp/wisdom
+   [ "$output" -eq 2 ]
+}
+
 @test "fft: valgrind" {
    $sptk3/nrand -l 20 > tmp/1
    run valgrind $sptk4/fft -m 4 -l 8 tmp/1
@@ -71,6 +71,17 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "fftr: wisdom" {
+   $sptk3/nrand -l 1000 > tmp/1
+   SPTK_FFT_PLANNING=estimate $sptk4/fftr -l 256 tmp/1 > tmp/2
+   for p in half full; do
+      echo "real 256 $p" > tmp/wisdom
+      SPTK_FFT_WISDOM=tmp/wisdom $sptk4/fftr -l 256 tmp/1 > tmp/3
+      run $sptk4/aeq tmp/2 tmp/3
+      [ "$status" -eq 0 ]
+   done
+}
+
 @test "fftr: valgrind" {
    $sptk3/nrand -l 32 > tmp/1
    run valgrind $sptk4/fftr -l 16 tmp/1
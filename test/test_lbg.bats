@@ -77,6 +77,21 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "lbg: threads option" {
+   # Enough vectors to be split into several chunks.
+   $sptk3/nrand -s 234 -l 20000 > tmp/1
+   $sptk4/lbg -l 4 -e 32 -i 20 -I tmp/2 < tmp/1 > tmp/3
+   $sptk4/lbg -T 8 -l 4 -e 32 -i 20 -I tmp/4 < tmp/1 > tmp/5
+   # The distance reduction gives the same bits for any number of threads.
+   run cmp tmp/3 tmp/5
+   [ "$status" -eq 0 ]
+   run cmp tmp/2 tmp/4
+   [ "$status" -eq 0 ]
+
+   run $sptk4/lbg -T 0 -l 4 -e 32 tmp/1
+   [ "$status" -ne 0 ]
+}
+
 @test "lbg: valgrind" {
    $sptk3/nrand -l 512 > tmp/1
    run valgrind $sptk4/lbg -l 4 -e 8 -i 10 tmp/1
@@ -75,6 +75,31 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "levdur: error in block" {
+   $sptk3/nrand -l 1000 | $sptk4/acorr -l 10 -m 2 > tmp/1
+   $sptk3/bcut +d -l 3 -e 39 tmp/1 > tmp/2
+   $sptk4/levdur -m 2 tmp/2 > tmp/3
+
+   # Insert an unstable frame in the middle of a block.
+   cp tmp/2 tmp/4
+   echo 1 2 0 | $sptk3/x2x +ad >> tmp/4
+   $sptk3/bcut +d -l 3 -s 41 tmp/1 >> tmp/4
+   run sh -c "$sptk4/levdur -m 2 -e 2 tmp/4 > tmp/5"
+   [ "$status" -eq 1 ]
+   [ "$output" = "levdur: 40th frame is unstable!" ]
+   run cmp tmp/3 tmp/5
+   [ "$status" -eq 0 ]
+
+   # Insert a frame that cannot be solved.
+   cp tmp/2 tmp/4
+   echo 0 0 0 | $sptk3/x2x +ad >> tmp/4
+   $sptk3/bcut +d -l 3 -s 41 tmp/1 >> tmp/4
+   run sh -c "$sptk4/levdur -m 2 tmp/4 > tmp/5"
+   [ "$status" -eq 1 ]
+   run cmp tmp/3 tmp/5
+   [ "$status" -eq 0 ]
+}
+
 @test "levdur: valgrind" {
    $sptk3/nrand -l 20 > tmp/1
    run valgrind $sptk4/levdur -m 9 tmp/1
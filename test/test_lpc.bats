@@ -61,6 +61,21 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "lpc: error in block" {
+   $sptk3/nrand -l 1000 > tmp/1
+   $sptk3/bcut +d -l 10 -e 39 tmp/1 > tmp/2
+   $sptk4/lpc -l 10 -m 4 tmp/2 > tmp/3
+
+   # Insert a silent frame in the middle of a block.
+   cp tmp/2 tmp/4
+   $sptk3/step -l 10 -v 0 >> tmp/4
+   $sptk3/bcut +d -l 10 -s 41 tmp/1 >> tmp/4
+   run sh -c "$sptk4/lpc -l 10 -m 4 tmp/4 > tmp/5"
+   [ "$status" -eq 1 ]
+   run cmp tmp/3 tmp/5
+   [ "$status" -eq 0 ]
+}
+
 @test "lpc: valgrind" {
    $sptk3/nrand -l 20 > tmp/1
    run valgrind $sptk4/lpc -l 10 -m 4 tmp/1
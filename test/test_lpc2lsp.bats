@@ -83,6 +83,15 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "lpc2lsp: search around previous frame" {
+   $sptk3/nrand -l 8000 | $sptk3/frame -l 400 -p 80 | \
+      $sptk3/lpc -l 400 -m 12 > tmp/1
+   $sptk4/lpc2lsp -m 12 tmp/1 > tmp/2
+   $sptk4/lpc2lsp -m 12 -c tmp/1 > tmp/3
+   run $sptk4/aeq -t 1e-4 tmp/2 tmp/3
+   [ "$status" -eq 0 ]
+}
+
 @test "lpc2lsp: valgrind" {
    $sptk3/nrand -l 800 | $sptk3/lpc -l 400 -m 12 > tmp/1
    run valgrind $sptk4/lpc2lsp -m 12 tmp/1
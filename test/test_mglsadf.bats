@@ -84,6 +84,19 @@ teardown() {
    done
 }
 
+@test "mglsadf: SIMD variants" {
+   $sptk3/nrand -l 250 | $sptk3/sopr -m 0.1 > tmp/1
+   $sptk3/nrand -l 800 > tmp/2
+   SPTK_SIMD=scalar $sptk4/mglsadf -m 24 -p 80 -i 0 tmp/1 tmp/2 > tmp/3
+   for simd in sse2 avx2 avx512 neon check; do
+      SPTK_SIMD=$simd $sptk4/mglsadf -m 24 -p 80 -i 0 tmp/1 tmp/2 > tmp/4 2> tmp/5
+      # A variant not supported by the host falls back with a warning.
+      if [ -s tmp/5 ]; then continue; fi
+      run cmp tmp/3 tmp/4
+      [ "$status" -eq 0 ]
+   done
+}
+
 @test "mglsadf: valgrind" {
    $sptk3/nrand -l 10 > tmp/1
    $sptk3/nrand -l 10 > tmp/2
@@ -81,10 +81,26 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "mlpg: sliding window" {
+   # Make 1000 frames of pdf.
+   $sptk3/nrand -s 1 -l 10000 > tmp/1
+   $sptk3/nrand -s 2 -l 10000 | $sptk3/sopr -ABS -m 0.01 > tmp/2
+   $sptk3/merge +d -l 10 -L 10 tmp/1 tmp/2 > tmp/3
+
+   # The maximum absolute error from the non-recursive MLPG, which solves the
+   # same system over the whole sequence, is about 4e-12 at f = 40.
+   $sptk4/mlpg -l 5 -d -0.5 0 0.5 -R 1 tmp/3 > tmp/4
+   $sptk4/mlpg -l 5 -d -0.5 0 0.5 -R 2 -f 40 tmp/3 > tmp/5
+   run $sptk4/aeq -t 1e-9 tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+}
+
 @test "mlpg: valgrind" {
    $sptk3/nrand -l 20 | $sptk3/sopr -ABS > tmp/1
    run valgrind $sptk4/mlpg -l 2 -R 0 tmp/1
    [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
    run valgrind $sptk4/mlpg -l 2 -R 1 tmp/1
    [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
+   run valgrind $sptk4/mlpg -l 2 -R 2 -f 2 tmp/1
+   [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
 }
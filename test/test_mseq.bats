@@ -61,6 +61,35 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "mseq: baseline" {
+   # Run the shift register of X**31 + X**28 + 1 sample by sample as the
+   # original implementation does.
+   awk 'BEGIN {
+      x = 1431655765
+      for (i = 0; i < 100000; i++) {
+         x = int(x / 2)
+         x0 = x % 2 ? 1 : -1
+         x28 = int(x / 268435456) % 2 ? 1 : -1
+         if (x0 + x28) {
+            x %= 2147483648
+         } else if (x < 2147483648) {
+            x += 2147483648
+         }
+         print x0
+      }
+   }' | $sptk3/x2x +ad > tmp/1
+   $sptk4/mseq -l 100000 > tmp/2
+   run cmp tmp/1 tmp/2
+   [ "$status" -eq 0 ]
+}
+
+@test "mseq: block consistency" {
+   $sptk4/mseq -l 5000 | $sptk4/bcut -e 99 > tmp/1
+   $sptk4/mseq -l 100 > tmp/2
+   run $sptk4/aeq tmp/1 tmp/2
+   [ "$status" -eq 0 ]
+}
+
 @test "mseq: valgrind" {
    run valgrind $sptk4/mseq -l 10
    [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
@@ -68,6 +68,35 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "msvq: SIMD variants" {
+   $sptk3/nrand -l 320 > tmp/1
+   $sptk3/nrand -l 800 > tmp/2
+   SPTK_SIMD=scalar $sptk4/msvq -s tmp/1 -l 10 tmp/2 > tmp/3
+   for simd in sse2 avx2 avx512 neon check; do
+      # Indices are compared exactly.
+      SPTK_SIMD=$simd $sptk4/msvq -s tmp/1 -l 10 tmp/2 > tmp/4 2> tmp/5
+      # A variant not supported by the host falls back with a warning.
+      if [ -s tmp/5 ]; then continue; fi
+      run cmp tmp/3 tmp/4
+      [ "$status" -eq 0 ]
+   done
+}
+
+@test "msvq: threads option" {
+   $sptk3/nrand -s 123 -l 64 > tmp/1
+   $sptk3/nrand -s 234 -l 64 > tmp/2
+   # More vectors than one block of 8 threads, the last block being partial.
+   $sptk3/nrand -s 345 -l 20004 > tmp/3
+   $sptk4/msvq -s tmp/1 -s tmp/2 -l 4 tmp/3 > tmp/4
+   $sptk4/msvq -T 8 -s tmp/1 -s tmp/2 -l 4 tmp/3 > tmp/5
+   # Indices keep the input order.
+   run cmp tmp/4 tmp/5
+   [ "$status" -eq 0 ]
+
+   run $sptk4/msvq -T 0 -s tmp/1 -l 4 tmp/3
+   [ "$status" -ne 0 ]
+}
+
 @test "msvq: valgrind" {
    $sptk3/nrand -l 32 > tmp/1
    $sptk3/nrand -l 8 > tmp/2
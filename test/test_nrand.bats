@@ -61,7 +61,16 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "nrand: statistics of ziggurat method" {
+   $sptk4/nrand -g 1 -l 100000 -u 2 -d 0.5 -s 123 | $sptk4/vstat -o 1 > tmp/1
+   echo 2 | $sptk4/x2x +ad > tmp/2
+   run $sptk4/aeq -t 0.01 tmp/1 tmp/2
+   [ "$status" -eq 0 ]
+}
+
 @test "nrand: valgrind" {
    run valgrind $sptk4/nrand -l 10
    [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
+   run valgrind $sptk4/nrand -g 1 -l 10
+   [ $(echo "${lines[-1]}" | sed -r 's/.*SUMMARY: ([0-9]*) .*/\1/') -eq 0 ]
 }
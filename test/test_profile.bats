@@ -0,0 +1,116 @@
+#!/usr/bin/env bats
+# ----------------------------------------------------------------- #
+#             The Speech Signal Processing Toolkit (SPTK)           #
+#             developed by SPTK Working Group                       #
+#             http://sp-tk.sourceforge.net/                         #
+# ----------------------------------------------------------------- #
+#                                                                   #
+#  Copyright (c) 1984-2007  Tokyo Institute of Technology           #
+#                           Interdisciplinary Graduate School of    #
+#                           Science and Engineering                 #
+#                                                                   #
+#                1996-2021  Nagoya Institute of Technology          #
+#                           Department of Computer Science          #
+#                                                                   #
+# All rights reserved.                                              #
+#                                                                   #
+# Redistribution and use in source and binary forms, with or        #
+# without modification, are permitted provided that the following   #
+# conditions are met:                                               #
+#                                                                   #
+# - Redistributions of source code must retain the above copyright  #
+#   notice, this list of conditions and the following disclaimer.   #
+# - Redistributions in binary form must reproduce the above         #
+#   copyright notice, this list of conditions and the following     #
+#   disclaimer in the documentation and/or other materials provided #
+#   with the distribution.                                          #
+# - Neither the name of the SPTK working group nor the names of its #
+#   contributors may be used to endorse or promote products derived #
+#   from this software without specific prior written permission.   #
+#                                                                   #
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            #
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       #
+# INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          #
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          #
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS #
+# BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          #
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   #
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     #
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON #
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   #
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    #
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           #
+# POSSIBILITY OF SUCH DAMAGE.                                       #
+# ----------------------------------------------------------------- #
+
+sptk3=tools/sptk/bin
+sptk4=bin
+
+setup() {
+   mkdir -p tmp
+}
+
+teardown() {
+   rm -rf tmp
+}
+
+# Check that the file has one JSON line with the counters of sopr reading and
+# writing 100 doubles.
+check_profile() {
+   [ "$(wc -l < "$1")" -eq "$2" ]
+   run grep -c '^{"pid": [0-9]*, "profile": \[.*\]}$' "$1"
+   [ "$output" -eq "$2" ]
+   run grep -c '{"name": "ReadStream", "calls": 101, "seconds": [0-9.e-]*, "frames": 0, "bytes_read": 800, "bytes_written": 0, "iterations": 0}' "$1"
+   [ "$output" -eq "$2" ]
+   run grep -c '{"name": "WriteStream", "calls": 100, "seconds": [0-9.e-]*, "frames": 0, "bytes_read": 0, "bytes_written": 800, "iterations": 0}' "$1"
+   [ "$output" -eq "$2" ]
+}
+
+@test "profile: option" {
+   $sptk3/nrand -l 100 > tmp/0
+   $sptk4/sopr -m 2 tmp/0 > tmp/1 2> tmp/2
+   [ ! -s tmp/2 ]
+
+   # The output does not change and the profile goes to the standard error.
+   $sptk4/sopr --profile -m 2 tmp/0 > tmp/3 2> tmp/4
+   run cmp tmp/1 tmp/3
+   [ "$status" -eq 0 ]
+   check_profile tmp/4 1
+}
+
+@test "profile: option with file" {
+   $sptk3/nrand -l 100 > tmp/0
+   $sptk4/sopr -m 2 tmp/0 > tmp/1
+
+   # Each run appends one line to the file.
+   $sptk4/sopr --profile=tmp/2 -m 2 tmp/0 > tmp/3 2> tmp/4
+   $sptk4/sopr -m 2 --profile=tmp/2 tmp/0 > tmp/5 2>> tmp/4
+   [ ! -s tmp/4 ]
+   run cmp tmp/1 tmp/3
+   [ "$status" -eq 0 ]
+   run cmp tmp/1 tmp/5
+   [ "$status" -eq 0 ]
+   check_profile tmp/2 2
+}
+
+@test "profile: environment variable" {
+   $sptk3/nrand -l 100 > tmp/0
+   $sptk4/sopr -m 2 tmp/0 > tmp/1
+
+   SPTK_PROFILE=tmp/2 $sptk4/sopr -m 2 tmp/0 > tmp/3 2> tmp/4
+   [ ! -s tmp/4 ]
+   run cmp tmp/1 tmp/3
+   [ "$status" -eq 0 ]
+   check_profile tmp/2 1
+
+   SPTK_PROFILE=stderr $sptk4/sopr -m 2 tmp/0 > tmp/5 2> tmp/6
+   run cmp tmp/1 tmp/5
+   [ "$status" -eq 0 ]
+   check_profile tmp/6 1
+
+   # Zero disables profiling.
+   SPTK_PROFILE=0 $sptk4/sopr -m 2 tmp/0 > tmp/7 2> tmp/8
+   [ ! -s tmp/8 ]
+   run cmp tmp/1 tmp/7
+   [ "$status" -eq 0 ]
+}
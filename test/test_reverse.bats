@@ -73,6 +73,24 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "reverse: seekable input" {
+   # Lengths around the size of the chunk read at a time.
+   for l in 1 4095 4096 4097 20001; do
+      $sptk3/nrand -l $l > tmp/1
+      cat tmp/1 | $sptk4/reverse > tmp/2
+      $sptk4/reverse tmp/1 > tmp/3
+      run cmp tmp/2 tmp/3
+      [ "$status" -eq 0 ]
+   done
+
+   # A trailing partial value is dropped on both paths.
+   head -c 100003 tmp/1 > tmp/4
+   cat tmp/4 | $sptk4/reverse > tmp/5
+   $sptk4/reverse tmp/4 > tmp/6
+   run cmp tmp/5 tmp/6
+   [ "$status" -eq 0 ]
+}
+
 @test "reverse: valgrind" {
    $sptk3/nrand -l 20 > tmp/1
    run valgrind $sptk4/reverse tmp/1
@@ -0,0 +1,137 @@
+#!/usr/bin/env bats
+# ----------------------------------------------------------------- #
+#             The Speech Signal Processing Toolkit (SPTK)           #
+#             developed by SPTK Working Group                       #
+#             http://sp-tk.sourceforge.net/                         #
+# ----------------------------------------------------------------- #
+#                                                                   #
+#  Copyright (c) 1984-2007  Tokyo Institute of Technology           #
+#                           Interdisciplinary Graduate School of    #
+#                           Science and Engineering                 #
+#                                                                   #
+#                1996-2021  Nagoya Institute of Technology          #
+#                           Department of Computer Science          #
+#                                                                   #
+# All rights reserved.                                              #
+#                                                                   #
+# Redistribution and use in source and binary forms, with or        #
+# without modification, are permitted provided that the following   #
+# conditions are met:                                               #
+#                                                                   #
+# - Redistributions of source code must retain the above copyright  #
+#   notice, this list of conditions and the following disclaimer.   #
+# - Redistributions in binary form must reproduce the above         #
+#   copyright notice, this list of conditions and the following     #
+#   disclaimer in the documentation and/or other materials provided #
+#   with the distribution.                                          #
+# - Neither the name of the SPTK working group nor the names of its #
+#   contributors may be used to endorse or promote products derived #
+#   from this software without specific prior written permission.   #
+#                                                                   #
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND            #
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,       #
+# INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF          #
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE          #
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS #
+# BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,          #
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED   #
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,     #
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON #
+# ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,   #
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY    #
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE           #
+# POSSIBILITY OF SUCH DAMAGE.                                       #
+# ----------------------------------------------------------------- #
+
+sptk3=tools/sptk/bin
+sptk4=bin
+
+setup() {
+   mkdir -p tmp
+   $sptk4/sptkd -s tmp/sock -T 2 &
+   daemon=$!
+   for i in $(seq 50); do
+      [ -S tmp/sock ] && break
+      sleep 0.1
+   done
+}
+
+teardown() {
+   kill $daemon
+   wait $daemon || true
+   rm -rf tmp
+}
+
+@test "sptkd: compatibility" {
+   $sptk3/nrand -l 8000 | $sptk3/x2x +ds > tmp/0
+   ary=("x2x +sd | frame -l 400 -p 80 -z"
+        "x2x +sd | frame -l 401 -p 80 -n 1 | window -l 401 -L 512 -w 1"
+        "x2x +sd | frame -l 64 -p 100 | window -l 64 -n 2 -w 4"
+        "x2x +sd | frame -l 512 -p 80 | window -l 512 | mgcep -l 512 -m 24 -a 0.42 -q 4"
+        "x2x +sd | frame -l 512 -p 80 | window -l 512 | mgcep -l 512 -c 2 -o 3 -q 4"
+        "x2x +sd | frame -l 100 -p 50 | x2x +df -r"
+        "x2x +sa -c 3")
+   for i in $(seq 0 $((${#ary[@]} - 1))); do
+      PATH=$PWD/$sptk4:$PATH sh -c "${ary[$i]}" < tmp/0 > tmp/1
+      $sptk4/sptkc -s tmp/sock "${ary[$i]}" < tmp/0 > tmp/2
+      $sptk4/sptkc -s tmp/sock -m "${ary[$i]}" tmp/0 > tmp/3
+      cat tmp/0 | $sptk4/sptkc -s tmp/sock "${ary[$i]}" > tmp/4
+      run cmp tmp/1 tmp/2
+      [ "$status" -eq 0 ]
+      run cmp tmp/1 tmp/3
+      [ "$status" -eq 0 ]
+      run cmp tmp/1 tmp/4
+      [ "$status" -eq 0 ]
+   done
+}
+
+@test "sptkd: fallback" {
+   $sptk3/nrand -l 20 > tmp/0
+   $sptk4/sopr -m 2 tmp/0 > tmp/1
+   PATH=$PWD/$sptk4:$PATH $sptk4/sptkc -s tmp/sock "sopr -m 2" < tmp/0 > tmp/2
+   run cmp tmp/1 tmp/2
+   [ "$status" -eq 0 ]
+   cat tmp/0 | PATH=$PWD/$sptk4:$PATH $sptk4/sptkc -s tmp/sock "sopr -m 2" > tmp/3
+   run cmp tmp/1 tmp/3
+   [ "$status" -eq 0 ]
+
+   run $sptk4/sptkc -s tmp/sock "frame -p 0" tmp/0
+   [ "$status" -ne 0 ]
+
+   # Quotes and redirections are interpreted by the shell.
+   $sptk4/x2x +da -f %.3f tmp/0 > tmp/1
+   PATH=$PWD/$sptk4:$PATH $sptk4/sptkc -s tmp/sock "x2x +da -f '%.3f'" \
+      < tmp/0 > tmp/2
+   run cmp tmp/1 tmp/2
+   [ "$status" -eq 0 ]
+   PATH=$PWD/$sptk4:$PATH $sptk4/sptkc -s tmp/sock "x2x +da -f %.3f > tmp/3" \
+      < tmp/0
+   run cmp tmp/1 tmp/3
+   [ "$status" -eq 0 ]
+}
+
+@test "sptkd: stuck client" {
+   $sptk4/sptkd -s tmp/sock2 &
+   pid=$!
+   for i in $(seq 50); do
+      [ -S tmp/sock2 ] && break
+      sleep 0.1
+   done
+   # The clients never end their input.
+   for i in $(seq 2); do
+      (sleep 30 | $sptk4/sptkc -s tmp/sock2 "x2x +sd") > /dev/null 2>&1 &
+   done
+   sleep 0.5
+   $sptk3/nrand -l 20 > tmp/0
+   $sptk4/sptkc -s tmp/sock2 "x2x +dd" < tmp/0 > tmp/1
+   run cmp tmp/0 tmp/1
+   [ "$status" -eq 0 ]
+
+   kill $pid
+   for i in $(seq 50); do
+      kill -0 $pid 2> /dev/null || break
+      sleep 0.1
+   done
+   run kill -0 $pid
+   [ "$status" -ne 0 ]
+}
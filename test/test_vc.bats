@@ -97,6 +97,37 @@ teardown() {
    [ "$status" -eq 0 ]
 }
 
+@test "vc: full covariance MLPG" {
+   # Make GMM of two separate mixture components with diagonal covariance.
+   echo 0.5 -10 -10 0 0 1 2 0.1 -0.2 1 1 1 1 0.5 1 0.2 0.3 \
+        0.5 10 10 0 0 -1 0.5 -0.1 0.3 1 1 1 1 1 0.4 0.1 0.5 |
+      $sptk3/x2x +ad > tmp/1
+
+   # Select the components in an irregular order and make the pdf sequence
+   # of the target part of the selected components.
+   awk 'BEGIN {
+      for (t = 0; t < 300; t++) {
+         if ((t * t) % 5 < 2) {
+            print -10, -10, 0, 0 > "tmp/2"
+            print 1, 2, 0.1, -0.2, 0.5, 1, 0.2, 0.3 > "tmp/3"
+         } else {
+            print 10, 10, 0, 0 > "tmp/2"
+            print -1, 0.5, -0.1, 0.3, 1, 0.4, 0.1, 0.5 > "tmp/3"
+         }
+      }
+   }'
+   $sptk3/x2x +ad tmp/2 > tmp/4
+   $sptk3/x2x +ad tmp/3 > tmp/5
+
+   # The conditional covariance is that of the target part, so the full
+   # covariance MLPG in vc solves the same problem as mlpg. The two solvers
+   # eliminate in different orders and differ by about 3e-7 here.
+   $sptk4/vc tmp/1 tmp/4 -l 2 -L 2 -k 2 -d -0.5 0 0.5 > tmp/6
+   $sptk4/mlpg -l 2 -d -0.5 0 0.5 tmp/5 > tmp/7
+   run $sptk4/aeq -t 1e-6 tmp/6 tmp/7
+   [ "$status" -eq 0 ]
+}
+
 @test "vc: valgrind" {
    $sptk4/gmm tmp/0 -l 10 -k 2 > tmp/1
    $sptk3/nrand -l 20 | $sptk3/delta -d -0.5 0 0.5 -l 3 > tmp/2